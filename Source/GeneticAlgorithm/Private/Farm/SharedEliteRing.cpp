@@ -0,0 +1,271 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Farm/SharedEliteRing.h"
+#include <atomic>
+
+static_assert(std::atomic<uint64>::is_always_lock_free, "Shared elite ring needs address-free 64-bit atomics");
+
+namespace
+{
+	constexpr uint32 RingMagic = 0x534D4C45; // 'SMLE'
+	constexpr uint32 RingVersion = 1;
+	constexpr SIZE_T CacheLine = 64;
+}
+
+struct FSharedEliteRing::FSlotHeader
+{
+	// Even = stable, odd = being written; stable value for ticket T is 2T+2
+	std::atomic<uint64> Seq;
+	int32 SourceProcess;
+	int32 Population;
+	int64 SolutionId;
+	float Fitness;
+	int32 NumFloats;
+	// float payload follows
+};
+
+struct alignas(CacheLine) FSharedEliteRing::FHeader
+{
+	uint32 Magic;
+	uint32 Version;
+	int32 NumSlots;
+	int32 MaxGenomeFloats;
+	alignas(CacheLine) std::atomic<uint64> WriteTicket;
+
+	struct alignas(CacheLine) FProgressSlot
+	{
+		std::atomic<uint64> Seq; // 0 = never written, odd = being written
+		FSharedFarmProgress Data;
+	};
+	FProgressSlot Progress[MaxProcesses];
+};
+
+FSharedEliteRing::~FSharedEliteRing()
+{
+	Close();
+}
+
+bool FSharedEliteRing::Create(const FString& Name, int32 NumSlots, int32 MaxGenomeFloats)
+{
+	if (!Map(Name, true, NumSlots, MaxGenomeFloats))
+	{
+		return false;
+	}
+	// Zero is the empty state for every sequence counter; clear leftovers of a region that outlived a crashed run
+	FMemory::Memzero(Region->GetAddress(), Region->GetSize());
+	Header->NumSlots = NumSlots;
+	Header->MaxGenomeFloats = MaxGenomeFloats;
+	Header->Version = RingVersion;
+	Header->WriteTicket.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	Header->Magic = RingMagic;
+	return true;
+}
+
+bool FSharedEliteRing::Open(const FString& Name, int32 NumSlots, int32 MaxGenomeFloats)
+{
+	if (!Map(Name, false, NumSlots, MaxGenomeFloats))
+	{
+		return false;
+	}
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (Header->Magic != RingMagic || Header->Version != RingVersion
+		|| Header->NumSlots != NumSlots || Header->MaxGenomeFloats != MaxGenomeFloats)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SharedEliteRing: '%s' has a different layout (slots %d, floats %d); not attaching."),
+			*Name, Header->NumSlots, Header->MaxGenomeFloats);
+		Close();
+		return false;
+	}
+	return true;
+}
+
+bool FSharedEliteRing::Map(const FString& Name, bool bCreate, int32 NumSlots, int32 MaxGenomeFloats)
+{
+	Close();
+	if (NumSlots <= 0 || MaxGenomeFloats <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SharedEliteRing: invalid dimensions (slots %d, floats %d)."), NumSlots, MaxGenomeFloats);
+		return false;
+	}
+
+	SlotStride = Align(sizeof(FSlotHeader) + sizeof(float) * static_cast<SIZE_T>(MaxGenomeFloats), CacheLine);
+	const SIZE_T Size = sizeof(FHeader) + SlotStride * static_cast<SIZE_T>(NumSlots);
+	const uint32 Access = FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write;
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, bCreate, Access, Size);
+	if (!Region)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SharedEliteRing: could not %s shared memory '%s' (%llu bytes)."),
+			bCreate ? TEXT("create") : TEXT("open"), *Name, static_cast<uint64>(Size));
+		return false;
+	}
+	Header = static_cast<FHeader*>(Region->GetAddress());
+	Slots = reinterpret_cast<uint8*>(Header) + sizeof(FHeader);
+	return true;
+}
+
+void FSharedEliteRing::Close()
+{
+	if (Region)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	}
+	Region = nullptr;
+	Header = nullptr;
+	Slots = nullptr;
+	SlotStride = 0;
+}
+
+uint8* FSharedEliteRing::SlotAddress(uint64 Ticket) const
+{
+	return Slots + SlotStride * static_cast<SIZE_T>(Ticket % static_cast<uint64>(Header->NumSlots));
+}
+
+uint64 FSharedEliteRing::GetWriteCursor() const
+{
+	return Header ? Header->WriteTicket.load(std::memory_order_acquire) : 0;
+}
+
+bool FSharedEliteRing::Publish(int32 SourceProcess, int32 Population, int64 SolutionId, float Fitness, TConstArrayView<float> Genome)
+{
+	if (!Header || Genome.Num() > Header->MaxGenomeFloats)
+	{
+		return false;
+	}
+
+	const uint64 Ticket = Header->WriteTicket.fetch_add(1, std::memory_order_acq_rel);
+	uint8* Address = SlotAddress(Ticket);
+	FSlotHeader* Slot = reinterpret_cast<FSlotHeader*>(Address);
+
+	Slot->Seq.store(2 * Ticket + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	Slot->SourceProcess = SourceProcess;
+	Slot->Population = Population;
+	Slot->SolutionId = SolutionId;
+	Slot->Fitness = Fitness;
+	Slot->NumFloats = Genome.Num();
+	FMemory::Memcpy(Address + sizeof(FSlotHeader), Genome.GetData(), sizeof(float) * Genome.Num());
+	Slot->Seq.store(2 * Ticket + 2, std::memory_order_release);
+	return true;
+}
+
+int32 FSharedEliteRing::Poll(int32 SelfProcess, uint64& InOutCursor, TArray<FSharedEliteRecord>& Out, int32 MaxRecords, double StaleRecordSeconds)
+{
+	if (!Header)
+	{
+		return 0;
+	}
+
+	const uint64 End = Header->WriteTicket.load(std::memory_order_acquire);
+	const uint64 NumSlots = static_cast<uint64>(Header->NumSlots);
+	if (End - InOutCursor > NumSlots)
+	{
+		InOutCursor = End - NumSlots; // lapped: the oldest records are gone
+	}
+
+	int32 Added = 0;
+	while (InOutCursor < End && Added < MaxRecords)
+	{
+		const uint64 Ticket = InOutCursor;
+		const uint8* Address = SlotAddress(Ticket);
+		const FSlotHeader* Slot = reinterpret_cast<const FSlotHeader*>(Address);
+		const uint64 Expected = 2 * Ticket + 2;
+
+		const uint64 Before = Slot->Seq.load(std::memory_order_acquire);
+		if (Before < Expected)
+		{
+			// The writer for this ticket has not finished; retry from here on the next poll. A writer that crashed
+			// after claiming the ticket never will, and would stall every reader until the ring laps it.
+			const double Now = FPlatformTime::Seconds();
+			if (StalledTicket != Ticket)
+			{
+				StalledTicket = Ticket;
+				StalledSince = Now;
+				break;
+			}
+			if (StaleRecordSeconds <= 0.0 || Now - StalledSince < StaleRecordSeconds)
+			{
+				break;
+			}
+			++InOutCursor;
+			continue;
+		}
+		++InOutCursor;
+		if (Before != Expected)
+		{
+			continue; // already overwritten by a later ticket
+		}
+
+		const int32 Source = Slot->SourceProcess;
+		const int32 NumFloats = FMath::Clamp(Slot->NumFloats, 0, Header->MaxGenomeFloats);
+		if (Source == SelfProcess)
+		{
+			continue;
+		}
+
+		FSharedEliteRecord& Record = Out.AddDefaulted_GetRef();
+		Record.SourceProcess = Source;
+		Record.Population = Slot->Population;
+		Record.SolutionId = Slot->SolutionId;
+		Record.Fitness = Slot->Fitness;
+		Record.Genome.SetNumUninitialized(NumFloats);
+		FMemory::Memcpy(Record.Genome.GetData(), Address + sizeof(FSlotHeader), sizeof(float) * NumFloats);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot->Seq.load(std::memory_order_relaxed) != Expected)
+		{
+			Out.Pop(EAllowShrinking::No); // torn by a lapping writer
+			continue;
+		}
+		++Added;
+	}
+	return Added;
+}
+
+void FSharedEliteRing::WriteProgress(int32 ProcessIndex, const FSharedFarmProgress& Progress)
+{
+	if (!Header || ProcessIndex < 0 || ProcessIndex >= MaxProcesses)
+	{
+		return;
+	}
+	// Single writer per slot: the owning process
+	FHeader::FProgressSlot& Slot = Header->Progress[ProcessIndex];
+	const uint64 Seq = Slot.Seq.load(std::memory_order_relaxed);
+	Slot.Seq.store(Seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	Slot.Data = Progress;
+	Slot.Data.ProcessIndex = ProcessIndex;
+	Slot.Seq.store(Seq + 2, std::memory_order_release);
+}
+
+void FSharedEliteRing::ReadProgress(TArray<FSharedFarmProgress>& Out) const
+{
+	Out.Reset();
+	if (!Header)
+	{
+		return;
+	}
+	for (int32 i = 0; i < MaxProcesses; ++i)
+	{
+		const FHeader::FProgressSlot& Slot = Header->Progress[i];
+		for (int32 Attempt = 0; Attempt < 4; ++Attempt)
+		{
+			const uint64 Before = Slot.Seq.load(std::memory_order_acquire);
+			if (Before == 0)
+			{
+				break;
+			}
+			if (Before & 1)
+			{
+				continue;
+			}
+			const FSharedFarmProgress Copy = Slot.Data;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (Slot.Seq.load(std::memory_order_relaxed) == Before)
+			{
+				Out.Add(Copy);
+				break;
+			}
+		}
+	}
+}
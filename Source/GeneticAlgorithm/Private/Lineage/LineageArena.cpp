@@ -0,0 +1,149 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Lineage/LineageArena.h"
+#include "Lineage/SolutionIdAllocator.h"
+#include "Components/GenomeComponents.h"
+#include "HAL/FileManager.h"
+#include "Misc/ScopeLock.h"
+
+FLineageArena& FLineageArena::Get(entt::registry& Registry)
+{
+	if (FLineageArena* Existing = Registry.ctx().find<FLineageArena>())
+	{
+		return *Existing;
+	}
+	return Registry.ctx().emplace<FLineageArena>();
+}
+
+void FLineageArena::Append(const FLineageRecord& Record)
+{
+	FScopeLock ScopeLock(&Lock);
+	const int32 Slot = Resident % RecordsPerChunk;
+	if (Slot == 0 && Resident / RecordsPerChunk >= Chunks.Num())
+	{
+		Chunks.Add(MakeUnique<FLineageRecord[]>(RecordsPerChunk));
+	}
+	Chunks[Resident / RecordsPerChunk][Slot] = Record;
+	++Resident;
+}
+
+int32 FLineageArena::NumResident() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Resident;
+}
+
+int64 FLineageArena::NumTotal() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Spilled + Discarded + Resident;
+}
+
+const FLineageRecord& FLineageArena::operator[](int32 Index) const
+{
+	check(Index >= 0 && Index < Resident);
+	return Chunks[Index / RecordsPerChunk][Index % RecordsPerChunk];
+}
+
+bool FLineageArena::SpillToFile(const FString& Filename)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (Resident == 0)
+	{
+		return true;
+	}
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename, FILEWRITE_Append | FILEWRITE_AllowRead));
+	if (!Writer)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FLineageArena: cannot open '%s' for writing; keeping %d records in memory."), *Filename, Resident);
+		return false;
+	}
+
+	for (int32 ChunkIdx = 0; ChunkIdx * RecordsPerChunk < Resident; ++ChunkIdx)
+	{
+		const int32 Count = FMath::Min(RecordsPerChunk, Resident - ChunkIdx * RecordsPerChunk);
+		Writer->Serialize(Chunks[ChunkIdx].Get(), static_cast<int64>(Count) * sizeof(FLineageRecord));
+	}
+	const bool bOk = Writer->Close() && !Writer->IsError();
+	if (!bOk)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FLineageArena: write to '%s' failed; keeping %d records in memory."), *Filename, Resident);
+		return false;
+	}
+
+	// Keep the first chunk allocated for the next batch of births
+	Chunks.SetNum(FMath::Min(1, Chunks.Num()));
+	Spilled += Resident;
+	Resident = 0;
+	return true;
+}
+
+void FLineageArena::DiscardOldest(int32 MaxResident)
+{
+	FScopeLock ScopeLock(&Lock);
+	// Every chunk before the last one is full, so the oldest chunk always holds RecordsPerChunk rows
+	while (Chunks.Num() > 1 && Resident - RecordsPerChunk >= FMath::Max(MaxResident, 0))
+	{
+		TUniquePtr<FLineageRecord[]> Oldest = MoveTemp(Chunks[0]);
+		Chunks.RemoveAt(0, 1, EAllowShrinking::No);
+		Chunks.Add(MoveTemp(Oldest));
+		Resident -= RecordsPerChunk;
+		Discarded += RecordsPerChunk;
+	}
+}
+
+void FLineageArena::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	Chunks.Reset();
+	Resident = 0;
+	Spilled = 0;
+	Discarded = 0;
+}
+
+FLineageParent FLineageArena::ReadParent(const entt::registry& Registry, entt::entity Parent, int32 Population)
+{
+	FLineageParent Result;
+	if (!Registry.valid(Parent))
+	{
+		return Result;
+	}
+	if (const FUniqueSolutionComponent* Unique = Registry.try_get<FUniqueSolutionComponent>(Parent))
+	{
+		Result.Id = Unique->Id;
+		Result.Generation = Unique->Generation;
+	}
+	if (const FFitnessComponent* Fit = Registry.try_get<FFitnessComponent>(Parent))
+	{
+		if (Fit->Fitness.IsValidIndex(Population))
+		{
+			Result.Fitness = Fit->Fitness[Population];
+			Result.bHasFitness = true;
+		}
+	}
+	return Result;
+}
+
+void FLineageArena::RecordBirth(entt::registry& Registry, entt::entity Child, entt::entity ParentA, entt::entity ParentB, int32 Population)
+{
+	RecordBirth(Registry, Child, ReadParent(Registry, ParentA, Population), ReadParent(Registry, ParentB, Population));
+}
+
+void FLineageArena::RecordBirth(entt::registry& Registry, entt::entity Child, const FLineageParent& ParentA, const FLineageParent& ParentB)
+{
+	FLineageRecord Record;
+	Record.ParentA = ParentA.Id;
+	Record.ParentB = ParentB.Id;
+	const int32 FitnessCount = (ParentA.bHasFitness ? 1 : 0) + (ParentB.bHasFitness ? 1 : 0);
+	const float FitnessSum = (ParentA.bHasFitness ? ParentA.Fitness : 0.0f) + (ParentB.bHasFitness ? ParentB.Fitness : 0.0f);
+
+	FUniqueSolutionComponent& ChildUnique = Registry.get_or_emplace<FUniqueSolutionComponent>(Child);
+	ChildUnique.Id = FSolutionIdAllocator::Get(Registry).Allocate();
+	ChildUnique.Generation = FMath::Max(ParentA.Generation, ParentB.Generation) + 1;
+
+	Record.Id = ChildUnique.Id;
+	Record.Generation = ChildUnique.Generation;
+	Record.BirthFitness = FitnessCount > 0 ? FitnessSum / FitnessCount : 0.0f;
+	Get(Registry).Append(Record);
+}
@@ -0,0 +1,51 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Lineage/SolutionIdAllocator.h"
+#include <atomic>
+
+namespace
+{
+	constexpr int64 SequenceMask = (int64(1) << FSolutionIdAllocator::SequenceBits) - 1;
+
+	// Sequence 0 is never handed out so that 0 keeps meaning "no id"
+	std::atomic<int64> NextSequence{ 1 };
+	std::atomic<int64> OriginBits{ 0 };
+}
+
+FSolutionIdAllocator& FSolutionIdAllocator::Get(entt::registry& Registry)
+{
+	if (FSolutionIdAllocator* Existing = Registry.ctx().find<FSolutionIdAllocator>())
+	{
+		return *Existing;
+	}
+	return Registry.ctx().emplace<FSolutionIdAllocator>();
+}
+
+FSolutionIdAllocator::FIdBlock FSolutionIdAllocator::ReserveBlock(int32 Count)
+{
+	Count = FMath::Max(1, Count);
+	const int64 First = NextSequence.fetch_add(Count, std::memory_order_relaxed);
+	checkf(First + Count <= SequenceMask, TEXT("Solution id sequence exhausted"));
+
+	const int64 Origin = OriginBits.load(std::memory_order_relaxed);
+	FIdBlock Block;
+	Block.Next = Origin | First;
+	Block.End = Origin | (First + Count);
+	return Block;
+}
+
+void FSolutionIdAllocator::SetProcessOrigin(int32 Origin)
+{
+	const int64 Clamped = FMath::Clamp<int64>(Origin, 0, 0x7FFF);
+	OriginBits.store(Clamped << SequenceBits, std::memory_order_relaxed);
+}
+
+int64 FSolutionIdAllocator::Allocate()
+{
+	// A block reserved before SetProcessOrigin would hand out ids that collide with other processes
+	if (Cached.IsEmpty() || (Cached.Next & ~SequenceMask) != OriginBits.load(std::memory_order_relaxed))
+	{
+		Cached = ReserveBlock(BlockSize);
+	}
+	return Cached.Pop();
+}
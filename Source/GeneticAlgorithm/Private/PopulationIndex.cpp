@@ -0,0 +1,311 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "PopulationIndex.h"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+
+namespace
+{
+	const TArray<entt::entity> EmptyEntitySet;
+}
+
+FPopulationIndex& FPopulationIndex::Get(entt::registry& Registry)
+{
+	if (FPopulationIndex* Existing = Registry.ctx().find<FPopulationIndex>())
+	{
+		return *Existing;
+	}
+
+	// The index is too large for EnTT's small-buffer storage, so the context keeps it on the heap
+	// and the instance address bound to the signals below stays stable.
+	FPopulationIndex& Index = Registry.ctx().emplace<FPopulationIndex>();
+	Index.Backfill(Registry);
+	Index.Connect(Registry);
+	return Index;
+}
+
+void FPopulationIndex::Release(entt::registry& Registry)
+{
+	FPopulationIndex* Existing = Registry.ctx().find<FPopulationIndex>();
+	if (!Existing)
+	{
+		return;
+	}
+
+	Registry.on_construct<FFitnessComponent>().disconnect(Existing);
+	Registry.on_update<FFitnessComponent>().disconnect(Existing);
+	Registry.on_destroy<FFitnessComponent>().disconnect(Existing);
+	Registry.on_construct<FEligibleForBreedingTagComponent>().disconnect(Existing);
+	Registry.on_destroy<FEligibleForBreedingTagComponent>().disconnect(Existing);
+	Registry.on_construct<FEliteTagComponent>().disconnect(Existing);
+	Registry.on_destroy<FEliteTagComponent>().disconnect(Existing);
+	Registry.ctx().erase<FPopulationIndex>();
+}
+
+void FPopulationIndex::Connect(entt::registry& Registry)
+{
+	Registry.on_construct<FFitnessComponent>().connect<&FPopulationIndex::OnFitnessChanged>(*this);
+	Registry.on_update<FFitnessComponent>().connect<&FPopulationIndex::OnFitnessChanged>(*this);
+	Registry.on_destroy<FFitnessComponent>().connect<&FPopulationIndex::OnFitnessDestroyed>(*this);
+
+	Registry.on_construct<FEligibleForBreedingTagComponent>().connect<&FPopulationIndex::OnEligibleConstructed>(*this);
+	Registry.on_destroy<FEligibleForBreedingTagComponent>().connect<&FPopulationIndex::OnEligibleDestroyed>(*this);
+
+	Registry.on_construct<FEliteTagComponent>().connect<&FPopulationIndex::OnEliteConstructed>(*this);
+	Registry.on_destroy<FEliteTagComponent>().connect<&FPopulationIndex::OnEliteDestroyed>(*this);
+}
+
+void FPopulationIndex::Backfill(entt::registry& Registry)
+{
+	// Tags first (they only record flags while no fitness is linked), then fitness links everything
+	for (auto Entity : Registry.view<FEliteTagComponent>())
+	{
+		OnEliteConstructed(Registry, Entity);
+	}
+	for (auto Entity : Registry.view<FEligibleForBreedingTagComponent>())
+	{
+		OnEligibleConstructed(Registry, Entity);
+	}
+	for (auto Entity : Registry.view<FFitnessComponent>())
+	{
+		OnFitnessChanged(Registry, Entity);
+	}
+}
+
+TConstArrayView<entt::entity> FPopulationIndex::GetMembers(int32 Pop) const
+{
+	return Populations.IsValidIndex(Pop) ? TConstArrayView<entt::entity>(Populations[Pop].Members) : TConstArrayView<entt::entity>(EmptyEntitySet);
+}
+
+TConstArrayView<entt::entity> FPopulationIndex::GetEligible(int32 Pop) const
+{
+	return Populations.IsValidIndex(Pop) ? TConstArrayView<entt::entity>(Populations[Pop].Eligible) : TConstArrayView<entt::entity>(EmptyEntitySet);
+}
+
+TConstArrayView<entt::entity> FPopulationIndex::GetElites(int32 Pop) const
+{
+	return Populations.IsValidIndex(Pop) ? TConstArrayView<entt::entity>(Populations[Pop].Elites) : TConstArrayView<entt::entity>(EmptyEntitySet);
+}
+
+float FPopulationIndex::GetMaxFitness(int32 Pop) const
+{
+	if (!Populations.IsValidIndex(Pop))
+	{
+		return -MAX_FLT;
+	}
+
+	FPopulation& Population = Populations[Pop];
+	if (Population.bMaxDirty)
+	{
+		// The previous best dropped or left; rescan this population only
+		Population.MaxFitness = -MAX_FLT;
+		Population.MaxHolder = entt::null;
+		for (const entt::entity Member : Population.Members)
+		{
+			const float Value = Entries[entt::to_entity(Member)].Value;
+			if (Population.MaxHolder == entt::null || Value > Population.MaxFitness)
+			{
+				Population.MaxFitness = Value;
+				Population.MaxHolder = Member;
+			}
+		}
+		Population.bMaxDirty = false;
+	}
+	return Population.MaxFitness;
+}
+
+double FPopulationIndex::GetTotalFitness(int32 Pop) const
+{
+	return Populations.IsValidIndex(Pop) ? Populations[Pop].TotalFitness : 0.0;
+}
+
+bool FPopulationIndex::IsElite(entt::entity Entity) const
+{
+	const FEntry* Entry = FindEntry(Entity);
+	return Entry && Entry->bElite;
+}
+
+bool FPopulationIndex::IsEligible(entt::entity Entity) const
+{
+	const FEntry* Entry = FindEntry(Entity);
+	return Entry && Entry->bEligible;
+}
+
+FPopulationIndex::FEntry& FPopulationIndex::GetEntry(entt::entity Entity)
+{
+	const int32 Slot = static_cast<int32>(entt::to_entity(Entity));
+	if (Slot >= Entries.Num())
+	{
+		Entries.SetNum(Slot + 1);
+	}
+	return Entries[Slot];
+}
+
+const FPopulationIndex::FEntry* FPopulationIndex::FindEntry(entt::entity Entity) const
+{
+	if (Entity == entt::null)
+	{
+		return nullptr;
+	}
+	const int32 Slot = static_cast<int32>(entt::to_entity(Entity));
+	return Entries.IsValidIndex(Slot) ? &Entries[Slot] : nullptr;
+}
+
+void FPopulationIndex::AddToSet(TArray<entt::entity>& Set, entt::entity Entity, int32& OutSlot)
+{
+	OutSlot = Set.Add(Entity);
+}
+
+void FPopulationIndex::RemoveFromSet(TArray<entt::entity>& Set, int32& InOutSlot, int32 FEntry::* SlotMember)
+{
+	if (InOutSlot == INDEX_NONE)
+	{
+		return;
+	}
+	// Swap-remove; patch the slot of the entity that moved into the hole
+	const int32 Last = Set.Num() - 1;
+	if (InOutSlot != Last)
+	{
+		const entt::entity Moved = Set[Last];
+		Set[InOutSlot] = Moved;
+		Entries[entt::to_entity(Moved)].*SlotMember = InOutSlot;
+	}
+	Set.Pop(EAllowShrinking::No);
+	InOutSlot = INDEX_NONE;
+}
+
+void FPopulationIndex::Link(entt::entity Entity, FEntry& Entry)
+{
+	if (!Entry.bHasFitness)
+	{
+		return;
+	}
+	if (Entry.Pop < 0)
+	{
+		UnassignedNonElites += Entry.bElite ? 0 : 1;
+		return;
+	}
+
+	if (Populations.Num() <= Entry.Pop)
+	{
+		Populations.SetNum(Entry.Pop + 1);
+	}
+	FPopulation& Population = Populations[Entry.Pop];
+	AddToSet(Population.Members, Entity, Entry.MemberSlot);
+	if (Entry.bEligible)
+	{
+		AddToSet(Population.Eligible, Entity, Entry.EligibleSlot);
+	}
+	if (Entry.bElite)
+	{
+		AddToSet(Population.Elites, Entity, Entry.EliteSlot);
+	}
+
+	Population.TotalFitness += Entry.Value;
+	if (!Population.bMaxDirty && (Population.MaxHolder == entt::null || Entry.Value >= Population.MaxFitness))
+	{
+		Population.MaxFitness = Entry.Value;
+		Population.MaxHolder = Entity;
+	}
+}
+
+void FPopulationIndex::Unlink(entt::entity Entity, FEntry& Entry)
+{
+	if (!Entry.bHasFitness)
+	{
+		return;
+	}
+	if (Entry.Pop < 0)
+	{
+		UnassignedNonElites -= Entry.bElite ? 0 : 1;
+		return;
+	}
+
+	FPopulation& Population = Populations[Entry.Pop];
+	RemoveFromSet(Population.Members, Entry.MemberSlot, &FEntry::MemberSlot);
+	RemoveFromSet(Population.Eligible, Entry.EligibleSlot, &FEntry::EligibleSlot);
+	RemoveFromSet(Population.Elites, Entry.EliteSlot, &FEntry::EliteSlot);
+
+	Population.TotalFitness -= Entry.Value;
+	if (Population.MaxHolder == Entity)
+	{
+		Population.bMaxDirty = true;
+	}
+}
+
+void FPopulationIndex::OnFitnessChanged(entt::registry& Registry, entt::entity Entity)
+{
+	const FFitnessComponent& Fit = Registry.get<FFitnessComponent>(Entity);
+	FEntry& Entry = GetEntry(Entity);
+
+	Unlink(Entity, Entry);
+	const int32 Pop = Fit.BuiltForFitnessIndex;
+	const bool bValidPop = Pop >= 0 && Pop < Fit.Fitness.Num();
+	Entry.bHasFitness = true;
+	Entry.Pop = bValidPop ? Pop : INDEX_NONE;
+	Entry.Value = bValidPop ? Fit.Fitness[Pop] : 0.0f;
+	Link(Entity, Entry);
+}
+
+void FPopulationIndex::OnFitnessDestroyed(entt::registry& /*Registry*/, entt::entity Entity)
+{
+	FEntry& Entry = GetEntry(Entity);
+	Unlink(Entity, Entry);
+	Entry.bHasFitness = false;
+	Entry.Pop = INDEX_NONE;
+	Entry.Value = 0.0f;
+}
+
+void FPopulationIndex::OnEligibleConstructed(entt::registry& /*Registry*/, entt::entity Entity)
+{
+	FEntry& Entry = GetEntry(Entity);
+	Entry.bEligible = true;
+	if (Entry.bHasFitness && Entry.Pop >= 0)
+	{
+		AddToSet(Populations[Entry.Pop].Eligible, Entity, Entry.EligibleSlot);
+	}
+}
+
+void FPopulationIndex::OnEligibleDestroyed(entt::registry& /*Registry*/, entt::entity Entity)
+{
+	FEntry& Entry = GetEntry(Entity);
+	if (Entry.bHasFitness && Entry.Pop >= 0)
+	{
+		RemoveFromSet(Populations[Entry.Pop].Eligible, Entry.EligibleSlot, &FEntry::EligibleSlot);
+	}
+	Entry.bEligible = false;
+}
+
+void FPopulationIndex::OnEliteConstructed(entt::registry& /*Registry*/, entt::entity Entity)
+{
+	FEntry& Entry = GetEntry(Entity);
+	if (Entry.bHasFitness)
+	{
+		if (Entry.Pop >= 0)
+		{
+			AddToSet(Populations[Entry.Pop].Elites, Entity, Entry.EliteSlot);
+		}
+		else
+		{
+			--UnassignedNonElites;
+		}
+	}
+	Entry.bElite = true;
+}
+
+void FPopulationIndex::OnEliteDestroyed(entt::registry& /*Registry*/, entt::entity Entity)
+{
+	FEntry& Entry = GetEntry(Entity);
+	if (Entry.bHasFitness)
+	{
+		if (Entry.Pop >= 0)
+		{
+			RemoveFromSet(Populations[Entry.Pop].Elites, Entry.EliteSlot, &FEntry::EliteSlot);
+		}
+		else
+		{
+			++UnassignedNonElites;
+		}
+	}
+	Entry.bElite = false;
+}
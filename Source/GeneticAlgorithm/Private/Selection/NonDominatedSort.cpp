@@ -0,0 +1,384 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Selection/NonDominatedSort.h"
+#include "Algo/Sort.h"
+
+bool FNonDominatedSorter::Dominates(const float* Objectives, int32 NumSolutions, int32 NumObjectives, int32 A, int32 B)
+{
+	bool bStrictlyBetter = false;
+	for (int32 Obj = 0; Obj < NumObjectives; ++Obj)
+	{
+		const float* Column = Objectives + static_cast<int64>(Obj) * NumSolutions;
+		if (Column[A] > Column[B])
+		{
+			return false;
+		}
+		bStrictlyBetter |= Column[A] < Column[B];
+	}
+	return bStrictlyBetter;
+}
+
+namespace
+{
+	// Below these sizes a direct pairwise check is cheaper than splitting further
+	constexpr int32 RankRangeBruteForceSize = 32;
+	constexpr int32 PushRanksBruteForcePairs = 256;
+}
+
+int32 FNonDominatedSorter::Sort(TConstArrayView<float> Objectives, int32 NumSolutions, int32 NumObjectives, TArray<int32>& OutRank)
+{
+	for (int32 F = 0; F < ActiveFronts; ++F)
+	{
+		Fronts[F].Reset();
+	}
+	ActiveFronts = 0;
+	OutRank.SetNumUninitialized(NumSolutions, EAllowShrinking::No);
+	if (NumSolutions <= 0 || NumObjectives <= 0)
+	{
+		return 0;
+	}
+	check(Objectives.Num() >= NumSolutions * NumObjectives);
+	const float* Data = Objectives.GetData();
+
+	// Lexicographic order: any dominator of a solution precedes it
+	Order.SetNumUninitialized(NumSolutions, EAllowShrinking::No);
+	for (int32 i = 0; i < NumSolutions; ++i)
+	{
+		Order[i] = i;
+	}
+	Order.Sort([Data, NumSolutions, NumObjectives](int32 A, int32 B)
+	{
+		for (int32 Obj = 0; Obj < NumObjectives; ++Obj)
+		{
+			const float* Column = Data + static_cast<int64>(Obj) * NumSolutions;
+			if (Column[A] != Column[B])
+			{
+				return Column[A] < Column[B];
+			}
+		}
+		return A < B;
+	});
+
+	if (NumObjectives <= 2)
+	{
+		SortTwoObjectives(Data, NumSolutions, NumObjectives, OutRank);
+		return ActiveFronts;
+	}
+
+	SortDivideAndConquer(Data, NumSolutions, NumObjectives, OutRank);
+
+	// Walking the lexicographic order keeps every front in that order
+	for (const int32 Solution : Order)
+	{
+		const int32 Front = OutRank[Solution];
+		while (ActiveFronts <= Front)
+		{
+			if (Fronts.Num() <= ActiveFronts)
+			{
+				Fronts.AddDefaulted();
+			}
+			++ActiveFronts;
+		}
+		Fronts[Front].Add(Solution);
+	}
+	return ActiveFronts;
+}
+
+void FNonDominatedSorter::SortTwoObjectives(const float* Objectives, int32 NumSolutions, int32 NumObjectives, TArray<int32>& OutRank)
+{
+	for (const int32 Solution : Order)
+	{
+		// Within a front sorted lexicographically the second objective is non-increasing, so the last member
+		// is the only one that can dominate a later solution. Being dominated by front k implies being
+		// dominated by every earlier front, so binary search
+		int32 Lo = 0;
+		int32 Hi = ActiveFronts;
+		while (Lo < Hi)
+		{
+			const int32 Mid = (Lo + Hi) / 2;
+			if (Dominates(Objectives, NumSolutions, NumObjectives, Fronts[Mid].Last(), Solution))
+			{
+				Lo = Mid + 1;
+			}
+			else
+			{
+				Hi = Mid;
+			}
+		}
+		if (Lo == ActiveFronts)
+		{
+			if (Fronts.Num() <= ActiveFronts)
+			{
+				Fronts.AddDefaulted();
+			}
+			++ActiveFronts;
+		}
+		Fronts[Lo].Add(Solution);
+		OutRank[Solution] = Lo;
+	}
+}
+
+void FNonDominatedSorter::SortDivideAndConquer(const float* Objectives, int32 NumSolutions, int32 NumObjectives, TArray<int32>& OutRank)
+{
+	SortData = Objectives;
+	SortNumSolutions = NumSolutions;
+	SortNumObjectives = NumObjectives;
+
+	// Identical objective vectors share a rank; only the first of each run takes part in the recursion.
+	// Among distinct points, A dominates B exactly when A precedes B and is no worse in objectives 1..M-1
+	Distinct.Reset();
+	for (const int32 Solution : Order)
+	{
+		bool bSame = Distinct.Num() > 0;
+		for (int32 Obj = 0; bSame && Obj < NumObjectives; ++Obj)
+		{
+			const float* Column = Objectives + static_cast<int64>(Obj) * NumSolutions;
+			bSame = Column[Solution] == Column[Distinct.Last()];
+		}
+		if (!bSame)
+		{
+			Distinct.Add(Solution);
+		}
+		OutRank[Solution] = Distinct.Num() - 1;
+	}
+
+	DistinctRank.SetNumUninitialized(Distinct.Num(), EAllowShrinking::No);
+	FMemory::Memzero(DistinctRank.GetData(), DistinctRank.Num() * sizeof(int32));
+	if (SplitScratch.Num() < NumObjectives)
+	{
+		SplitScratch.SetNum(NumObjectives);
+	}
+	RankRange(0, Distinct.Num());
+
+	for (int32 Solution = 0; Solution < NumSolutions; ++Solution)
+	{
+		OutRank[Solution] = DistinctRank[OutRank[Solution]];
+	}
+	SortData = nullptr;
+}
+
+bool FNonDominatedSorter::IsNoWorse(int32 A, int32 B, int32 FirstObjective) const
+{
+	for (int32 Obj = FirstObjective; Obj < SortNumObjectives; ++Obj)
+	{
+		if (Value(Obj, A) > Value(Obj, B))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FNonDominatedSorter::RankRange(int32 Begin, int32 End)
+{
+	const int32 Count = End - Begin;
+	if (Count <= RankRangeBruteForceSize)
+	{
+		for (int32 B = Begin + 1; B < End; ++B)
+		{
+			for (int32 A = Begin; A < B; ++A)
+			{
+				if (DistinctRank[A] >= DistinctRank[B] && IsNoWorse(A, B, 1))
+				{
+					DistinctRank[B] = DistinctRank[A] + 1;
+				}
+			}
+		}
+		return;
+	}
+
+	// The left half is final before its ranks are pushed into the right half
+	const int32 Mid = Begin + Count / 2;
+	RankRange(Begin, Mid);
+
+	TArray<FSplitPoint>& Points = SplitScratch[0];
+	Points.SetNumUninitialized(Count, EAllowShrinking::No);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Points[i].Position = Begin + i;
+		Points[i].bLeft = Begin + i < Mid;
+	}
+	PushRanks(Points, 1, 0);
+
+	RankRange(Mid, End);
+}
+
+void FNonDominatedSorter::PushRanks(TArrayView<FSplitPoint> Points, int32 Objective, int32 Depth)
+{
+	int32 NumLeft = 0;
+	int32 BestLeft = -1;
+	for (const FSplitPoint& Point : Points)
+	{
+		if (Point.bLeft)
+		{
+			++NumLeft;
+			BestLeft = FMath::Max(BestLeft, DistinctRank[Point.Position]);
+		}
+	}
+	const int32 NumRight = Points.Num() - NumLeft;
+	if (NumLeft == 0 || NumRight == 0)
+	{
+		return;
+	}
+
+	if (Objective >= SortNumObjectives)
+	{
+		// Nothing left to compare: every left point dominates every right point
+		for (const FSplitPoint& Point : Points)
+		{
+			if (!Point.bLeft)
+			{
+				DistinctRank[Point.Position] = FMath::Max(DistinctRank[Point.Position], BestLeft + 1);
+			}
+		}
+		return;
+	}
+
+	if (NumLeft * NumRight <= PushRanksBruteForcePairs)
+	{
+		for (const FSplitPoint& Right : Points)
+		{
+			if (Right.bLeft)
+			{
+				continue;
+			}
+			for (const FSplitPoint& Left : Points)
+			{
+				if (Left.bLeft && DistinctRank[Left.Position] >= DistinctRank[Right.Position] && IsNoWorse(Left.Position, Right.Position, Objective))
+				{
+					DistinctRank[Right.Position] = DistinctRank[Left.Position] + 1;
+				}
+			}
+		}
+		return;
+	}
+
+	// Left points come first on ties so they count for equal right points
+	Algo::Sort(Points, [this, Objective](const FSplitPoint& A, const FSplitPoint& B)
+	{
+		const float ValueA = Value(Objective, A.Position);
+		const float ValueB = Value(Objective, B.Position);
+		return ValueA != ValueB ? ValueA < ValueB : A.bLeft && !B.bLeft;
+	});
+
+	if (Objective == SortNumObjectives - 1)
+	{
+		// Last objective: a sweep with the best left rank seen so far
+		int32 Running = -1;
+		for (const FSplitPoint& Point : Points)
+		{
+			if (Point.bLeft)
+			{
+				Running = FMath::Max(Running, DistinctRank[Point.Position]);
+			}
+			else if (Running >= 0)
+			{
+				DistinctRank[Point.Position] = FMath::Max(DistinctRank[Point.Position], Running + 1);
+			}
+		}
+		return;
+	}
+
+	// Split at the median: points above it cannot be beaten in this objective by points below it.
+	// Prefer "<= median" as the low side; fall back to "< median" when the median is the maximum
+	const int32 Num = Points.Num();
+	const float Median = Value(Objective, Points[Num / 2].Position);
+	int32 Split = Num / 2;
+	while (Split < Num && Value(Objective, Points[Split].Position) <= Median)
+	{
+		++Split;
+	}
+	if (Split == Num)
+	{
+		Split = Num / 2;
+		while (Split > 0 && Value(Objective, Points[Split - 1].Position) >= Median)
+		{
+			--Split;
+		}
+	}
+	if (Split == 0)
+	{
+		// Every point shares this objective's value
+		PushRanks(Points, Objective + 1, Depth);
+		return;
+	}
+
+	const TArrayView<FSplitPoint> Low = Points.Slice(0, Split);
+	const TArrayView<FSplitPoint> High = Points.Slice(Split, Num - Split);
+
+	// Low left points are strictly better than high right points in this objective, so drop it for that pair
+	TArray<FSplitPoint>& Cross = SplitScratch[Depth + 1];
+	Cross.Reset();
+	for (const FSplitPoint& Point : Low)
+	{
+		if (Point.bLeft)
+		{
+			Cross.Add(Point);
+		}
+	}
+	for (const FSplitPoint& Point : High)
+	{
+		if (!Point.bLeft)
+		{
+			Cross.Add(Point);
+		}
+	}
+	PushRanks(Cross, Objective + 1, Depth + 1);
+
+	// High left points cannot dominate low right points; the rest stays within each side
+	PushRanks(Low, Objective, Depth);
+	PushRanks(High, Objective, Depth);
+}
+
+void FNonDominatedSorter::ComputeCrowding(TConstArrayView<float> Objectives, int32 NumSolutions, int32 NumObjectives, TArray<float>& OutCrowding)
+{
+	OutCrowding.SetNumZeroed(NumSolutions, EAllowShrinking::No);
+	const float* Data = Objectives.GetData();
+
+	for (int32 F = 0; F < ActiveFronts; ++F)
+	{
+		const TArray<int32>& Members = Fronts[F];
+		const int32 Size = Members.Num();
+		if (Size <= 2)
+		{
+			for (const int32 Member : Members)
+			{
+				OutCrowding[Member] = TNumericLimits<float>::Max();
+			}
+			continue;
+		}
+
+		for (int32 Obj = 0; Obj < NumObjectives; ++Obj)
+		{
+			const float* Column = Data + static_cast<int64>(Obj) * NumSolutions;
+			SortedMembers = Members;
+			SortedMembers.Sort([Column](int32 A, int32 B) { return Column[A] < Column[B]; });
+
+			// Gather into a contiguous array so the neighbour-difference pass is a straight streaming loop
+			SortedValues.SetNumUninitialized(Size, EAllowShrinking::No);
+			for (int32 k = 0; k < Size; ++k)
+			{
+				SortedValues[k] = Column[SortedMembers[k]];
+			}
+			const float Range = SortedValues[Size - 1] - SortedValues[0];
+			OutCrowding[SortedMembers[0]] = TNumericLimits<float>::Max();
+			OutCrowding[SortedMembers[Size - 1]] = TNumericLimits<float>::Max();
+			if (Range <= 0.0f)
+			{
+				continue;
+			}
+
+			const float InvRange = 1.0f / Range;
+			Gaps.SetNumUninitialized(Size, EAllowShrinking::No);
+			for (int32 k = 1; k < Size - 1; ++k)
+			{
+				Gaps[k] = (SortedValues[k + 1] - SortedValues[k - 1]) * InvRange;
+			}
+			for (int32 k = 1; k < Size - 1; ++k)
+			{
+				float& Crowd = OutCrowding[SortedMembers[k]];
+				Crowd = Crowd >= TNumericLimits<float>::Max() ? Crowd : Crowd + Gaps[k];
+			}
+		}
+	}
+}
@@ -0,0 +1,190 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Statistics/QuantileSketch.h"
+#include "Algo/Sort.h"
+
+FQuantileSketch::FQuantileSketch(double InCompression)
+	: Compression(FMath::Max(10.0, InCompression))
+	, BufferCapacity(FMath::CeilToInt32(5.0 * FMath::Max(10.0, InCompression)))
+{
+}
+
+void FQuantileSketch::Reset()
+{
+	TotalWeight = 0.0;
+	Min = TNumericLimits<double>::Max();
+	Max = TNumericLimits<double>::Lowest();
+	Centroids.Reset();
+	Buffer.Reset();
+}
+
+void FQuantileSketch::Add(double Value, double Weight)
+{
+	if (!(Weight > 0.0) || !FMath::IsFinite(Value))
+	{
+		return;
+	}
+
+	Buffer.Add(FCentroid{ Value, Weight });
+	TotalWeight += Weight;
+	Min = FMath::Min(Min, Value);
+	Max = FMath::Max(Max, Value);
+
+	if (Buffer.Num() >= BufferCapacity)
+	{
+		Flush();
+	}
+}
+
+void FQuantileSketch::Merge(const FQuantileSketch& Other)
+{
+	if (Other.IsEmpty())
+	{
+		return;
+	}
+
+	// Re-inserting the other digest's centroids as weighted points keeps the size bound
+	Other.Flush();
+	Buffer.Append(Other.Centroids);
+	TotalWeight += Other.TotalWeight;
+	Min = FMath::Min(Min, Other.Min);
+	Max = FMath::Max(Max, Other.Max);
+	Flush();
+}
+
+int32 FQuantileSketch::NumCentroids() const
+{
+	Flush();
+	return Centroids.Num();
+}
+
+void FQuantileSketch::Flush() const
+{
+	if (Buffer.Num() == 0)
+	{
+		return;
+	}
+
+	Buffer.Append(Centroids);
+	Algo::SortBy(Buffer, &FCentroid::Mean);
+
+	// k1 scale function: k(q) = delta / (2*pi) * asin(2q - 1). A centroid may grow while its
+	// right edge stays within one unit of k from its left edge, so centroids near the tails stay small.
+	const double Normalizer = Compression / (2.0 * PI);
+	auto K = [Normalizer](double Q) { return Normalizer * FMath::Asin(2.0 * FMath::Clamp(Q, 0.0, 1.0) - 1.0); };
+	auto KInv = [Normalizer](double KValue) { return 0.5 * (FMath::Sin(FMath::Min(KValue / Normalizer, 0.5 * PI)) + 1.0); };
+
+	double Total = 0.0;
+	for (const FCentroid& C : Buffer)
+	{
+		Total += C.Weight;
+	}
+
+	Scratch.Reset(Buffer.Num());
+	double WeightSoFar = 0.0;
+	double WeightLimit = Total * KInv(K(0.0) + 1.0);
+	FCentroid Current = Buffer[0];
+	for (int32 i = 1; i < Buffer.Num(); ++i)
+	{
+		const FCentroid& Next = Buffer[i];
+		if (WeightSoFar + Current.Weight + Next.Weight <= WeightLimit)
+		{
+			const double NewWeight = Current.Weight + Next.Weight;
+			Current.Mean += (Next.Mean - Current.Mean) * Next.Weight / NewWeight;
+			Current.Weight = NewWeight;
+		}
+		else
+		{
+			WeightSoFar += Current.Weight;
+			Scratch.Add(Current);
+			WeightLimit = Total * KInv(K(WeightSoFar / Total) + 1.0);
+			Current = Next;
+		}
+	}
+	Scratch.Add(Current);
+
+	Swap(Centroids, Scratch);
+	Buffer.Reset();
+}
+
+double FQuantileSketch::Quantile(double Q) const
+{
+	if (IsEmpty())
+	{
+		return 0.0;
+	}
+	Flush();
+
+	Q = FMath::Clamp(Q, 0.0, 1.0);
+	if (Centroids.Num() == 1)
+	{
+		return Centroids[0].Mean;
+	}
+
+	// Each centroid's mass is treated as centered on its mean; interpolate between adjacent centers,
+	// and between Min/Max and the outermost centers at the tails.
+	const double Target = Q * TotalWeight;
+	const FCentroid& First = Centroids[0];
+	if (Target < First.Weight * 0.5)
+	{
+		return FMath::Lerp(Min, First.Mean, Target / (First.Weight * 0.5));
+	}
+
+	double Cumulative = First.Weight * 0.5;
+	for (int32 i = 0; i + 1 < Centroids.Num(); ++i)
+	{
+		const FCentroid& Left = Centroids[i];
+		const FCentroid& Right = Centroids[i + 1];
+		const double Span = 0.5 * (Left.Weight + Right.Weight);
+		if (Target < Cumulative + Span)
+		{
+			return FMath::Lerp(Left.Mean, Right.Mean, (Target - Cumulative) / Span);
+		}
+		Cumulative += Span;
+	}
+
+	const FCentroid& Last = Centroids.Last();
+	const double Tail = Last.Weight * 0.5;
+	return FMath::Lerp(Last.Mean, Max, FMath::Clamp((Target - Cumulative) / Tail, 0.0, 1.0));
+}
+
+double FQuantileSketch::Cdf(double X) const
+{
+	if (IsEmpty() || X < Min)
+	{
+		return 0.0;
+	}
+	if (X >= Max)
+	{
+		return 1.0;
+	}
+	Flush();
+
+	const FCentroid& First = Centroids[0];
+	if (X < First.Mean)
+	{
+		const double Span = First.Mean - Min;
+		const double Frac = Span > 0.0 ? (X - Min) / Span : 1.0;
+		return Frac * First.Weight * 0.5 / TotalWeight;
+	}
+
+	double Cumulative = First.Weight * 0.5;
+	for (int32 i = 0; i + 1 < Centroids.Num(); ++i)
+	{
+		const FCentroid& Left = Centroids[i];
+		const FCentroid& Right = Centroids[i + 1];
+		const double Mass = 0.5 * (Left.Weight + Right.Weight);
+		if (X < Right.Mean)
+		{
+			const double Span = Right.Mean - Left.Mean;
+			const double Frac = Span > 0.0 ? (X - Left.Mean) / Span : 1.0;
+			return (Cumulative + Frac * Mass) / TotalWeight;
+		}
+		Cumulative += Mass;
+	}
+
+	const FCentroid& Last = Centroids.Last();
+	const double Span = Max - Last.Mean;
+	const double Frac = Span > 0.0 ? (X - Last.Mean) / Span : 1.0;
+	return FMath::Min(1.0, (Cumulative + Frac * Last.Weight * 0.5) / TotalWeight);
+}
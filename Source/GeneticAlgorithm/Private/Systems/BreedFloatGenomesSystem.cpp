@@ -2,7 +2,8 @@
 
 #include "Systems/BreedFloatGenomesSystem.h"
 #include "Components/GenomeComponents.h"
-#include "Components/BreedingPairComponent.h"
+#include "BreedingPlan.h"
+#include "Lineage/LineageArena.h"
 #include "Math/UnrealMathUtility.h"
 
 float UBreedFloatGenomesSystem::SampleSbxChild(float X1, float X2, float U, float EtaLocal, bool bPickFirst) const
@@ -42,31 +43,43 @@ float UBreedFloatGenomesSystem::SampleSbxChild(float X1, float X2, float U, floa
 	}
 }
 
-void UBreedFloatGenomesSystem::Update_Implementation(float /*DeltaTime*/)
+void UBreedFloatGenomesSystem::BreedGenome(TConstArrayView<float> ParentA, TConstArrayView<float> ParentB, TArrayView<float> Child, FRandomStream* RngPtr) const
 {
-	auto& Registry = GetRegistry();
-
-	auto ResetView = GetView<FResetGenomeComponent, FGenomeFloatViewComponent>();
-	auto PairView = GetView<FBreedingPairComponent>();
-
-	if (ResetView.begin() == ResetView.end())
+	const int32 GeneCount = FMath::Min3(ParentA.Num(), ParentB.Num(), Child.Num());
+	for (int32 g = 0; g < GeneCount; ++g)
 	{
-		return; // nothing to reset
-	}
+		const float a = ParentA[g];
+		const float b = ParentB[g];
+		const float rand01 = RngPtr ? RngPtr->FRand() : FMath::FRand();
+		float value;
+		if (rand01 < CrossoverProbability)
+		{
+			const float u = RngPtr ? RngPtr->FRand() : FMath::FRand();
+			const bool bFirst = (RngPtr ? (RngPtr->RandRange(0,1) == 0) : (FMath::RandRange(0,1) == 0));
+			value = SampleSbxChild(a, b, u, Eta, bFirst);
+		}
+		else
+		{
+			// Copy a gene from a random parent when no crossover
+			const bool bPickA = (RngPtr ? (RngPtr->RandRange(0,1) == 0) : (FMath::RandRange(0,1) == 0));
+			value = bPickA ? a : b;
+		}
 
-	// Build a map from child entity id -> breeding pair, keyed by ChildEntity.
-	// Only pairs that name a specific child (ChildEntity != 0) are usable.
-	TMap<uint32, const FBreedingPairComponent*> PairByChild;
-	for (auto PairEntity : PairView)
-	{
-		const FBreedingPairComponent& Pair = Registry.get<FBreedingPairComponent>(PairEntity);
-		if (Pair.ChildEntity != 0u)
+		if (bClampChildren)
 		{
-			PairByChild.Add(Pair.ChildEntity, &Pair);
+			value = FMath::Clamp(value, ClampMin, ClampMax);
 		}
+		Child[g] = value;
 	}
+}
+
+void UBreedFloatGenomesSystem::Update_Implementation(float /*DeltaTime*/)
+{
+	auto& Registry = GetRegistry();
 
-	if (PairByChild.IsEmpty())
+	// Selection scheduled one entry per child; consume them in order
+	const FBreedingPlan& Plan = FBreedingPlan::Get(Registry);
+	if (Plan.IsEmpty())
 	{
 		return; // no eligible children to breed this tick
 	}
@@ -80,36 +93,28 @@ void UBreedFloatGenomesSystem::Update_Implementation(float /*DeltaTime*/)
 		RngPtr = &Rng;
 	}
 
-	int32 Index = 0;
-	for (auto ResetIt = ResetView.begin(), ResetEnd = ResetView.end(); ResetIt != ResetEnd; ++ResetIt, ++Index)
+	const TConstArrayView<FBreedingPlanEntry> Entries = Plan.GetEntries();
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
 	{
-		const entt::entity ChildEntity = *ResetIt;
-		const uint32 ChildId = static_cast<uint32>(ChildEntity);
-
-		// Only breed this child if tournament selection produced a pair for it
-		const FBreedingPairComponent* const* FoundPair = PairByChild.Find(ChildId);
-		if (!FoundPair)
-		{
-			continue; // not eligible for breeding this tick (e.g. too young, blocked reason)
-		}
-		const FBreedingPairComponent& Pair = **FoundPair;
-
-		const entt::entity ParentA = static_cast<entt::entity>(Pair.ParentA);
-		const entt::entity ParentB = static_cast<entt::entity>(Pair.ParentB);
+		const FBreedingPlanEntry& Entry = Entries[Index];
+		const entt::entity ChildEntity = Entry.Child;
+		const entt::entity ParentA = Entry.ParentA;
+		const entt::entity ParentB = Entry.ParentB;
 
 		if (ParentA == entt::null || ParentB == entt::null)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("BreedFloatGenomesSystem: invalid parent(s) in pair at reset index %d"), Index);
+			UE_LOG(LogTemp, Warning, TEXT("BreedFloatGenomesSystem: invalid parent(s) in plan entry %d"), Index);
 			continue;
 		}
 
-		// Resolve parent genome views
-		if (!Registry.all_of<FGenomeFloatViewComponent>(ChildEntity))
+		// Only float-genome children still flagged for reset are bred here; the plan is shared with char breeding
+		if (!Registry.valid(ChildEntity) || !Registry.all_of<FResetGenomeComponent, FGenomeFloatViewComponent>(ChildEntity))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("BreedFloatGenomesSystem: missing FGenomeFloatViewComponent on child (reset index=%d)"), Index);
 			continue;
 		}
 
+		// Resolve parent genome views
+
 		TOptional<TArrayView<const float>> MaybeA;
 		TOptional<TArrayView<const float>> MaybeB;
 
@@ -127,7 +132,7 @@ void UBreedFloatGenomesSystem::Update_Implementation(float /*DeltaTime*/)
 
 		if (!MaybeA.IsSet() || !MaybeB.IsSet())
 		{
-			UE_LOG(LogTemp, Warning, TEXT("BreedFloatGenomesSystem: missing genome on parent(s) (reset index=%d)"), Index);
+			UE_LOG(LogTemp, Warning, TEXT("BreedFloatGenomesSystem: missing genome on parent(s) (plan entry %d)"), Index);
 			continue;
 		}
 
@@ -139,52 +144,30 @@ void UBreedFloatGenomesSystem::Update_Implementation(float /*DeltaTime*/)
 		const int32 GeneCount = FMath::Min3(AView.Num(), BView.Num(), CView.Num());
 		if (GeneCount <= 0)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("BreedFloatGenomesSystem: zero-length genome at reset index=%d"), Index);
+			UE_LOG(LogTemp, Warning, TEXT("BreedFloatGenomesSystem: zero-length genome at plan entry %d"), Index);
 			continue;
 		}
 
-		for (int32 g = 0; g < GeneCount; ++g)
-		{
-			const float a = AView[g];
-			const float b = BView[g];
-			const float rand01 = RngPtr ? RngPtr->FRand() : FMath::FRand();
-			float value;
-			if (rand01 < CrossoverProbability)
-			{
-				const float u = RngPtr ? RngPtr->FRand() : FMath::FRand();
-				const bool bFirst = (RngPtr ? (RngPtr->RandRange(0,1) == 0) : (FMath::RandRange(0,1) == 0));
-				value = SampleSbxChild(a, b, u, Eta, bFirst);
-			}
-			else
-			{
-				// Copy a gene from a random parent when no crossover
-				const bool bPickA = (RngPtr ? (RngPtr->RandRange(0,1) == 0) : (FMath::RandRange(0,1) == 0));
-				value = bPickA ? a : b;
-			}
-
-			if (bClampChildren)
-			{
-				value = FMath::Clamp(value, ClampMin, ClampMax);
-			}
-			CView[g] = value;
-		}
+		BreedGenome(AView, BView, CView, RngPtr);
 
 		// Reset child's fitness now that a new genome is installed
 		if (Registry.all_of<FFitnessComponent>(ChildEntity))
 		{
-			FFitnessComponent& Fit = Registry.get<FFitnessComponent>(ChildEntity);
-			if (Fit.Fitness.Num() == 0) { Fit.Fitness.SetNum(1, EAllowShrinking::No); }
-			for (int32 iFit = 0; iFit < Fit.Fitness.Num(); ++iFit) { Fit.Fitness[iFit] = 0.0f; }
+			Registry.patch<FFitnessComponent>(ChildEntity, [](FFitnessComponent& Fit)
+			{
+				if (Fit.Fitness.Num() == 0) { Fit.Fitness.SetNum(1, EAllowShrinking::No); }
+				for (int32 iFit = 0; iFit < Fit.Fitness.Num(); ++iFit) { Fit.Fitness[iFit] = 0.0f; }
+			});
 		}
 
-		// Assign a new unique ID since this is a new solution
-		if (Registry.all_of<FUniqueSolutionComponent>(ChildEntity))
+		// New solution: fresh id and generation, and its parents go into the lineage arena
+		if (bRecordLineage)
 		{
-			Registry.get<FUniqueSolutionComponent>(ChildEntity).Id = FUniqueSolutionComponent::GenerateNewId();
+			FLineageArena::RecordBirth(Registry, ChildEntity, ParentA, ParentB, Entry.Population);
 		}
 		else
 		{
-			Registry.emplace<FUniqueSolutionComponent>(ChildEntity).Id = FUniqueSolutionComponent::GenerateNewId();
+			Registry.get_or_emplace<FUniqueSolutionComponent>(ChildEntity).Id = FSolutionIdAllocator::Get(Registry).Allocate();
 		}
 	}
 }
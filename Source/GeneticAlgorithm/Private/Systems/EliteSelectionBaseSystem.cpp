@@ -1,6 +1,7 @@
 ﻿//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
 
 #include "Systems/EliteSelectionBaseSystem.h"
+#include "GAStepGate.h"
 
 UEliteSelectionBaseSystem::UEliteSelectionBaseSystem()
 {
@@ -11,5 +12,9 @@ UEliteSelectionBaseSystem::UEliteSelectionBaseSystem()
 
 void UEliteSelectionBaseSystem::Update_Implementation(float DeltaTime)
 {
+	if (!FGAStepGate::IsPopulationStep(GetRegistry()))
+	{
+		return;
+	}
 	ApplySelection();
 }
@@ -1,34 +1,46 @@
 ﻿#include "Systems/GACleanupSystem.h"
-#include "Components/BreedingPairComponent.h"
+#include "BreedingPlan.h"
 #include "Components/GenomeComponents.h"
+#include "GAStepGate.h"
+#include "Lineage/LineageArena.h"
+#include "Misc/Paths.h"
 
 void UGACleanupSystem::Update_Implementation(float /*DeltaTime*/)
 {
     auto& Registry = GetRegistry();
 
-    // 1) Destroy all entities that carry FBreedingPairComponent (transient link entities)
+    // Reset flags and eligibility set between steps must survive until the step consumes them
+    if (!FGAStepGate::IsPopulationStep(Registry))
     {
-        auto PairView = GetView<FBreedingPairComponent>();
-        for (auto Entity : PairView)
-        {
-            Registry.destroy(Entity);
-        }
+        return;
     }
 
+    // 1) Drop this step's breeding plan (capacity is kept for the next step)
+    FBreedingPlan::Get(Registry).Reset();
+
     // 2) Remove FResetGenomeComponent from all entities so user can re-apply them in the next cycle/generation.
     // Also remove FEligibleForBreedingTagComponent so it must be re-evaluated each cycle if needed.
+    // Both are cleared storage-wide in one call instead of per-entity removes.
+    Registry.clear<FResetGenomeComponent>();
+    Registry.clear<FEligibleForBreedingTagComponent>();
+
+    // 3) Bound lineage memory on long runs: append resident rows to disk, or keep only the newest ones
+    FLineageArena& Lineage = FLineageArena::Get(Registry);
+    if (Lineage.NumResident() > LineageMaxResidentRecords)
     {
-        auto ResetView = GetView<FResetGenomeComponent>();
-        for (auto Entity : ResetView)
+        if (LineageSpillFile.IsEmpty())
         {
-            // Safe to remove tag; entity continues to exist
-            Registry.remove<FResetGenomeComponent>(Entity);
+            Lineage.DiscardOldest(LineageMaxResidentRecords);
         }
-
-        auto EligibleView = GetView<FEligibleForBreedingTagComponent>();
-        for (auto Entity : EligibleView)
+        else
         {
-            Registry.remove<FEligibleForBreedingTagComponent>(Entity);
+            const FString Path = FPaths::IsRelative(LineageSpillFile)
+                ? FPaths::Combine(FPaths::ProjectSavedDir(), LineageSpillFile)
+                : LineageSpillFile;
+            if (!Lineage.SpillToFile(Path))
+            {
+                Lineage.DiscardOldest(LineageMaxResidentRecords);
+            }
         }
     }
 }
@@ -3,20 +3,26 @@
 #include "Systems/GADebugDataSystem.h"
 #include "Components/GenomeComponents.h"
 #include "Components/EliteComponents.h"
-#include "Components/BreedingPairComponent.h"
+#include "BreedingPlan.h"
+#include "GAStepGate.h"
+#include "PopulationIndex.h"
+#include "Statistics/StreamingStats.h"
 
 UGADebugDataSystem::UGADebugDataSystem()
 {
 	RegisterComponent<FGeneticAlgorithmDebugComponent>();
 	RegisterComponent<FFitnessComponent>();
 	RegisterComponent<FEliteTagComponent>();
-	RegisterComponent<FBreedingPairComponent>();
 	RegisterComponent<FResetGenomeComponent>();
 }
 
 void UGADebugDataSystem::Update_Implementation(float DeltaTime)
 {
 	auto& Registry = GetRegistry();
+	if (!FGAStepGate::IsPopulationStep(Registry))
+	{
+		return;
+	}
 	auto DebugView = GetView<FGeneticAlgorithmDebugComponent>();
 
 	if (DebugView.begin() == DebugView.end())
@@ -43,7 +49,7 @@ void UGADebugDataSystem::Update_Implementation(float DeltaTime)
 	// 2. Elite Info & Historical Fitness
 	auto EliteView = Registry.view<FEliteTagComponent, FFitnessComponent>();
 	float CurrentEliteTotalFitness = 0.0f;
-	DebugComp.PopulationTotalEliteFitness.Empty();
+	DebugComp.PopulationTotalEliteFitness.Reset();
 
 	if (EliteView.begin() != EliteView.end())
 	{
@@ -70,30 +76,25 @@ void UGADebugDataSystem::Update_Implementation(float DeltaTime)
 	}
 	
 	// Record historical elite fitness periodically
-	SampleTimer += DeltaTime;
+	SampleTimer += FGAStepGate::GetStepDeltaTime(Registry, DeltaTime);
 	if (SampleTimer >= SampleInterval)
 	{
 		SampleTimer = 0.0f;
 		
 		// Record Total
-		DebugComp.HistoricalTotalEliteFitness.Add(CurrentEliteTotalFitness);
-		if (DebugComp.HistoricalTotalEliteFitness.Num() > DebugComp.MaxHistoryLength)
-		{
-			DebugComp.HistoricalTotalEliteFitness.RemoveAt(0);
-		}
+		DebugComp.RecordEliteFitnessSample(CurrentEliteTotalFitness);
 	}
 
 	// 3. Breeding Pairs Info
-	auto BreedingView = GetView<FBreedingPairComponent>();
-	if (BreedingView.begin() != BreedingView.end())
+	const FBreedingPlan& Plan = FBreedingPlan::Get(Registry);
+	if (!Plan.IsEmpty())
 	{
 		DebugComp.BreedingPairsFitness.Reset();
 		int32 PairsAdded = 0;
-		for (auto E : BreedingView)
+		for (const FBreedingPlanEntry& Entry : Plan.GetEntries())
 		{
-			const auto& Breeding = BreedingView.get<FBreedingPairComponent>(E);
-			entt::entity ParentA = static_cast<entt::entity>(Breeding.ParentA);
-			entt::entity ParentB = static_cast<entt::entity>(Breeding.ParentB);
+			entt::entity ParentA = Entry.ParentA;
+			entt::entity ParentB = Entry.ParentB;
 
 			float FitA = 0.0f;
 			float FitB = 0.0f;
@@ -119,20 +120,96 @@ void UGADebugDataSystem::Update_Implementation(float DeltaTime)
 		}
 	}
 
-	// 4. All Solutions Fitness
-	auto PopView = Registry.view<FFitnessComponent>();
-	DebugComp.AllSolutionsFitness.Reset();
+	// 4. All Solutions Fitness (non-elite): one streaming pass per population from the population index.
+	// Per-population sketches are merged into the global one, so no value is copied or sorted.
+	const FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+	PopulationSketches.SetNum(Index.NumPopulations());
+	AllSolutionsSketch.Reset();
+	FStreamingStats AllStats;
+	for (int32 PopIdx = 0; PopIdx < Index.NumPopulations(); ++PopIdx)
+	{
+		FStreamingStats PopStats;
+		FQuantileSketch& PopSketch = PopulationSketches[PopIdx];
+		PopSketch.Reset();
+		if (Index.GetMembers(PopIdx).Num() == 0)
+		{
+			// Every member left this population: drop its summary instead of reporting the last one forever
+			DebugComp.PopulationStats.Remove(PopIdx);
+			continue;
+		}
+		for (const entt::entity E : Index.GetMembers(PopIdx))
+		{
+			if (Index.IsElite(E))
+			{
+				continue;
+			}
+			const auto& Fit = Registry.get<FFitnessComponent>(E);
+			const float Value = Fit.Fitness.IsValidIndex(PopIdx) ? Fit.Fitness[PopIdx] : 0.0f;
+			PopStats.Add(Value);
+			PopSketch.Add(Value);
+		}
+
+		AllStats.Merge(PopStats);
+		AllSolutionsSketch.Merge(PopSketch);
+		Summarize(PopStats, PopSketch, DebugComp.PopulationStats.FindOrAdd(PopIdx));
+	}
 
-	for (auto E : PopView)
+	for (auto It = DebugComp.PopulationStats.CreateIterator(); It; ++It)
 	{
-		const auto& Fit = PopView.get<FFitnessComponent>(E);
-		const int32 PopIdx = Fit.BuiltForFitnessIndex;
-		float CurrentFit = (PopIdx >= 0 && PopIdx < Fit.Fitness.Num()) ? Fit.Fitness[PopIdx] : 0.0f;
-		
-		if (!Registry.any_of<FEliteTagComponent>(E))
+		if (It.Key() < 0 || It.Key() >= Index.NumPopulations())
 		{
-			DebugComp.AllSolutionsFitness.Add(CurrentFit);
+			It.RemoveCurrent();
 		}
 	}
-	DebugComp.AllSolutionsFitness.Sort(TGreater<float>());
+
+	// Solutions without a valid population index have always been reported as 0
+	const int32 NumUnassigned = Index.NumUnassignedNonElites();
+	for (int32 i = 0; i < NumUnassigned; ++i)
+	{
+		AllStats.Add(0.0);
+	}
+	AllSolutionsSketch.Add(0.0, NumUnassigned);
+
+	Summarize(AllStats, AllSolutionsSketch, DebugComp.AllSolutionsStats);
+}
+
+void UGADebugDataSystem::Summarize(const FStreamingStats& Stats, const FQuantileSketch& Sketch, FFitnessDistributionSummary& Out) const
+{
+	Out.Count = static_cast<int32>(Stats.GetCount());
+	Out.Min = static_cast<float>(Stats.GetMin());
+	Out.Max = static_cast<float>(Stats.GetMax());
+	Out.Mean = static_cast<float>(Stats.GetMean());
+	Out.StdDev = static_cast<float>(Stats.GetStdDev());
+
+	Out.Quantiles.SetNumUninitialized(ReportedQuantiles.Num(), EAllowShrinking::No);
+	for (int32 i = 0; i < ReportedQuantiles.Num(); ++i)
+	{
+		Out.Quantiles[i] = static_cast<float>(Sketch.Quantile(ReportedQuantiles[i]));
+	}
+
+	// Equal-width bins over [Min, Max]; bin counts come from CDF differences at the bin edges.
+	// Cumulative counts are rounded instead of each bin, so the rounding remainder is spread over the bins and
+	// they add up to Count.
+	const int32 NumBins = FMath::Max(0, NumHistogramBins);
+	Out.Histogram.SetNumZeroed(NumBins, EAllowShrinking::No);
+	if (NumBins == 0 || Sketch.IsEmpty())
+	{
+		return;
+	}
+	const double Lo = Sketch.GetMin();
+	const double Hi = Sketch.GetMax();
+	if (Hi <= Lo)
+	{
+		Out.Histogram[0] = Out.Count;
+		return;
+	}
+	int32 PrevCount = 0;
+	for (int32 Bin = 0; Bin < NumBins; ++Bin)
+	{
+		const int32 UpperCount = (Bin == NumBins - 1)
+			? Out.Count
+			: FMath::Clamp(FMath::RoundToInt32(Sketch.Cdf(Lo + (Hi - Lo) * static_cast<double>(Bin + 1) / NumBins) * Out.Count), PrevCount, Out.Count);
+		Out.Histogram[Bin] = UpperCount - PrevCount;
+		PrevCount = UpperCount;
+	}
 }
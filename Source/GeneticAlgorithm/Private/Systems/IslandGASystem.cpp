@@ -0,0 +1,249 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/IslandGASystem.h"
+#include "Systems/BreedFloatGenomesSystem.h"
+#include "Systems/MutationFloatGenomeSystem.h"
+#include "Components/GenomeComponents.h"
+#include "BreedingPlan.h"
+#include "GAStepGate.h"
+#include "PopulationIndex.h"
+#include "Lineage/LineageArena.h"
+#include "Async/ParallelFor.h"
+
+bool UIslandGASystem::IsBetter(const FCandidate& A, const FCandidate& B) const
+{
+	if (bElitesAlwaysWin && A.bIsElite != B.bIsElite)
+	{
+		return A.bIsElite;
+	}
+	return bHigherIsBetter ? A.Fitness > B.Fitness : A.Fitness < B.Fitness;
+}
+
+FLineageParent UIslandGASystem::ToLineageParent(const FCandidate& Candidate)
+{
+	FLineageParent Parent;
+	Parent.Id = Candidate.SolutionId;
+	Parent.Generation = Candidate.Generation;
+	Parent.Fitness = Candidate.Fitness;
+	Parent.bHasFitness = true;
+	return Parent;
+}
+
+int32 UIslandGASystem::RunTournament(FIsland& Island) const
+{
+	const int32 Size = Island.Candidates.Num();
+	const int32 K = FMath::Clamp(TournamentSize, 1, Size);
+	int32 Best = INDEX_NONE;
+	int32 Second = INDEX_NONE;
+	for (int32 i = 0; i < K; ++i)
+	{
+		const int32 Pick = Island.Rng.RandRange(0, Size - 1);
+		if (Best == INDEX_NONE || IsBetter(Island.Candidates[Pick], Island.Candidates[Best]))
+		{
+			Second = Best;
+			Best = Pick;
+		}
+		else if (Second == INDEX_NONE || IsBetter(Island.Candidates[Pick], Island.Candidates[Second]))
+		{
+			Second = Pick;
+		}
+	}
+	if (Second == INDEX_NONE || (bElitesAlwaysWin && Island.Candidates[Best].bIsElite))
+	{
+		return Best;
+	}
+	return (SelectionPressure >= 1.0f || Island.Rng.FRand() <= SelectionPressure) ? Best : Second;
+}
+
+void UIslandGASystem::RunIsland(FIsland& Island, int32 IslandIndex, bool bMigrate)
+{
+	if (Island.Candidates.Num() == 0)
+	{
+		return; // nothing to breed from; children stay unbred and the sync phase skips them
+	}
+
+	for (FChild& Child : Island.Children)
+	{
+		Child.ParentA = RunTournament(Island);
+		Child.ParentB = RunTournament(Island);
+		Breeder->BreedGenome(Island.Candidates[Child.ParentA].Genome, Island.Candidates[Child.ParentB].Genome, Child.Genome, &Island.Rng);
+		Mutator->MutateGenome(Child.Genome, &Island.Rng);
+		Child.bBred = true;
+	}
+
+	if (!bMigrate || MigrantsPerIsland <= 0)
+	{
+		return;
+	}
+
+	// Emigrate copies of the best residents (migrants that arrived here are not forwarded again)
+	Island.Scratch.Reset();
+	for (int32 i = 0; i < Island.Candidates.Num(); ++i)
+	{
+		if (!Island.Candidates[i].bIsMigrant)
+		{
+			Island.Scratch.Add(i);
+		}
+	}
+	const int32 Count = FMath::Min(MigrantsPerIsland, Island.Scratch.Num());
+	Island.Scratch.Sort([this, &Island](int32 L, int32 R)
+	{
+		return bHigherIsBetter ? Island.Candidates[L].Fitness > Island.Candidates[R].Fitness
+		                       : Island.Candidates[L].Fitness < Island.Candidates[R].Fitness;
+	});
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FCandidate& Source = Island.Candidates[Island.Scratch[i]];
+		FMigrant Migrant;
+		Migrant.SourceIsland = IslandIndex;
+		Migrant.Entity = Source.Entity;
+		Migrant.SolutionId = Source.SolutionId;
+		Migrant.Generation = Source.Generation;
+		Migrant.Fitness = Source.Fitness;
+		Migrant.Genome = TArray<float>(Source.Genome.GetData(), Source.Genome.Num());
+		Outbox.Enqueue(MoveTemp(Migrant));
+	}
+}
+
+void UIslandGASystem::Update_Implementation(float /*DeltaTime*/)
+{
+	auto& Registry = GetRegistry();
+	if (!FGAStepGate::IsPopulationStep(Registry))
+	{
+		return;
+	}
+	auto ResetView = GetView<FFitnessComponent, FResetGenomeComponent, FGenomeFloatViewComponent>();
+	if (ResetView.begin() == ResetView.end())
+	{
+		return;
+	}
+	if (!Breeder || !Mutator)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("IslandGASystem: Breeder and Mutator must be set; skipping GA step."));
+		return;
+	}
+
+	const FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+	const int32 NumIslands = Index.NumPopulations();
+	if (NumIslands == 0)
+	{
+		return;
+	}
+
+	// Islands keep their RNG streams across updates; new islands get a stream derived from the base seed
+	const int32 BaseSeed = (RandomSeed != 0 || ContextSeed != 0) ? RandomSeed + ContextSeed : FMath::Rand();
+	for (int32 i = Islands.Num(); i < NumIslands; ++i)
+	{
+		Islands.AddDefaulted_GetRef().Rng.Initialize(static_cast<int32>(HashCombine(static_cast<uint32>(BaseSeed), static_cast<uint32>(i))));
+	}
+
+	// 1) Gather per-island candidates and children; migrants received last step join as candidates
+	for (int32 IslandIdx = 0; IslandIdx < NumIslands; ++IslandIdx)
+	{
+		FIsland& Island = Islands[IslandIdx];
+		Island.Candidates.Reset();
+		Island.Children.Reset();
+		auto AddCandidate = [&Registry, &Island, IslandIdx](entt::entity Entity, bool bIsElite)
+		{
+			if (Registry.any_of<FResetGenomeComponent>(Entity) || !Registry.all_of<FGenomeFloatViewComponent>(Entity))
+			{
+				return;
+			}
+			const FFitnessComponent& Fit = Registry.get<FFitnessComponent>(Entity);
+			if (!Fit.Fitness.IsValidIndex(IslandIdx))
+			{
+				return;
+			}
+			const FUniqueSolutionComponent* Unique = Registry.try_get<FUniqueSolutionComponent>(Entity);
+			FCandidate& Candidate = Island.Candidates.AddDefaulted_GetRef();
+			Candidate.Entity = Entity;
+			Candidate.SolutionId = Unique ? Unique->Id : 0;
+			Candidate.Generation = Unique ? Unique->Generation : -1;
+			Candidate.Fitness = Fit.Fitness[IslandIdx];
+			Candidate.bIsElite = bIsElite;
+			Candidate.Genome = Registry.get<FGenomeFloatViewComponent>(Entity).Values;
+		};
+		for (const entt::entity Entity : Index.GetEligible(IslandIdx))
+		{
+			AddCandidate(Entity, Index.IsElite(Entity));
+		}
+		for (const entt::entity Entity : Index.GetElites(IslandIdx))
+		{
+			if (!Index.IsEligible(Entity))
+			{
+				AddCandidate(Entity, true);
+			}
+		}
+		for (const FMigrant& Migrant : Island.Inbox)
+		{
+			// Migrant genomes are owned by the inbox, so they stay valid even if the source entity was re-bred;
+			// the entity is only kept as a parent reference while it still holds the same solution.
+			// Lineage uses the migrant's own id either way
+			const FUniqueSolutionComponent* Unique = Registry.valid(Migrant.Entity) ? Registry.try_get<FUniqueSolutionComponent>(Migrant.Entity) : nullptr;
+			FCandidate& Candidate = Island.Candidates.AddDefaulted_GetRef();
+			Candidate.Entity = (Unique && Unique->Id == Migrant.SolutionId) ? Migrant.Entity : entt::null;
+			Candidate.SolutionId = Migrant.SolutionId;
+			Candidate.Generation = Migrant.Generation;
+			Candidate.Fitness = Migrant.Fitness;
+			Candidate.bIsMigrant = true;
+			Candidate.Genome = Migrant.Genome;
+		}
+	}
+	for (const entt::entity Entity : ResetView)
+	{
+		const int32 IslandIdx = Registry.get<FFitnessComponent>(Entity).BuiltForFitnessIndex;
+		if (IslandIdx < 0 || IslandIdx >= NumIslands)
+		{
+			continue;
+		}
+		FChild& Child = Islands[IslandIdx].Children.AddDefaulted_GetRef();
+		Child.Entity = Entity;
+		Child.Genome = Registry.get<FGenomeFloatViewComponent>(Entity).Values;
+	}
+
+	// 2) Islands run independently: each task touches only its island and the child genomes it owns
+	++StepCount;
+	const bool bMigrate = NumIslands > 1 && MigrationInterval > 0 && (StepCount % MigrationInterval) == 0;
+	ParallelFor(NumIslands, [this, bMigrate](int32 IslandIdx)
+	{
+		RunIsland(Islands[IslandIdx], IslandIdx, bMigrate);
+	});
+
+	// 3) Sync point: registry writes, breeding plan (for debug/lineage consumers) and migrant delivery
+	FBreedingPlan& Plan = FBreedingPlan::Get(Registry);
+	for (int32 IslandIdx = 0; IslandIdx < NumIslands; ++IslandIdx)
+	{
+		const FIsland& Island = Islands[IslandIdx];
+		for (const FChild& Child : Island.Children)
+		{
+			if (!Child.bBred)
+			{
+				continue;
+			}
+			const FCandidate& ParentA = Island.Candidates[Child.ParentA];
+			const FCandidate& ParentB = Island.Candidates[Child.ParentB];
+			Plan.Add(Child.Entity, ParentA.Entity, ParentB.Entity, IslandIdx);
+			Registry.patch<FFitnessComponent>(Child.Entity, [](FFitnessComponent& Fit)
+			{
+				if (Fit.Fitness.Num() == 0) { Fit.Fitness.SetNum(1, EAllowShrinking::No); }
+				for (int32 iFit = 0; iFit < Fit.Fitness.Num(); ++iFit) { Fit.Fitness[iFit] = 0.0f; }
+			});
+			if (Breeder->bRecordLineage)
+			{
+				FLineageArena::RecordBirth(Registry, Child.Entity, ToLineageParent(ParentA), ToLineageParent(ParentB));
+			}
+			else
+			{
+				Registry.get_or_emplace<FUniqueSolutionComponent>(Child.Entity).Id = FSolutionIdAllocator::Get(Registry).Allocate();
+			}
+		}
+		Islands[IslandIdx].Inbox.Reset();
+	}
+
+	FMigrant Migrant;
+	while (Outbox.Dequeue(Migrant))
+	{
+		const int32 Destination = (Migrant.SourceIsland + 1) % NumIslands;
+		Islands[Destination].Inbox.Add(MoveTemp(Migrant));
+	}
+}
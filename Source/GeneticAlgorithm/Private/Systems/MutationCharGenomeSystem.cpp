@@ -3,11 +3,16 @@
 #include "Systems/MutationCharGenomeSystem.h"
 
 #include "Components/GenomeComponents.h"
+#include "GAStepGate.h"
 #include "Math/UnrealMathUtility.h"
 
 void UMutationCharGenomeSystem::Update_Implementation(float /*DeltaTime*/)
 {
     auto& Registry = GetRegistry();
+    if (!FGAStepGate::IsPopulationStep(Registry))
+    {
+        return;
+    }
 
     // Iterate directly over entities with a char genome view
     auto View = GetView<FGenomeCharViewComponent, FResetGenomeComponent>();
@@ -16,14 +21,14 @@ void UMutationCharGenomeSystem::Update_Implementation(float /*DeltaTime*/)
         return;
     }
 
-    // RNG policy: seed once and advance across updates if RandomSeed != 0
-    if (!bRngSeeded && RandomSeed != 0)
+    // RNG policy: seed once and advance across updates; RandomSeed == 0 draws the seed from the engine RNG
+    if (!bRngSeeded)
     {
-        Rng.Initialize(RandomSeed);
+        Rng.Seed(RandomSeed != 0
+            ? static_cast<uint64>(RandomSeed)
+            : (static_cast<uint64>(FMath::Rand()) << 32) ^ FPlatformTime::Cycles64());
         bRngSeeded = true;
-        bUseStream = true;
     }
-    FRandomStream* RngPtr = bUseStream ? &Rng : nullptr;
 
     // Sanitize probability
     const float P = FMath::Clamp(BitFlipProbability, 0.0f, 1.0f);
@@ -32,9 +37,10 @@ void UMutationCharGenomeSystem::Update_Implementation(float /*DeltaTime*/)
         return; // nothing to do
     }
 
-    // Precompute ln(1 - p) for geometric skipping; handle p = 1 separately
+    // p = 1 flips everything; high rates build word masks; low rates skip geometrically (needs ln(1 - p))
     const bool bFlipAll = (P >= 1.0f - KINDA_SMALL_NUMBER);
-    const float Log1mP = bFlipAll ? 0.0f : FMath::Loge(1.0f - P);
+    const bool bUseMasks = !bFlipAll && P >= MaskMutationThreshold;
+    const double Log1mP = (bFlipAll || bUseMasks) ? 0.0 : FMath::Loge(1.0 - static_cast<double>(P));
 
     for (auto It = View.begin(), End = View.end(); It != End; ++It)
     {
@@ -48,7 +54,6 @@ void UMutationCharGenomeSystem::Update_Implementation(float /*DeltaTime*/)
         }
 
         uint8* const Bytes = reinterpret_cast<uint8*>(ValuesChar.GetData());
-        const int64 TotalBits = static_cast<int64>(NumBytes) * 8;
 
         if (bFlipAll)
         {
@@ -57,26 +62,14 @@ void UMutationCharGenomeSystem::Update_Implementation(float /*DeltaTime*/)
             {
                 Bytes[i] ^= 0xFFu;
             }
-            continue;
         }
-
-        // Geometric skipping over bit indices
-        int64 BitIndex = -1; // Start before 0 so first increment lands on first candidate
-        while (true)
+        else if (bUseMasks)
         {
-            // Sample U in (0,1]; avoid 0 to keep log defined. Use a tiny lower bound.
-            const float U = RngPtr ? FMath::Max(1e-12f, RngPtr->FRand()) : FMath::Max(1e-12f, FMath::FRand());
-            const double Skip = FMath::FloorToDouble(FMath::Loge(U) / Log1mP);
-            BitIndex += static_cast<int64>(Skip) + 1;
-            if (BitIndex >= TotalBits)
-            {
-                break;
-            }
-
-            const int64 ByteIndex = BitIndex >> 3;      // divide by 8
-            const int32 BitInByte = static_cast<int32>(BitIndex & 7); // mod 8
-            const uint8 Mask = static_cast<uint8>(1u << BitInByte);
-            Bytes[ByteIndex] ^= Mask;
+            BitGenomeOps::MaskMutate(Bytes, NumBytes, Rng, P, MaskPrecisionBits);
+        }
+        else
+        {
+            BitGenomeOps::SkipMutate(Bytes, NumBytes, Rng, Log1mP);
         }
     }
 }
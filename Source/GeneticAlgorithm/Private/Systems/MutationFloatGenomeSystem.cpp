@@ -3,12 +3,19 @@
 #include "Systems/MutationFloatGenomeSystem.h"
 #include "Math/UnrealMathUtility.h"
 #include "Components/GenomeComponents.h"
+#include "GAStepGate.h"
 #include "Containers/Set.h"
 
 void UMutationFloatGenomeSystem::Update_Implementation(float /*DeltaTime*/)
 {
 	auto& Registry = GetRegistry();
 
+	// Flagged vehicles wait for the step; mutating them on every firing would compound the mutation
+	if (!FGAStepGate::IsPopulationStep(Registry))
+	{
+		return;
+	}
+
 	// Iterate directly over entities with a float genome view
 	auto View = GetView<FGenomeFloatViewComponent, FResetGenomeComponent>();
 	if (View.begin() == View.end())
@@ -25,6 +32,20 @@ void UMutationFloatGenomeSystem::Update_Implementation(float /*DeltaTime*/)
 	}
 	FRandomStream* RngPtr = bUseStream ? &Rng : nullptr;
 
+	for (auto It = View.begin(), End = View.end(); It != End; ++It)
+	{
+		MutateGenome(Registry.get<FGenomeFloatViewComponent>(*It).Values, RngPtr);
+	}
+}
+
+void UMutationFloatGenomeSystem::MutateGenome(TArrayView<float> Values, FRandomStream* RngPtr) const
+{
+	const int32 Count = Values.Num();
+	if (Count <= 0)
+	{
+		return;
+	}
+
 	// Sanitize parameters
 	const float DeltaPct = FMath::Max(0.0f, PerValueDeltaPercent);
 	const float ResetFracMax = FMath::Clamp(RandomResetMaxPercent, 0.0f, 1.0f);
@@ -35,57 +56,45 @@ void UMutationFloatGenomeSystem::Update_Implementation(float /*DeltaTime*/)
 		Swap(ResetMin, ResetMax);
 	}
 
-	for (auto It = View.begin(), End = View.end(); It != End; ++It)
+	// 1) Per-value multiplicative noise: v *= (1 + u), with u in [-DeltaPct, +DeltaPct]
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const float u01 = RngPtr ? RngPtr->FRand() : FMath::FRand();
+		const float u = (u01 * 2.0f - 1.0f) * DeltaPct; // uniform in [-DeltaPct, +DeltaPct]
+		Values[i] *= (1.0f + u);
+	}
+
+	// 2) Roll for random mutation
+	const float roll = RngPtr ? RngPtr->FRand() : FMath::FRand();
+	if (roll <= RandomMutationChance)
 	{
-		const entt::entity Entity = *It;
-		FGenomeFloatViewComponent& ViewComp = Registry.get<FGenomeFloatViewComponent>(Entity);
-		TArrayView<float> Values = ViewComp.Values;
-		const int32 Count = Values.Num();
-		if (Count <= 0)
+		// 3) Determine how many unique weights to reset
+		const float kUpperF = ResetFracMax * static_cast<float>(Count);
+		const int32 kUpper = FMath::FloorToInt(kUpperF);
+		int32 K;
+		if (kUpper <= 0)
 		{
-			continue;
+			K = 1; // min 1 weight no matter what
 		}
-
-		// 1) Per-value multiplicative noise: v *= (1 + u), with u in [-DeltaPct, +DeltaPct]
-		for (int32 i = 0; i < Count; ++i)
+		else
 		{
-			const float u01 = RngPtr ? RngPtr->FRand() : FMath::FRand();
-			const float u = (u01 * 2.0f - 1.0f) * DeltaPct; // uniform in [-DeltaPct, +DeltaPct]
-			Values[i] *= (1.0f + u);
+			const int32 r = RngPtr ? RngPtr->RandRange(0, kUpper) : FMath::RandRange(0, kUpper);
+			K = FMath::Clamp(r, 1, Count);
 		}
 
-		// 2) Roll for random mutation
-		const float roll = RngPtr ? RngPtr->FRand() : FMath::FRand();
-		if (roll <= RandomMutationChance)
+		// Sample K unique indices and reset them to U[ResetMin, ResetMax]
+		TSet<int32> Picked;
+		Picked.Reserve(K);
+		while (Picked.Num() < K)
 		{
-			// 3) Determine how many unique weights to reset
-			const float kUpperF = ResetFracMax * static_cast<float>(Count);
-			const int32 kUpper = FMath::FloorToInt(kUpperF);
-			int32 K;
-			if (kUpper <= 0)
-			{
-				K = 1; // min 1 weight no matter what
-			}
-			else
-			{
-				const int32 r = RngPtr ? RngPtr->RandRange(0, kUpper) : FMath::RandRange(0, kUpper);
-				K = FMath::Clamp(r, 1, Count);
-			}
-
-			// Sample K unique indices and reset them to U[ResetMin, ResetMax]
-			TSet<int32> Picked;
-			Picked.Reserve(K);
-			while (Picked.Num() < K)
+			const int32 idx = RngPtr ? RngPtr->RandRange(0, Count - 1) : FMath::RandRange(0, Count - 1);
+			if (Picked.Contains(idx))
 			{
-				const int32 idx = RngPtr ? RngPtr->RandRange(0, Count - 1) : FMath::RandRange(0, Count - 1);
-				if (Picked.Contains(idx))
-				{
-					continue; // already present
-				}
-				Picked.Add(idx);
-				const float v01 = RngPtr ? RngPtr->FRand() : FMath::FRand();
-				Values[idx] = FMath::Lerp(ResetMin, ResetMax, v01);
+				continue; // already present
 			}
+			Picked.Add(idx);
+			const float v01 = RngPtr ? RngPtr->FRand() : FMath::FRand();
+			Values[idx] = FMath::Lerp(ResetMin, ResetMax, v01);
 		}
 	}
 }
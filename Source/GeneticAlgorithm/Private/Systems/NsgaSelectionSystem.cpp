@@ -0,0 +1,130 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/NsgaSelectionSystem.h"
+#include "Components/GenomeComponents.h"
+#include "BreedingPlan.h"
+#include "GAStepGate.h"
+#include "PopulationIndex.h"
+#include "Math/UnrealMathUtility.h"
+
+int32 UNsgaSelectionSystem::PickParent(FRandomStream* RngStream) const
+{
+	const int32 Size = Candidates.Num();
+	const int32 A = RngStream ? RngStream->RandRange(0, Size - 1) : FMath::RandRange(0, Size - 1);
+	const int32 B = RngStream ? RngStream->RandRange(0, Size - 1) : FMath::RandRange(0, Size - 1);
+	if (Ranks[A] != Ranks[B])
+	{
+		return Ranks[A] < Ranks[B] ? A : B;
+	}
+	if (Crowding[A] != Crowding[B])
+	{
+		return Crowding[A] > Crowding[B] ? A : B;
+	}
+	return (RngStream ? RngStream->RandRange(0, 1) : FMath::RandRange(0, 1)) == 0 ? A : B;
+}
+
+void UNsgaSelectionSystem::Update_Implementation(float /*DeltaTime*/)
+{
+	auto& Registry = GetRegistry();
+	if (!FGAStepGate::IsPopulationStep(Registry))
+	{
+		return;
+	}
+	auto EntityResetView = GetView<FFitnessComponent, FResetGenomeComponent>();
+	if (EntityResetView.size_hint() == 0)
+	{
+		return;
+	}
+
+	const FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+	const int32 NumObjectives = ObjectiveIndices.Num() > 0 ? ObjectiveIndices.Num() : Index.NumPopulations();
+	if (NumObjectives <= 0)
+	{
+		return;
+	}
+	int32 RequiredSlots = NumObjectives;
+	for (const int32 Slot : ObjectiveIndices)
+	{
+		if (Slot < 0)
+		{
+			if (!bHasLoggedInvalidObjective)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("NsgaSelectionSystem: ObjectiveIndices contains negative slot %d; selection is skipped."), Slot);
+				bHasLoggedInvalidObjective = true;
+			}
+			Candidates.Reset();
+			Ranks.Reset();
+			Crowding.Reset();
+			return;
+		}
+		RequiredSlots = FMath::Max(RequiredSlots, Slot + 1);
+	}
+
+	// Candidates: eligible or elite, not being reset, with a genome and every objective slot present
+	Candidates.Reset();
+	auto AddCandidate = [this, &Registry, RequiredSlots](entt::entity Entity)
+	{
+		if (Registry.any_of<FResetGenomeComponent>(Entity)
+			|| !Registry.any_of<FGenomeFloatViewComponent, FGenomeCharViewComponent>(Entity)
+			|| Registry.get<FFitnessComponent>(Entity).Fitness.Num() < RequiredSlots)
+		{
+			return;
+		}
+		Candidates.Add(Entity);
+	};
+	for (int32 Pop = 0; Pop < Index.NumPopulations(); ++Pop)
+	{
+		for (const entt::entity Entity : Index.GetEligible(Pop))
+		{
+			AddCandidate(Entity);
+		}
+		for (const entt::entity Entity : Index.GetElites(Pop))
+		{
+			if (!Index.IsEligible(Entity))
+			{
+				AddCandidate(Entity);
+			}
+		}
+	}
+	const int32 N = Candidates.Num();
+	if (N == 0)
+	{
+		return;
+	}
+
+	// Column-major objectives, negated when higher is better so the sorter always minimizes.
+	// Non-finite values are treated as the worst possible score.
+	Objectives.SetNumUninitialized(N * NumObjectives, EAllowShrinking::No);
+	const float Sign = bHigherIsBetter ? -1.0f : 1.0f;
+	for (int32 Obj = 0; Obj < NumObjectives; ++Obj)
+	{
+		const int32 Slot = ObjectiveIndices.Num() > 0 ? ObjectiveIndices[Obj] : Obj;
+		float* Column = Objectives.GetData() + Obj * N;
+		for (int32 i = 0; i < N; ++i)
+		{
+			const float Value = Registry.get<FFitnessComponent>(Candidates[i]).Fitness[Slot];
+			Column[i] = FMath::IsFinite(Value) ? Sign * Value : TNumericLimits<float>::Max();
+		}
+	}
+
+	Sorter.Sort(Objectives, N, NumObjectives, Ranks);
+	Sorter.ComputeCrowding(Objectives, N, NumObjectives, Crowding);
+
+	// RNG: seed once and advance across updates if RandomSeed != 0 or ContextSeed != 0
+	if (!bRngSeeded && (RandomSeed != 0 || ContextSeed != 0))
+	{
+		Rng.Initialize(RandomSeed + ContextSeed);
+		bRngSeeded = true;
+		bUseStream = true;
+	}
+	FRandomStream* RngPtr = bUseStream ? &Rng : nullptr;
+
+	FBreedingPlan& Plan = FBreedingPlan::Get(Registry);
+	Plan.Reserve(Plan.Num() + static_cast<int32>(EntityResetView.size_hint()));
+	for (auto& Target : EntityResetView)
+	{
+		const int32 ParentA = PickParent(RngPtr);
+		const int32 ParentB = PickParent(RngPtr);
+		Plan.Add(Target, Candidates[ParentA], Candidates[ParentB], Registry.get<FFitnessComponent>(Target).BuiltForFitnessIndex);
+	}
+}
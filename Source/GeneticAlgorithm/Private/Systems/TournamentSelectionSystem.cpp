@@ -3,9 +3,20 @@
 #include "Systems/TournamentSelectionSystem.h"
 #include "Components/GenomeComponents.h"
 #include "Components/EliteComponents.h"
-#include "Components/BreedingPairComponent.h"
+#include "BreedingPlan.h"
+#include "GAStepGate.h"
+#include "PopulationIndex.h"
 #include "Math/UnrealMathUtility.h"
 
+bool UTournamentSelectionSystem::IsBetter(const FEntityRefFitness& A, const FEntityRefFitness& B) const
+{
+	if (A.Value != B.Value)
+	{
+		return bHigherIsBetter ? A.Value > B.Value : A.Value < B.Value;
+	}
+	return A.Order < B.Order;
+}
+
 entt::entity UTournamentSelectionSystem::RunTournament(const TArray<FEntityRefFitness>& Bucket, FRandomStream* RngStream)
 {
 	const int32 Size = Bucket.Num();
@@ -17,9 +28,9 @@ entt::entity UTournamentSelectionSystem::RunTournament(const TArray<FEntityRefFi
 
 	// Sample K indices into ScratchIndices
 	ScratchIndices.Reset();
+	ScratchIndices.Reserve(K);
 	if (bWithReplacement)
 	{
-		ScratchIndices.Reserve(K);
 		for (int32 i = 0; i < K; ++i)
 		{
 			const int32 Pick = (RngStream ? RngStream->RandRange(0, Size - 1) : FMath::RandRange(0, Size - 1));
@@ -28,46 +39,27 @@ entt::entity UTournamentSelectionSystem::RunTournament(const TArray<FEntityRefFi
 	}
 	else
 	{
-		// Reservoir-like shuffle for unique picks when K << Size
-		ScratchIndices.Reserve(Size);
-		for (int32 i = 0; i < Size; ++i) { ScratchIndices.Add(i); }
-		// Partial Fisher-Yates up to K
-		for (int32 i = 0; i < K; ++i)
+		// Floyd's algorithm: K unique picks with exactly K draws, independent of bucket size.
+		// The membership test is linear in K, which is a handful of candidates in practice.
+		for (int32 j = Size - K; j < Size; ++j)
 		{
-			const int32 SwapIdx = i + (RngStream ? RngStream->RandRange(0, Size - 1 - i) : FMath::RandRange(0, Size - 1 - i));
-			ScratchIndices.Swap(i, SwapIdx);
+			const int32 Pick = (RngStream ? RngStream->RandRange(0, j) : FMath::RandRange(0, j));
+			ScratchIndices.Add(ScratchIndices.Contains(Pick) ? j : Pick);
 		}
-		ScratchIndices.SetNum(K, EAllowShrinking::No);
 	}
 
 	// Find best and second best in sampled candidates
 	int32 Best = INDEX_NONE;
 	int32 Second = INDEX_NONE;
-	auto Better = [this, &Bucket](int32 A, int32 B)
-	{
-		if (A == INDEX_NONE) return false;
-		if (B == INDEX_NONE) return true;
-		const float VA = Bucket[A].Value;
-		const float VB = Bucket[B].Value;
-		if (bHigherIsBetter)
-		{
-			if (VA != VB) return VA > VB;
-		}
-		else
-		{
-			if (VA != VB) return VA < VB;
-		}
-		return Bucket[A].Order < Bucket[B].Order;
-	};
 	for (int32 i = 0; i < ScratchIndices.Num(); ++i)
 	{
 		const int32 idx = ScratchIndices[i];
-		if (Best == INDEX_NONE || Better(idx, Best))
+		if (Best == INDEX_NONE || IsBetter(Bucket[idx], Bucket[Best]))
 		{
 			Second = Best;
 			Best = idx;
 		}
-		else if (Second == INDEX_NONE || Better(idx, Second))
+		else if (Second == INDEX_NONE || IsBetter(Bucket[idx], Bucket[Second]))
 		{
 			Second = idx;
 		}
@@ -97,68 +89,133 @@ entt::entity UTournamentSelectionSystem::RunTournament(const TArray<FEntityRefFi
 	return WinnerIdx != INDEX_NONE ? Bucket[WinnerIdx].Entity : entt::null;
 }
 
+void UTournamentSelectionSystem::BuildAliasTable(const TArray<FEntityRefFitness>& Bucket, FAliasTable& OutTable)
+{
+	const int32 Size = Bucket.Num();
+	ScratchWeights.SetNumUninitialized(Size, EAllowShrinking::No);
+	if (Size == 0)
+	{
+		OutTable.Reset();
+		return;
+	}
+
+	if (SelectionMode == EParentSelectionMode::FitnessProportional)
+	{
+		// Shift by the worst value so the weights are non-negative for any sign and either direction
+		float Worst = Bucket[0].Value;
+		for (const FEntityRefFitness& E : Bucket)
+		{
+			Worst = bHigherIsBetter ? FMath::Min(Worst, E.Value) : FMath::Max(Worst, E.Value);
+		}
+		for (int32 i = 0; i < Size; ++i)
+		{
+			const double Gap = bHigherIsBetter ? (double)Bucket[i].Value - Worst : (double)Worst - Bucket[i].Value;
+			ScratchWeights[i] = Gap + ProportionalWeightFloor;
+		}
+		OutTable.Build(ScratchWeights);
+		return;
+	}
+
+	// Rank modes: sort indices best-first, then assign weights by rank
+	ScratchIndices.Reset();
+	for (int32 i = 0; i < Size; ++i) { ScratchIndices.Add(i); }
+	ScratchIndices.Sort([this, &Bucket](int32 A, int32 B)
+	{
+		if (bElitesAlwaysWin && Bucket[A].bIsElite != Bucket[B].bIsElite)
+		{
+			return Bucket[A].bIsElite;
+		}
+		return IsBetter(Bucket[A], Bucket[B]);
+	});
+
+	if (SelectionMode == EParentSelectionMode::LinearRank)
+	{
+		// Baker's linear ranking: best gets Pressure, worst gets 2 - Pressure (up to normalization)
+		const double S = FMath::Clamp((double)LinearRankPressure, 1.0, 2.0);
+		const double Denom = Size > 1 ? (double)(Size - 1) : 1.0;
+		for (int32 Rank = 0; Rank < Size; ++Rank)
+		{
+			ScratchWeights[ScratchIndices[Rank]] = S - (2.0 * S - 2.0) * (double)Rank / Denom;
+		}
+	}
+	else
+	{
+		const double C = FMath::Clamp((double)ExponentialRankBase, 0.01, 1.0);
+		double W = 1.0;
+		for (int32 Rank = 0; Rank < Size; ++Rank)
+		{
+			ScratchWeights[ScratchIndices[Rank]] = W;
+			W *= C;
+		}
+	}
+	OutTable.Build(ScratchWeights);
+}
+
+entt::entity UTournamentSelectionSystem::PickParent(const TArray<FEntityRefFitness>& Bucket, const FAliasTable& Table, FRandomStream* RngStream)
+{
+	if (SelectionMode == EParentSelectionMode::Tournament)
+	{
+		return RunTournament(Bucket, RngStream);
+	}
+	const int32 Idx = Table.Sample(RngStream);
+	return Bucket.IsValidIndex(Idx) ? Bucket[Idx].Entity : entt::null;
+}
+
 void UTournamentSelectionSystem::Update_Implementation(float /*DeltaTime*/)
 {
 	auto& Registry = GetRegistry();
+	if (!FGAStepGate::IsPopulationStep(Registry))
+	{
+		return;
+	}
 	auto EntityResetView = GetView<FFitnessComponent, FResetGenomeComponent>();
 	if (EntityResetView.size_hint() == 0)
 	{
 		return;
 	}
 	
-	// Stream all candidates and bucket them by BuiltForFitnessIndex (and globally)
+	// Bucket candidates by population (and globally) straight from the population index.
+	// Candidates are eligible or elite, not flagged for reset, and own a float genome.
+	const FPopulationIndex& Index = FPopulationIndex::Get(Registry);
 	GroupBuckets.Reset();
+	GroupBuckets.SetNum(Index.NumPopulations());
 	GlobalBucket.Reset();
 	int32 Order = 0;
+	auto AddCandidate = [this, &Registry, &Order](entt::entity Entity, int32 Group, bool bIsElite)
 	{
-		// Build a view that excludes entities with FResetGenomeComponent, as they cannot be selected for breeding.
-		// We only select from entities that have either FEligibleForBreedingTagComponent OR FEliteTagComponent.
-		auto PopView = Registry.view<FFitnessComponent>(entt::exclude_t<FResetGenomeComponent>{});
-		for (auto Entity : PopView)
+		// Skip placeholder elites created before any candidates exist
+		if (Registry.any_of<FResetGenomeComponent>(Entity) || !Registry.all_of<FGenomeFloatViewComponent>(Entity))
 		{
-			// Check eligibility: must have FEligibleForBreedingTagComponent OR FEliteTagComponent
-			if (!Registry.any_of<FEligibleForBreedingTagComponent, FEliteTagComponent>(Entity))
-			{
-				continue;
-			}
-
-			// Must have a genome to contribute; skip placeholder elites created before any candidates exist
-			if (!Registry.all_of<FGenomeFloatViewComponent>(Entity))
-			{
-				continue;
-			}
-
-			const FFitnessComponent& Fit = Registry.get<FFitnessComponent>(Entity);
-			const int32 Dims = Fit.Fitness.Num();
-			if (Dims <= 0) { ++Order; continue; }
-			if (GroupBuckets.Num() < Dims) { GroupBuckets.SetNum(Dims); }
-
-			// Check if this entity is an elite
-			const bool bIsElite = Registry.any_of<FEliteTagComponent>(Entity);
+			return;
+		}
+		// Values are read from the component so in-place fitness writes are always honored
+		const FFitnessComponent& Fit = Registry.get<FFitnessComponent>(Entity);
+		if (!Fit.Fitness.IsValidIndex(Group))
+		{
+			return;
+		}
 
-			// Push to each group bucket according to its own index? We group by entity's BuiltForFitnessIndex
-			const int32 Group = Fit.BuiltForFitnessIndex;
-			if (Group >= 0 && Group < Dims)
-			{
-				TArray<FEntityRefFitness>& Bucket = GroupBuckets[Group];
-				FEntityRefFitness& E = Bucket.Emplace_GetRef();
-				E.Value = Fit.Fitness[Group];
-				E.Order = Order;
-				E.bIsElite = bIsElite;
-				E.Entity = Entity;
-			}
-			// Also push to global using the same representative value when valid; otherwise skip global
-			if (Group >= 0 && Group < Dims)
+		FEntityRefFitness Ref;
+		Ref.Value = Fit.Fitness[Group];
+		Ref.Order = Order++;
+		Ref.bIsElite = bIsElite;
+		Ref.Entity = Entity;
+		GroupBuckets[Group].Add(Ref);
+		GlobalBucket.Add(Ref);
+	};
+	for (int32 Group = 0; Group < Index.NumPopulations(); ++Group)
+	{
+		for (const entt::entity Entity : Index.GetEligible(Group))
+		{
+			AddCandidate(Entity, Group, Index.IsElite(Entity));
+		}
+		for (const entt::entity Entity : Index.GetElites(Group))
+		{
+			if (!Index.IsEligible(Entity))
 			{
-				FEntityRefFitness& G = GlobalBucket.Emplace_GetRef();
-				G.Value = Fit.Fitness[Group];
-				G.Order = Order;
-				G.bIsElite = bIsElite;
-				G.Entity = Entity;
+				AddCandidate(Entity, Group, true);
 			}
-			++Order;
 		}
-
 	}
 
 	// RNG: seed once and advance across updates if RandomSeed != 0 or ContextSeed != 0
@@ -170,6 +227,21 @@ void UTournamentSelectionSystem::Update_Implementation(float /*DeltaTime*/)
 	}
 	FRandomStream* RngPtr = bUseStream ? &Rng : nullptr;
 
+	// Non-tournament modes: build one alias table per bucket, then every parent draw is O(1)
+	if (SelectionMode != EParentSelectionMode::Tournament)
+	{
+		GroupTables.SetNum(GroupBuckets.Num());
+		for (int32 Group = 0; Group < GroupBuckets.Num(); ++Group)
+		{
+			BuildAliasTable(GroupBuckets[Group], GroupTables[Group]);
+		}
+		BuildAliasTable(GlobalBucket, GlobalTable);
+	}
+
+	// Parents are appended to the flat breeding plan consumed in order by the breeders
+	FBreedingPlan& Plan = FBreedingPlan::Get(Registry);
+	Plan.Reserve(Plan.Num() + static_cast<int32>(EntityResetView.size_hint()));
+
 	// For each reset target, pick two parents according to group preference and cross-group chance
 	for (auto& Target : EntityResetView)
 	{
@@ -188,19 +260,16 @@ void UTournamentSelectionSystem::Update_Implementation(float /*DeltaTime*/)
 		for (int ParentIdx = 0; ParentIdx < 2; ++ParentIdx)
 		{
 			const bool bUseGlobal = bHasGlobal && ((RngPtr ? RngPtr->FRand() : FMath::FRand()) < CrossGroupParentChance);
-			const TArray<FEntityRefFitness>& Bucket = (bUseGlobal || !Preferred) ? GlobalBucket : *Preferred;
-			Parents[ParentIdx] = RunTournament(Bucket, RngPtr);
+			const bool bFromGlobal = bUseGlobal || !Preferred;
+			const TArray<FEntityRefFitness>& Bucket = bFromGlobal ? GlobalBucket : *Preferred;
+			const FAliasTable& Table = bFromGlobal || !GroupTables.IsValidIndex(Group) ? GlobalTable : GroupTables[Group];
+			Parents[ParentIdx] = PickParent(Bucket, Table, RngPtr);
 		}
 
-		// If we have two valid parents, create a child and emit a linkage entity with FParentsChildComponent
+		// If we have two valid parents, schedule the child in the breeding plan
 		if (Parents[0] != entt::null && Parents[1] != entt::null)
 		{
-			const entt::entity LinkEntity = Registry.create();
-			FBreedingPairComponent Link{};
-			Link.ParentA = static_cast<uint32>(Parents[0]);
-			Link.ParentB = static_cast<uint32>(Parents[1]);
-			Link.ChildEntity = static_cast<uint32>(Target);
-			Registry.emplace<FBreedingPairComponent>(LinkEntity, Link);
+			Plan.Add(Target, Parents[0], Parents[1], Group);
 		}
 		else
 		{
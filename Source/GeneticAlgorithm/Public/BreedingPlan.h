@@ -0,0 +1,62 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// GeneticAlgorithm module (within SimpleML): flat per-tick breeding plan
+// Why: Selection used to create one registry entity per child just to carry its parents, and breeders
+// rebuilt a child->pair map every tick to find them. The plan is a preallocated array written by
+// selection and consumed in order by breeding: no entity churn, no hashing, no pointer chasing.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+
+/** One scheduled reproduction: write a child genome into Child from ParentA x ParentB. */
+struct FBreedingPlanEntry
+{
+	entt::entity Child = entt::null;
+	entt::entity ParentA = entt::null;
+	entt::entity ParentB = entt::null;
+	// Population (fitness dimension) the child is bred for; INDEX_NONE when unknown
+	int32 Population = INDEX_NONE;
+};
+
+/**
+ * Breeding plan resource stored in the registry context; use FBreedingPlan::Get(Registry).
+ *
+ * Lifecycle per GA step: selection appends entries -> breeders iterate them in order ->
+ * UGACleanupSystem resets the plan (capacity is kept, so steady-state ticks do not allocate).
+ */
+class FBreedingPlan
+{
+public:
+	/** Returns the registry's plan, creating an empty one on first use. */
+	static FBreedingPlan& Get(entt::registry& Registry)
+	{
+		if (FBreedingPlan* Existing = Registry.ctx().find<FBreedingPlan>())
+		{
+			return *Existing;
+		}
+		return Registry.ctx().emplace<FBreedingPlan>();
+	}
+
+	/** Drops all entries, keeping capacity for at least ExpectedNum. */
+	void Reset(int32 ExpectedNum = 0)
+	{
+		Entries.Reset(ExpectedNum);
+	}
+
+	void Reserve(int32 Num)
+	{
+		Entries.Reserve(Num);
+	}
+
+	void Add(entt::entity Child, entt::entity ParentA, entt::entity ParentB, int32 Population = INDEX_NONE)
+	{
+		Entries.Add(FBreedingPlanEntry{ Child, ParentA, ParentB, Population });
+	}
+
+	TConstArrayView<FBreedingPlanEntry> GetEntries() const { return Entries; }
+	int32 Num() const { return Entries.Num(); }
+	bool IsEmpty() const { return Entries.Num() == 0; }
+
+private:
+	TArray<FBreedingPlanEntry> Entries;
+};
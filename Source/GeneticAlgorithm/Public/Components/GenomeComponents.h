@@ -6,6 +6,8 @@
 #include "CoreMinimal.h"
 #include "Containers/Array.h"
 #include "Containers/ArrayView.h"
+#include "Statistics/FixedRingBuffer.h"
+#include "Lineage/SolutionIdAllocator.h"
 #include <atomic>
 #include "GenomeComponents.generated.h"
 
@@ -51,10 +53,15 @@ struct GENETICALGORITHM_API FUniqueSolutionComponent
 	UPROPERTY(VisibleAnywhere, Category = "GeneticAlgorithm")
 	int64 SourceId = 0;
 
+	// Number of breeding steps from the initial population (max parent generation + 1).
+	UPROPERTY(VisibleAnywhere, Category = "GeneticAlgorithm")
+	int32 Generation = 0;
+
+	// Process-wide unique id without a clock read. Prefer FSolutionIdAllocator::Get(Registry).Allocate()
+	// where a registry is at hand; it amortizes the atomic over a whole block.
 	static int64 GenerateNewId()
 	{
-		static std::atomic<int64> Counter{0};
-		return (FDateTime::UtcNow().GetTicks() & ~0xFFFFFFLL) | (++Counter & 0xFFFFFF);
+		return FSolutionIdAllocator::ReserveBlock(1).Next;
 	}
 };
 
@@ -130,6 +137,37 @@ struct GENETICALGORITHM_API FElitePromotionDebugComponent
 	FString SourceLabel;
 };
 
+/**
+ * Summary of a fitness distribution produced from streaming statistics and a quantile sketch.
+ * Quantiles follow UGADebugDataSystem::ReportedQuantiles; Histogram has equal-width bins over [Min, Max].
+ */
+USTRUCT(BlueprintType)
+struct GENETICALGORITHM_API FFitnessDistributionSummary
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GeneticAlgorithm|Debug")
+	int32 Count = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GeneticAlgorithm|Debug")
+	float Min = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GeneticAlgorithm|Debug")
+	float Max = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GeneticAlgorithm|Debug")
+	float Mean = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GeneticAlgorithm|Debug")
+	float StdDev = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GeneticAlgorithm|Debug")
+	TArray<float> Quantiles;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GeneticAlgorithm|Debug")
+	TArray<int32> Histogram;
+};
+
 USTRUCT(BlueprintType)
 struct GENETICALGORITHM_API FGeneticAlgorithmDebugComponent
 {
@@ -144,8 +182,13 @@ struct GENETICALGORITHM_API FGeneticAlgorithmDebugComponent
 	UPROPERTY(EditAnywhere, Category = "GeneticAlgorithm|Debug")
 	TArray<float> BreedingPairsFitness; // Flattened [ParentA_Fit, ParentB_Fit, ...]
 
+	// Distribution of all non-elite fitness values (populations merged)
 	UPROPERTY(EditAnywhere, Category = "GeneticAlgorithm|Debug")
-	TArray<float> AllSolutionsFitness;
+	FFitnessDistributionSummary AllSolutionsStats;
+
+	// Distribution of non-elite fitness values per population index
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Debug")
+	TMap<int32, FFitnessDistributionSummary> PopulationStats;
 
 	UPROPERTY(EditAnywhere, Category = "GeneticAlgorithm|Debug")
 	int32 ResetCount = 0;
@@ -158,4 +201,15 @@ struct GENETICALGORITHM_API FGeneticAlgorithmDebugComponent
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Debug")
 	int32 MaxHistoryLength = 50;
+
+	// Source of truth for HistoricalTotalEliteFitness (not reflected)
+	TFixedRingBuffer<float> EliteFitnessHistory;
+
+	/** Appends a history sample to the ring (no shifting) and refreshes the chronological HistoricalTotalEliteFitness copy for UI. */
+	void RecordEliteFitnessSample(float TotalEliteFitness)
+	{
+		EliteFitnessHistory.SetCapacity(MaxHistoryLength);
+		EliteFitnessHistory.Add(TotalEliteFitness);
+		EliteFitnessHistory.CopyTo(HistoricalTotalEliteFitness);
+	}
 };
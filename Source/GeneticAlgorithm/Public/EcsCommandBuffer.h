@@ -0,0 +1,233 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// GeneticAlgorithm module (within SimpleML): deferred structural changes for ECS systems
+// Why: Emplacing/removing/destroying while iterating a view forces systems to stay single-threaded
+// and churns storages one entity at a time. Systems record changes here (from any thread) and play
+// them back at a sync point, sorted by entity and batched per component type.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/StableSort.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/UniquePtr.h"
+#include "entt/entt.hpp"
+#include <type_traits>
+
+/**
+ * Records create/destroy/emplace/remove/clear commands and applies them in one pass.
+ *
+ * Playback order:
+ * 1) Deferred creates (one batched registry create).
+ * 2) Per component type, in first-recorded order: Clear -> Remove -> Emplace.
+ *    Removals therefore never cancel an emplace recorded in the same buffer.
+ *    Emplaces are sorted by entity; the last value recorded for an entity wins; existing
+ *    components are replaced. Empty (tag) types are inserted as a single batch.
+ * 3) Destroys (sorted, de-duplicated, batched).
+ *
+ * Commands targeting entities that are no longer valid at playback are dropped.
+ * Recording is guarded by a lock; playback must run on the thread that owns the registry.
+ */
+class FEcsCommandBuffer
+{
+public:
+	/** Handle to an entity that will be created at playback. */
+	struct FDeferredEntity
+	{
+		int32 Index = INDEX_NONE;
+		bool IsValid() const { return Index != INDEX_NONE; }
+	};
+
+	FEcsCommandBuffer() = default;
+	FEcsCommandBuffer(const FEcsCommandBuffer&) = delete;
+	FEcsCommandBuffer& operator=(const FEcsCommandBuffer&) = delete;
+
+	FDeferredEntity Create()
+	{
+		FScopeLock ScopeLock(&Lock);
+		return FDeferredEntity{ NumDeferredCreates++ };
+	}
+
+	void Destroy(entt::entity Entity)
+	{
+		FScopeLock ScopeLock(&Lock);
+		Destroys.Add(Entity);
+	}
+
+	template<typename T, typename... ArgTypes>
+	void Emplace(entt::entity Entity, ArgTypes&&... Args)
+	{
+		FScopeLock ScopeLock(&Lock);
+		GetQueue<T>().Emplaces.Add({ Entity, INDEX_NONE, T{ Forward<ArgTypes>(Args)... } });
+	}
+
+	template<typename T, typename... ArgTypes>
+	void Emplace(FDeferredEntity Entity, ArgTypes&&... Args)
+	{
+		check(Entity.IsValid());
+		FScopeLock ScopeLock(&Lock);
+		GetQueue<T>().Emplaces.Add({ entt::null, Entity.Index, T{ Forward<ArgTypes>(Args)... } });
+	}
+
+	template<typename T>
+	void Remove(entt::entity Entity)
+	{
+		FScopeLock ScopeLock(&Lock);
+		GetQueue<T>().Removes.Add(Entity);
+	}
+
+	/** Removes T from every entity; played back as a single storage clear. */
+	template<typename T>
+	void Clear()
+	{
+		FScopeLock ScopeLock(&Lock);
+		GetQueue<T>().bClear = true;
+	}
+
+	bool IsEmpty() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return NumDeferredCreates == 0 && Destroys.Num() == 0 && !bHasTypedCommands;
+	}
+
+	/** Applies and discards all recorded commands. */
+	void Playback(entt::registry& Registry)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		Created.SetNumUninitialized(NumDeferredCreates, EAllowShrinking::No);
+		if (NumDeferredCreates > 0)
+		{
+			Registry.create(Created.GetData(), Created.GetData() + Created.Num());
+		}
+
+		for (const TUniquePtr<ITypedQueue>& Queue : Queues)
+		{
+			Queue->Playback(Registry, Created);
+		}
+
+		if (Destroys.Num() > 0)
+		{
+			SortUniqueValid(Registry, Destroys);
+			Registry.destroy(Destroys.GetData(), Destroys.GetData() + Destroys.Num());
+		}
+
+		NumDeferredCreates = 0;
+		Destroys.Reset();
+		Created.Reset();
+		bHasTypedCommands = false;
+	}
+
+private:
+	struct ITypedQueue
+	{
+		virtual ~ITypedQueue() = default;
+		virtual void Playback(entt::registry& Registry, TConstArrayView<entt::entity> CreatedEntities) = 0;
+	};
+
+	template<typename T>
+	struct TTypedQueue final : ITypedQueue
+	{
+		struct FEmplace
+		{
+			entt::entity Entity;
+			int32 Deferred;
+			T Value;
+		};
+
+		TArray<FEmplace> Emplaces;
+		TArray<entt::entity> Removes;
+		TArray<entt::entity> Scratch;
+		bool bClear = false;
+
+		virtual void Playback(entt::registry& Registry, TConstArrayView<entt::entity> CreatedEntities) override
+		{
+			if (bClear)
+			{
+				Registry.clear<T>();
+			}
+			else if (Removes.Num() > 0)
+			{
+				SortUniqueValid(Registry, Removes);
+				Registry.remove<T>(Removes.GetData(), Removes.GetData() + Removes.Num());
+			}
+
+			if (Emplaces.Num() > 0)
+			{
+				for (FEmplace& Cmd : Emplaces)
+				{
+					if (Cmd.Deferred != INDEX_NONE)
+					{
+						Cmd.Entity = CreatedEntities[Cmd.Deferred];
+					}
+				}
+				// Stable so that, per entity, recording order is kept and the last value wins
+				Algo::StableSortBy(Emplaces, [](const FEmplace& Cmd) { return entt::to_integral(Cmd.Entity); });
+
+				if constexpr (std::is_empty_v<T>)
+				{
+					Scratch.Reset();
+					for (const FEmplace& Cmd : Emplaces)
+					{
+						if (Registry.valid(Cmd.Entity) && !Registry.all_of<T>(Cmd.Entity) && (Scratch.Num() == 0 || Scratch.Last() != Cmd.Entity))
+						{
+							Scratch.Add(Cmd.Entity);
+						}
+					}
+					Registry.insert<T>(Scratch.GetData(), Scratch.GetData() + Scratch.Num());
+				}
+				else
+				{
+					for (int32 i = 0; i < Emplaces.Num(); ++i)
+					{
+						FEmplace& Cmd = Emplaces[i];
+						const bool bSuperseded = i + 1 < Emplaces.Num() && Emplaces[i + 1].Entity == Cmd.Entity;
+						if (!bSuperseded && Registry.valid(Cmd.Entity))
+						{
+							Registry.emplace_or_replace<T>(Cmd.Entity, MoveTemp(Cmd.Value));
+						}
+					}
+				}
+			}
+
+			Emplaces.Reset();
+			Removes.Reset();
+			bClear = false;
+		}
+	};
+
+	static void SortUniqueValid(const entt::registry& Registry, TArray<entt::entity>& Entities)
+	{
+		Entities.Sort([](entt::entity A, entt::entity B) { return entt::to_integral(A) < entt::to_integral(B); });
+		int32 Write = 0;
+		for (int32 Read = 0; Read < Entities.Num(); ++Read)
+		{
+			const entt::entity E = Entities[Read];
+			if (Registry.valid(E) && (Write == 0 || Entities[Write - 1] != E))
+			{
+				Entities[Write++] = E;
+			}
+		}
+		Entities.SetNum(Write, EAllowShrinking::No);
+	}
+
+	// Caller holds Lock
+	template<typename T>
+	TTypedQueue<T>& GetQueue()
+	{
+		bHasTypedCommands = true;
+		const uint32 TypeId = entt::type_hash<T>::value();
+		if (const int32* Existing = QueueByType.Find(TypeId))
+		{
+			return static_cast<TTypedQueue<T>&>(*Queues[*Existing]);
+		}
+		QueueByType.Add(TypeId, Queues.Num());
+		return static_cast<TTypedQueue<T>&>(*Queues.Add_GetRef(MakeUnique<TTypedQueue<T>>()));
+	}
+
+	mutable FCriticalSection Lock;
+	TArray<TUniquePtr<ITypedQueue>> Queues; // first-recorded order keeps playback deterministic
+	TMap<uint32, int32> QueueByType;
+	TArray<entt::entity> Destroys;
+	TArray<entt::entity> Created;
+	int32 NumDeferredCreates = 0;
+	bool bHasTypedCommands = false;
+};
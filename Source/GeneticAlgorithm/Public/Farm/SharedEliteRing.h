@@ -0,0 +1,98 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// GeneticAlgorithm module (within SimpleML): cross-process elite exchange over named shared memory
+// Why: Training farms run many game processes on one host. Elites are exchanged through a fixed-size
+// ring in shared memory (shm_open/mmap on Linux via FPlatformMemory) instead of sockets or files.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformMemory.h"
+
+/** One elite read from the ring. */
+struct FSharedEliteRecord
+{
+	int32 SourceProcess = INDEX_NONE;
+	int32 Population = INDEX_NONE;
+	int64 SolutionId = 0;
+	float Fitness = 0.0f;
+	TArray<float> Genome;
+};
+
+/** Progress one process publishes for the coordinator; plain data copied under a per-slot sequence lock. */
+struct FSharedFarmProgress
+{
+	int32 ProcessIndex = INDEX_NONE;
+	int32 NumContexts = 0;
+	float BestFitness = 0.0f;
+	float MeanEliteFitness = 0.0f;
+	int64 Births = 0;
+	int64 ElitesPublished = 0;
+	int64 ElitesInjected = 0;
+	double UptimeSeconds = 0.0;
+};
+
+/**
+ * Multi-producer, multi-consumer broadcast ring of elite genomes in named shared memory.
+ *
+ * Writers claim a slot with one atomic ticket increment and fill it under a per-slot sequence lock,
+ * so a reader never blocks a writer. Every reader keeps its own cursor; records older than NumSlots
+ * tickets are overwritten and silently skipped. A table of FSharedFarmProgress slots, one per process,
+ * lets the coordinator aggregate progress without any extra channel.
+ *
+ * The coordinator Create()s the region; workers Open() it with the same name and dimensions.
+ */
+class GENETICALGORITHM_API FSharedEliteRing
+{
+public:
+	static constexpr int32 MaxProcesses = 256;
+
+	/** Seconds a claimed but unfinished record may block readers before it is treated as abandoned by a crashed writer */
+	static constexpr double DefaultStaleRecordSeconds = 1.0;
+
+	FSharedEliteRing() = default;
+	~FSharedEliteRing();
+	FSharedEliteRing(const FSharedEliteRing&) = delete;
+	FSharedEliteRing& operator=(const FSharedEliteRing&) = delete;
+
+	/** Creates and initializes the region. Returns false if it cannot be mapped. */
+	bool Create(const FString& Name, int32 NumSlots, int32 MaxGenomeFloats);
+
+	/** Maps an existing region; fails if it was created with different dimensions. */
+	bool Open(const FString& Name, int32 NumSlots, int32 MaxGenomeFloats);
+
+	void Close();
+
+	bool IsValid() const { return Header != nullptr; }
+
+	/** Appends an elite; genomes longer than MaxGenomeFloats are rejected. Thread- and process-safe. */
+	bool Publish(int32 SourceProcess, int32 Population, int64 SolutionId, float Fitness, TConstArrayView<float> Genome);
+
+	/**
+	 * Reads up to MaxRecords records published by other processes since InOutCursor and advances it.
+	 * Start a reader at GetWriteCursor() to receive only new records.
+	 * A record still unfinished StaleRecordSeconds after a reader first waited on it is skipped (0 = wait until lapped).
+	 */
+	int32 Poll(int32 SelfProcess, uint64& InOutCursor, TArray<FSharedEliteRecord>& Out, int32 MaxRecords, double StaleRecordSeconds = DefaultStaleRecordSeconds);
+
+	uint64 GetWriteCursor() const;
+
+	void WriteProgress(int32 ProcessIndex, const FSharedFarmProgress& Progress);
+
+	/** Copies every progress slot that has been written at least once. */
+	void ReadProgress(TArray<FSharedFarmProgress>& Out) const;
+
+private:
+	struct FHeader;
+	struct FSlotHeader;
+
+	uint8* SlotAddress(uint64 Ticket) const;
+	bool Map(const FString& Name, bool bCreate, int32 NumSlots, int32 MaxGenomeFloats);
+
+	FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+	FHeader* Header = nullptr;
+	uint8* Slots = nullptr;
+	SIZE_T SlotStride = 0;
+
+	// Unfinished ticket Poll last stopped at, and when it was first seen (FPlatformTime::Seconds)
+	uint64 StalledTicket = MAX_uint64;
+	double StalledSince = 0.0;
+};
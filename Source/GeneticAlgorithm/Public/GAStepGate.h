@@ -0,0 +1,47 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// GeneticAlgorithm module (within SimpleML): once-per-step gate for population-level GA systems
+// Why: a host may evaluate its solutions over several firings of the GA chain (one slice per firing).
+// Elite selection, parent selection, mutation, cleanup and history sampling work on the whole population
+// and must still run once per step, not once per firing, or their histories fill and rescans repeat K times.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+
+/**
+ * Step gate resource stored in the registry context; the host writes it at the head of the GA chain.
+ *
+ * Population-level systems return early when IsPopulationStep is false. Breeders need no check: they consume
+ * the breeding plan, which only selection fills. Without the resource every firing is a step.
+ */
+struct FGAStepGate
+{
+	/** True when this firing of the GA chain completes a step */
+	bool bPopulationStep = true;
+
+	/** Time since the previous step; timers of gated systems advance by this instead of the firing's DeltaTime */
+	float StepDeltaTime = 0.0f;
+
+	/** Returns the registry's gate, creating an open one on first use. */
+	static FGAStepGate& Get(entt::registry& Registry)
+	{
+		if (FGAStepGate* Existing = Registry.ctx().find<FGAStepGate>())
+		{
+			return *Existing;
+		}
+		return Registry.ctx().emplace<FGAStepGate>();
+	}
+
+	static bool IsPopulationStep(const entt::registry& Registry)
+	{
+		const FGAStepGate* Gate = Registry.ctx().find<FGAStepGate>();
+		return !Gate || Gate->bPopulationStep;
+	}
+
+	/** Time since the previous step, or ChainDeltaTime when no host gates the chain. */
+	static float GetStepDeltaTime(const entt::registry& Registry, float ChainDeltaTime)
+	{
+		const FGAStepGate* Gate = Registry.ctx().find<FGAStepGate>();
+		return Gate ? Gate->StepDeltaTime : ChainDeltaTime;
+	}
+};
@@ -0,0 +1,179 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * SplitMix64 generator producing one 64-bit word per call.
+ * Why: FRandomStream yields 15-16 useful bits per draw, so building a 64-bit crossover or mutation mask
+ * took four draws. Masks for byte/bit genomes are drawn from this instead.
+ */
+struct FWordRandom
+{
+	void Seed(uint64 InSeed)
+	{
+		State = InSeed;
+	}
+
+	uint64 Next()
+	{
+		uint64 Z = (State += 0x9E3779B97F4A7C15ull);
+		Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+		return Z ^ (Z >> 31);
+	}
+
+	/** Uniform integer in [0, Bound). Bound must be > 0. */
+	uint32 Bounded(uint32 Bound)
+	{
+		return static_cast<uint32>(((Next() >> 32) * Bound) >> 32);
+	}
+
+	/** Uniform double in (0, 1]; never 0 so it is safe to take the log. */
+	double UnitOpenZero()
+	{
+		return static_cast<double>((Next() >> 11) + 1) * (1.0 / 9007199254740992.0);
+	}
+
+private:
+	uint64 State = 0x853C49E6748FEA9Bull;
+};
+
+/**
+ * Word-level crossover and mutation for byte/bit genomes (FGenomeCharViewComponent).
+ * Genomes are processed 8 bytes at a time through unaligned 64-bit loads; the trailing partial word
+ * goes through a zero-padded scratch word so every operator has a single code path.
+ */
+namespace BitGenomeOps
+{
+	inline uint64 LoadWord(const uint8* Src, int32 NumBytes = 8)
+	{
+		uint64 Word = 0;
+		FMemory::Memcpy(&Word, Src, NumBytes);
+		return Word;
+	}
+
+	inline void StoreWord(uint8* Dst, uint64 Word, int32 NumBytes = 8)
+	{
+		FMemory::Memcpy(Dst, &Word, NumBytes);
+	}
+
+	/** Expands the low 8 bits of Bits into a byte mask: bit i set -> byte i is 0xFF. */
+	inline uint64 SpreadBitsToBytes(uint32 Bits)
+	{
+		// Broadcast to every byte, keep bit i in byte i, then turn each non-zero byte into 0xFF
+		uint64 X = static_cast<uint64>(Bits & 0xFFu) * 0x0101010101010101ull;
+		X &= 0x8040201008040201ull;
+		const uint64 NonZeroHighBit = X | ((X & 0x7F7F7F7F7F7F7F7Full) + 0x7F7F7F7F7F7F7F7Full);
+		return ((NonZeroHighBit >> 7) & 0x0101010101010101ull) * 0xFFull;
+	}
+
+	/**
+	 * Uniform crossover: Child = (A & Mask) | (B & ~Mask) with a random Mask.
+	 * bPerBit = false picks whole bytes (genes) from either parent, 64 genes per RNG word;
+	 * bPerBit = true picks individual bits, one RNG word per 64 bits.
+	 */
+	inline void UniformCrossover(const uint8* A, const uint8* B, uint8* Child, int32 NumBytes, FWordRandom& Rng, bool bPerBit)
+	{
+		uint64 ByteBits = 0;
+		int32 ByteBitsLeft = 0;
+		for (int32 Offset = 0; Offset < NumBytes; Offset += 8)
+		{
+			const int32 Len = FMath::Min(8, NumBytes - Offset);
+			uint64 Mask;
+			if (bPerBit)
+			{
+				Mask = Rng.Next();
+			}
+			else
+			{
+				if (ByteBitsLeft == 0)
+				{
+					ByteBits = Rng.Next();
+					ByteBitsLeft = 8;
+				}
+				Mask = SpreadBitsToBytes(static_cast<uint32>(ByteBits));
+				ByteBits >>= 8;
+				--ByteBitsLeft;
+			}
+			const uint64 WordA = LoadWord(A + Offset, Len);
+			const uint64 WordB = LoadWord(B + Offset, Len);
+			StoreWord(Child + Offset, (WordA & Mask) | (WordB & ~Mask), Len);
+		}
+	}
+
+	/**
+	 * Segment crossover on gene (byte) boundaries: [0, CutA) and [CutB, NumBytes) come from A,
+	 * [CutA, CutB) from B. One-point crossover is CutB == NumBytes. Bulk copies only; no per-gene branch.
+	 */
+	inline void SegmentCrossover(const uint8* A, const uint8* B, uint8* Child, int32 NumBytes, int32 CutA, int32 CutB)
+	{
+		CutA = FMath::Clamp(CutA, 0, NumBytes);
+		CutB = FMath::Clamp(CutB, CutA, NumBytes);
+		FMemory::Memcpy(Child, A, CutA);
+		FMemory::Memcpy(Child + CutA, B + CutA, CutB - CutA);
+		FMemory::Memcpy(Child + CutB, A + CutB, NumBytes - CutB);
+	}
+
+	/**
+	 * Returns a word whose bits are independently set with probability Numerator / 2^PrecisionBits.
+	 * Built LSB-first from the binary expansion of the probability: a 1 digit ORs in a fresh random
+	 * word, a 0 digit ANDs one in, so each step halves and optionally adds 1/2 to the bit probability.
+	 */
+	inline uint64 BernoulliWord(FWordRandom& Rng, uint32 Numerator, int32 PrecisionBits)
+	{
+		if (Numerator == 0)
+		{
+			return 0;
+		}
+		if (Numerator >= (1u << PrecisionBits))
+		{
+			return ~0ull;
+		}
+		// Trailing zero digits would AND into an all-zero word; skip them
+		const int32 FirstDigit = static_cast<int32>(FMath::CountTrailingZeros(Numerator));
+		uint64 Mask = 0;
+		for (int32 Digit = FirstDigit; Digit < PrecisionBits; ++Digit)
+		{
+			const uint64 R = Rng.Next();
+			Mask = ((Numerator >> Digit) & 1u) ? (Mask | R) : (Mask & R);
+		}
+		return Mask;
+	}
+
+	/** Flips each bit with probability P (quantized to 1/2^PrecisionBits) by XOR-ing Bernoulli masks word by word. */
+	inline void MaskMutate(uint8* Bytes, int32 NumBytes, FWordRandom& Rng, float P, int32 PrecisionBits)
+	{
+		PrecisionBits = FMath::Clamp(PrecisionBits, 1, 16);
+		const uint32 Numerator = static_cast<uint32>(FMath::RoundToInt(FMath::Clamp(P, 0.0f, 1.0f) * static_cast<float>(1u << PrecisionBits)));
+		if (Numerator == 0)
+		{
+			return;
+		}
+		for (int32 Offset = 0; Offset < NumBytes; Offset += 8)
+		{
+			const int32 Len = FMath::Min(8, NumBytes - Offset);
+			StoreWord(Bytes + Offset, LoadWord(Bytes + Offset, Len) ^ BernoulliWord(Rng, Numerator, PrecisionBits), Len);
+		}
+	}
+
+	/**
+	 * Flips each bit with probability P by jumping geometrically between flip positions.
+	 * Cost is proportional to the number of flips, so it wins for low P. Log1mP = ln(1 - P), P in (0, 1).
+	 */
+	inline void SkipMutate(uint8* Bytes, int32 NumBytes, FWordRandom& Rng, double Log1mP)
+	{
+		const int64 TotalBits = static_cast<int64>(NumBytes) * 8;
+		int64 BitIndex = -1;
+		while (true)
+		{
+			BitIndex += static_cast<int64>(FMath::FloorToDouble(FMath::Loge(Rng.UnitOpenZero()) / Log1mP)) + 1;
+			if (BitIndex >= TotalBits)
+			{
+				break;
+			}
+			Bytes[BitIndex >> 3] ^= static_cast<uint8>(1u << (BitIndex & 7));
+		}
+	}
+}
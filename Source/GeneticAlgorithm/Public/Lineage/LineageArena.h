@@ -0,0 +1,91 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// GeneticAlgorithm module (within SimpleML): append-only genealogy storage
+// Why: Parent information used to vanish with the transient breeding-pair entities. Births are now
+// appended as packed 32-byte rows into fixed-size chunks (no per-entity heap cost, no reallocation
+// copies) and can be spilled to disk to bound memory on long runs.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/UniquePtr.h"
+#include "entt/entt.hpp"
+
+/** One birth. Plain old data; written to disk verbatim by FLineageArena::SpillToFile. */
+struct FLineageRecord
+{
+	int64 Id = 0;
+	int64 ParentA = 0;
+	int64 ParentB = 0;
+	int32 Generation = 0;
+	// Mean fitness of the two parents in the child's population at breeding time
+	float BirthFitness = 0.0f;
+};
+static_assert(sizeof(FLineageRecord) == 32, "FLineageRecord is spilled to disk verbatim; keep it packed");
+
+/** A parent as seen when it was selected; used when the parent entity may have been re-bred since. */
+struct FLineageParent
+{
+	int64 Id = 0;
+	int32 Generation = -1;
+	float Fitness = 0.0f;
+	bool bHasFitness = false;
+};
+
+/**
+ * Chunked, append-only lineage log stored in the registry context; use FLineageArena::Get(Registry).
+ * Append is guarded by a lock so parallel breeding workers may record births directly.
+ */
+class GENETICALGORITHM_API FLineageArena
+{
+public:
+	static constexpr int32 RecordsPerChunk = 4096;
+
+	/** Returns the registry's arena, creating it on first use. */
+	static FLineageArena& Get(entt::registry& Registry);
+
+	void Append(const FLineageRecord& Record);
+
+	/** Records resident in memory (not yet spilled). */
+	int32 NumResident() const;
+
+	/** Records ever appended, including spilled and discarded ones. */
+	int64 NumTotal() const;
+
+	/** Resident record at Index (0 = oldest resident). Game thread only. */
+	const FLineageRecord& operator[](int32 Index) const;
+
+	/**
+	 * Appends all resident records to Filename as raw FLineageRecord rows and frees them.
+	 * Returns false (and keeps the records) if the file cannot be written.
+	 */
+	bool SpillToFile(const FString& Filename);
+
+	/**
+	 * Without a spill file: drops the oldest whole chunks until at most MaxResident records (rounded up to a chunk)
+	 * remain. Dropped chunks are recycled for new births, so the arena acts as a ring of the newest records.
+	 */
+	void DiscardOldest(int32 MaxResident);
+
+	/** Frees all resident records. */
+	void Reset();
+
+	/**
+	 * Records a birth for Child (bred from ParentA x ParentB for Population): assigns a fresh id and
+	 * generation to the child's FUniqueSolutionComponent (emplacing it if missing) and appends the row.
+	 * Game thread only (touches the registry).
+	 */
+	static void RecordBirth(entt::registry& Registry, entt::entity Child, entt::entity ParentA, entt::entity ParentB, int32 Population);
+
+	/** Same as above with parents recorded by id, generation and fitness instead of read from their entities. */
+	static void RecordBirth(entt::registry& Registry, entt::entity Child, const FLineageParent& ParentA, const FLineageParent& ParentB);
+
+	/** Reads Parent's id, generation and fitness in Population; an invalid entity yields an empty parent (id 0). */
+	static FLineageParent ReadParent(const entt::registry& Registry, entt::entity Parent, int32 Population);
+
+private:
+	mutable FCriticalSection Lock;
+	TArray<TUniquePtr<FLineageRecord[]>> Chunks;
+	int32 Resident = 0;
+	int64 Spilled = 0;
+	int64 Discarded = 0;
+};
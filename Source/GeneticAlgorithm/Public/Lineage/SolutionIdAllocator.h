@@ -0,0 +1,57 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// GeneticAlgorithm module (within SimpleML): solution ID allocation without clock reads
+// Why: IDs used to mix FDateTime::UtcNow() with a global counter, costing a clock read per child.
+// IDs are now handed out in blocks from one process-wide atomic; each registry caches a block,
+// and parallel workers reserve their own blocks, so the hot path is a plain increment.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+
+/**
+ * Allocates FUniqueSolutionComponent ids.
+ *
+ * Id layout: [ origin (15 bits) | sequence (48 bits) ], always > 0 (0 means "no id").
+ * The origin lets separate processes that exchange solutions keep ids disjoint (see SetProcessOrigin).
+ *
+ * Allocate() draws from the registry's cached block and is meant for the thread that owns the registry.
+ * Workers breeding in parallel call ReserveBlock(N) once for their chunk and pop ids from it.
+ */
+class GENETICALGORITHM_API FSolutionIdAllocator
+{
+public:
+	/** Bits below the origin (see id layout above). */
+	static constexpr int32 SequenceBits = 48;
+
+	/** Half-open id range [Next, End). */
+	struct FIdBlock
+	{
+		int64 Next = 0;
+		int64 End = 0;
+
+		bool IsEmpty() const { return Next >= End; }
+		int32 Num() const { return static_cast<int32>(End - Next); }
+		int64 Pop() { check(!IsEmpty()); return Next++; }
+	};
+
+	/** Returns the registry's allocator, creating it on first use. */
+	static FSolutionIdAllocator& Get(entt::registry& Registry);
+
+	/** Reserves Count consecutive ids process-wide with a single atomic add. Thread-safe. */
+	static FIdBlock ReserveBlock(int32 Count);
+
+	/**
+	 * Sets the origin stamped into the high bits of ids reserved afterwards (0..32767).
+	 * Registry blocks cached under another origin are dropped by their next Allocate().
+	 */
+	static void SetProcessOrigin(int32 Origin);
+
+	/** Next id from this registry's cached block, reserving a new block when it runs out. */
+	int64 Allocate();
+
+	/** Ids reserved per refill of the cached block. */
+	int32 BlockSize = 1024;
+
+private:
+	FIdBlock Cached;
+};
@@ -0,0 +1,104 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// GeneticAlgorithm module (within SimpleML): incrementally maintained per-population index
+// Why: Several GA systems need "who is eligible/elite in population P" and "best/total fitness of P"
+// every tick. Rebuilding those from full registry scans is O(registry) per system per tick;
+// this index is kept current by EnTT signals and answers those queries without scanning.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+
+/**
+ * Per-population view over the registry, maintained via on_construct/on_update/on_destroy of
+ * FFitnessComponent, FEligibleForBreedingTagComponent and FEliteTagComponent.
+ *
+ * Population of an entity = FFitnessComponent::BuiltForFitnessIndex when it is a valid index into Fitness.
+ * Membership (members/eligible/elites) is always exact because tags only change through emplace/remove.
+ * Cached fitness values and the Max/Total aggregates follow on_update, so code that edits a
+ * FFitnessComponent in place must notify via Registry.patch<FFitnessComponent>(Entity).
+ *
+ * Lives in the registry context; use FPopulationIndex::Get(Registry).
+ */
+class GENETICALGORITHM_API FPopulationIndex
+{
+public:
+	/** Returns the registry's index, creating and back-filling it from existing components on first use. */
+	static FPopulationIndex& Get(entt::registry& Registry);
+
+	/** Disconnects the signals and removes the index from the registry context (no-op if absent). */
+	static void Release(entt::registry& Registry);
+
+	/** Number of population slots seen so far (highest population index + 1). */
+	int32 NumPopulations() const { return Populations.Num(); }
+
+	/** All entities with a valid fitness in population Pop (elites included). */
+	TConstArrayView<entt::entity> GetMembers(int32 Pop) const;
+
+	/** Entities in Pop tagged FEligibleForBreedingTagComponent. */
+	TConstArrayView<entt::entity> GetEligible(int32 Pop) const;
+
+	/** Entities in Pop tagged FEliteTagComponent. */
+	TConstArrayView<entt::entity> GetElites(int32 Pop) const;
+
+	/** Highest cached fitness in Pop, or -MAX_FLT if Pop has no members. */
+	float GetMaxFitness(int32 Pop) const;
+
+	/** Sum of cached fitness values in Pop. */
+	double GetTotalFitness(int32 Pop) const;
+
+	/** Non-elite entities with a fitness component but no valid population index. */
+	int32 NumUnassignedNonElites() const { return UnassignedNonElites; }
+
+	bool IsElite(entt::entity Entity) const;
+	bool IsEligible(entt::entity Entity) const;
+
+private:
+	struct FEntry
+	{
+		float Value = 0.0f;
+		int32 Pop = INDEX_NONE;
+		int32 MemberSlot = INDEX_NONE;
+		int32 EligibleSlot = INDEX_NONE;
+		int32 EliteSlot = INDEX_NONE;
+		bool bHasFitness = false;
+		bool bEligible = false;
+		bool bElite = false;
+	};
+
+	struct FPopulation
+	{
+		TArray<entt::entity> Members;
+		TArray<entt::entity> Eligible;
+		TArray<entt::entity> Elites;
+		double TotalFitness = 0.0;
+		float MaxFitness = -MAX_FLT;
+		entt::entity MaxHolder = entt::null;
+		bool bMaxDirty = false;
+	};
+
+	void Connect(entt::registry& Registry);
+	void Backfill(entt::registry& Registry);
+
+	// Signal handlers
+	void OnFitnessChanged(entt::registry& Registry, entt::entity Entity);
+	void OnFitnessDestroyed(entt::registry& Registry, entt::entity Entity);
+	void OnEligibleConstructed(entt::registry& Registry, entt::entity Entity);
+	void OnEligibleDestroyed(entt::registry& Registry, entt::entity Entity);
+	void OnEliteConstructed(entt::registry& Registry, entt::entity Entity);
+	void OnEliteDestroyed(entt::registry& Registry, entt::entity Entity);
+
+	FEntry& GetEntry(entt::entity Entity);
+	const FEntry* FindEntry(entt::entity Entity) const;
+
+	// Every state change is Unlink(old state) -> mutate entry -> Link(new state)
+	void Link(entt::entity Entity, FEntry& Entry);
+	void Unlink(entt::entity Entity, FEntry& Entry);
+
+	static void AddToSet(TArray<entt::entity>& Set, entt::entity Entity, int32& OutSlot);
+	void RemoveFromSet(TArray<entt::entity>& Set, int32& InOutSlot, int32 FEntry::* SlotMember);
+
+	// Indexed by entt::to_entity(Entity); dense and cache-friendly since entity ids are recycled
+	TArray<FEntry> Entries;
+	mutable TArray<FPopulation> Populations;
+	int32 UnassignedNonElites = 0;
+};
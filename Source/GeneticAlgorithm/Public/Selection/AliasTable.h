@@ -0,0 +1,107 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+/**
+ * Walker/Vose alias table for sampling a discrete distribution.
+ * Why: Building is O(N) once per tick; every draw afterwards is O(1) (one index + one coin),
+ * so selecting many parents from the same bucket no longer scales with bucket size.
+ * Plain data; weights do not need to be normalized. Non-positive or non-finite weights are treated as zero.
+ */
+struct FAliasTable
+{
+	/** Builds the table from Weights. Falls back to a uniform distribution if all weights are zero. */
+	void Build(TConstArrayView<double> Weights)
+	{
+		const int32 N = Weights.Num();
+		Prob.SetNumUninitialized(N, EAllowShrinking::No);
+		Alias.SetNumUninitialized(N, EAllowShrinking::No);
+		if (N == 0)
+		{
+			return;
+		}
+
+		double Total = 0.0;
+		for (const double W : Weights)
+		{
+			Total += (FMath::IsFinite(W) && W > 0.0) ? W : 0.0;
+		}
+
+		if (Total <= 0.0)
+		{
+			for (int32 i = 0; i < N; ++i)
+			{
+				Prob[i] = 1.0f;
+				Alias[i] = i;
+			}
+			return;
+		}
+
+		// Scaled probabilities; mean is 1.0 so entries split into "small" (< 1) and "large" (>= 1)
+		Scaled.SetNumUninitialized(N, EAllowShrinking::No);
+		Small.Reset();
+		Large.Reset();
+		const double Scale = static_cast<double>(N) / Total;
+		for (int32 i = 0; i < N; ++i)
+		{
+			const double W = (FMath::IsFinite(Weights[i]) && Weights[i] > 0.0) ? Weights[i] : 0.0;
+			Scaled[i] = W * Scale;
+			(Scaled[i] < 1.0 ? Small : Large).Add(i);
+		}
+
+		while (Small.Num() > 0 && Large.Num() > 0)
+		{
+			const int32 S = Small.Pop(EAllowShrinking::No);
+			const int32 L = Large.Pop(EAllowShrinking::No);
+			Prob[S] = static_cast<float>(Scaled[S]);
+			Alias[S] = L;
+			Scaled[L] = (Scaled[L] + Scaled[S]) - 1.0;
+			(Scaled[L] < 1.0 ? Small : Large).Add(L);
+		}
+
+		// Leftovers are 1.0 up to rounding error
+		for (const int32 L : Large)
+		{
+			Prob[L] = 1.0f;
+			Alias[L] = L;
+		}
+		for (const int32 S : Small)
+		{
+			Prob[S] = 1.0f;
+			Alias[S] = S;
+		}
+	}
+
+	/** Draws an index in [0, Num()). Returns INDEX_NONE if the table is empty. */
+	int32 Sample(FRandomStream* RngStream) const
+	{
+		const int32 N = Prob.Num();
+		if (N == 0)
+		{
+			return INDEX_NONE;
+		}
+		const int32 Column = RngStream ? RngStream->RandRange(0, N - 1) : FMath::RandRange(0, N - 1);
+		const float Coin = RngStream ? RngStream->FRand() : FMath::FRand();
+		return Coin < Prob[Column] ? Column : Alias[Column];
+	}
+
+	int32 Num() const { return Prob.Num(); }
+
+	void Reset()
+	{
+		Prob.Reset();
+		Alias.Reset();
+	}
+
+private:
+	TArray<float> Prob;
+	TArray<int32> Alias;
+
+	// Build scratch, kept to avoid per-tick allocations
+	TArray<double> Scaled;
+	TArray<int32> Small;
+	TArray<int32> Large;
+};
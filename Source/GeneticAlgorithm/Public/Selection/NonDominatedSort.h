@@ -0,0 +1,81 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Pareto front ranking and crowding distance for multi-objective selection (NSGA-II).
+ * Why: The textbook fast non-dominated sort compares every pair of solutions (O(M N^2) time and
+ * O(N^2) domination lists). Solutions are visited in lexicographic order, so a solution can only be
+ * dominated by ones before it.
+ * - Two objectives: ENS-BS (efficient non-dominated sort with binary search). Each solution goes into
+ *   the first front whose last member does not dominate it, O(N log N).
+ * - Three or more: Jensen/Fortin divide-and-conquer. A solution's rank is one more than the highest rank
+ *   among its dominators; the lexicographic order is split in halves and the left half's ranks are pushed
+ *   into the right half by recursively splitting on the remaining objectives at their median,
+ *   O(N log^(M-1) N). Scanning whole fronts instead is O(M N^2) once fronts get large.
+ *
+ * Objectives are column-major (Objectives[Objective * NumSolutions + Solution]) and minimized;
+ * negate maximized objectives before sorting. Non-finite values should be replaced by the caller.
+ * Buffers are kept between calls so steady-state ticks do not allocate.
+ */
+class GENETICALGORITHM_API FNonDominatedSorter
+{
+public:
+	/** Ranks all solutions; OutRank[Solution] is the 0-based front. Returns the number of fronts. */
+	int32 Sort(TConstArrayView<float> Objectives, int32 NumSolutions, int32 NumObjectives, TArray<int32>& OutRank);
+
+	/** Members of Front (valid until the next Sort), in lexicographic objective order. */
+	TConstArrayView<int32> GetFront(int32 Front) const { return Fronts[Front]; }
+
+	int32 NumFronts() const { return ActiveFronts; }
+
+	/**
+	 * Crowding distance of every solution within its front (requires a prior Sort on the same data).
+	 * Boundary solutions of each objective, and fronts of two or fewer members, get TNumericLimits<float>::Max().
+	 */
+	void ComputeCrowding(TConstArrayView<float> Objectives, int32 NumSolutions, int32 NumObjectives, TArray<float>& OutCrowding);
+
+	/** True if A is no worse than B in every objective and better in at least one. */
+	static bool Dominates(const float* Objectives, int32 NumSolutions, int32 NumObjectives, int32 A, int32 B);
+
+private:
+	/** Side of the lexicographic split a point comes from while ranks are pushed across it. */
+	struct FSplitPoint
+	{
+		int32 Position = 0;
+		bool bLeft = false;
+	};
+
+	void SortTwoObjectives(const float* Objectives, int32 NumSolutions, int32 NumObjectives, TArray<int32>& OutRank);
+	void SortDivideAndConquer(const float* Objectives, int32 NumSolutions, int32 NumObjectives, TArray<int32>& OutRank);
+
+	/** Ranks the distinct points at lexicographic positions [Begin, End), given the ranks pushed in from before Begin. */
+	void RankRange(int32 Begin, int32 End);
+
+	/** Raises each right point's rank above every left point that is no worse in objectives [Objective, M). */
+	void PushRanks(TArrayView<FSplitPoint> Points, int32 Objective, int32 Depth);
+
+	float Value(int32 Objective, int32 Position) const
+	{
+		return SortData[static_cast<int64>(Objective) * SortNumSolutions + Distinct[Position]];
+	}
+	bool IsNoWorse(int32 A, int32 B, int32 FirstObjective) const;
+
+	// Reusable caches to avoid per-tick allocations
+	TArray<TArray<int32>> Fronts;
+	int32 ActiveFronts = 0;
+	TArray<int32> Order;
+	TArray<int32> Distinct;
+	TArray<int32> DistinctRank;
+	TArray<TArray<FSplitPoint>> SplitScratch;
+	TArray<int32> SortedMembers;
+	TArray<float> SortedValues;
+	TArray<float> Gaps;
+
+	// Input of the current divide-and-conquer sort
+	const float* SortData = nullptr;
+	int32 SortNumSolutions = 0;
+	int32 SortNumObjectives = 0;
+};
@@ -0,0 +1,85 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed-capacity FIFO history: once full, each Add overwrites the oldest sample in O(1).
+ * Why: Histories were trimmed with RemoveAt(0), shifting the whole array on every sample.
+ * Index 0 is the oldest sample; CopyTo linearizes in chronological order for UI consumers.
+ */
+template<typename T>
+class TFixedRingBuffer
+{
+public:
+	/** Changes the capacity, keeping the most recent samples that still fit. */
+	void SetCapacity(int32 NewCapacity)
+	{
+		NewCapacity = FMath::Max(0, NewCapacity);
+		if (NewCapacity == Data.Num())
+		{
+			return;
+		}
+
+		TArray<T> Kept;
+		const int32 Keep = FMath::Min(Count, NewCapacity);
+		Kept.Reserve(NewCapacity);
+		for (int32 i = Count - Keep; i < Count; ++i)
+		{
+			Kept.Add((*this)[i]);
+		}
+		Kept.SetNum(NewCapacity);
+		Data = MoveTemp(Kept);
+		Head = 0;
+		Count = Keep;
+	}
+
+	void Add(const T& Value)
+	{
+		if (Data.Num() == 0)
+		{
+			return;
+		}
+		if (Count < Data.Num())
+		{
+			Data[(Head + Count) % Data.Num()] = Value;
+			++Count;
+		}
+		else
+		{
+			Data[Head] = Value;
+			Head = (Head + 1) % Data.Num();
+		}
+	}
+
+	void Reset()
+	{
+		Head = 0;
+		Count = 0;
+	}
+
+	int32 Num() const { return Count; }
+	int32 Capacity() const { return Data.Num(); }
+	bool IsFull() const { return Count == Data.Num(); }
+
+	const T& operator[](int32 Index) const
+	{
+		check(Index >= 0 && Index < Count);
+		return Data[(Head + Index) % Data.Num()];
+	}
+
+	/** Writes the samples oldest-first into Out (reusing its allocation). */
+	void CopyTo(TArray<T>& Out) const
+	{
+		Out.Reset(Count);
+		const int32 FirstRun = FMath::Min(Count, Data.Num() - Head);
+		Out.Append(Data.GetData() + Head, FirstRun);
+		Out.Append(Data.GetData(), Count - FirstRun);
+	}
+
+private:
+	TArray<T> Data;
+	int32 Head = 0;
+	int32 Count = 0;
+};
@@ -0,0 +1,60 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Mergeable quantile sketch (merging t-digest, k1 scale function).
+ * Why: Percentiles and histograms of 10k+ fitness values without storing or fully sorting them.
+ * Memory is O(Compression); only the small insertion buffer is sorted when it fills up.
+ * Accuracy is best at the tails (q near 0 or 1), which is where GA fitness plots look.
+ */
+class GENETICALGORITHM_API FQuantileSketch
+{
+public:
+	explicit FQuantileSketch(double InCompression = 100.0);
+
+	void Reset();
+
+	/** Adds Value with the given weight (e.g. Weight = N for N identical samples). */
+	void Add(double Value, double Weight = 1.0);
+
+	/** Folds Other into this sketch; the result approximates the sketch of the union of both inputs. */
+	void Merge(const FQuantileSketch& Other);
+
+	/** Approximate value at quantile Q in [0, 1]; 0 if empty. */
+	double Quantile(double Q) const;
+
+	/** Approximate fraction of samples <= X, in [0, 1]; 0 if empty. */
+	double Cdf(double X) const;
+
+	double GetTotalWeight() const { return TotalWeight; }
+	double GetMin() const { return TotalWeight > 0.0 ? Min : 0.0; }
+	double GetMax() const { return TotalWeight > 0.0 ? Max : 0.0; }
+	bool IsEmpty() const { return TotalWeight <= 0.0; }
+
+	/** Number of centroids after compression (bounded by roughly Compression). */
+	int32 NumCentroids() const;
+
+private:
+	struct FCentroid
+	{
+		double Mean = 0.0;
+		double Weight = 0.0;
+	};
+
+	// Merges the insertion buffer into the centroid list
+	void Flush() const;
+
+	double Compression;
+	int32 BufferCapacity;
+	double TotalWeight = 0.0;
+	double Min = TNumericLimits<double>::Max();
+	double Max = TNumericLimits<double>::Lowest();
+
+	// Queries flush lazily, so the digest state is mutable
+	mutable TArray<FCentroid> Centroids;
+	mutable TArray<FCentroid> Buffer;
+	mutable TArray<FCentroid> Scratch;
+};
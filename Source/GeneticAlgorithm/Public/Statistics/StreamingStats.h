@@ -0,0 +1,64 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Single-pass count/min/max/mean/variance accumulator (Welford), mergeable (Chan et al.).
+ * Why: Debug statistics over large populations must not copy or sort the samples.
+ * Plain data; Merge makes per-population accumulators combinable into a global one.
+ */
+struct FStreamingStats
+{
+	void Reset()
+	{
+		*this = FStreamingStats();
+	}
+
+	void Add(double Value)
+	{
+		++Count;
+		const double Delta = Value - Mean;
+		Mean += Delta / static_cast<double>(Count);
+		M2 += Delta * (Value - Mean);
+		Min = FMath::Min(Min, Value);
+		Max = FMath::Max(Max, Value);
+	}
+
+	void Merge(const FStreamingStats& Other)
+	{
+		if (Other.Count == 0)
+		{
+			return;
+		}
+		if (Count == 0)
+		{
+			*this = Other;
+			return;
+		}
+		const double Total = static_cast<double>(Count + Other.Count);
+		const double Delta = Other.Mean - Mean;
+		Mean += Delta * static_cast<double>(Other.Count) / Total;
+		M2 += Other.M2 + Delta * Delta * static_cast<double>(Count) * static_cast<double>(Other.Count) / Total;
+		Count += Other.Count;
+		Min = FMath::Min(Min, Other.Min);
+		Max = FMath::Max(Max, Other.Max);
+	}
+
+	int64 GetCount() const { return Count; }
+	double GetMean() const { return Count > 0 ? Mean : 0.0; }
+	double GetMin() const { return Count > 0 ? Min : 0.0; }
+	double GetMax() const { return Count > 0 ? Max : 0.0; }
+
+	/** Population variance (divides by N). */
+	double GetVariance() const { return Count > 0 ? M2 / static_cast<double>(Count) : 0.0; }
+	double GetStdDev() const { return FMath::Sqrt(GetVariance()); }
+
+private:
+	int64 Count = 0;
+	double Mean = 0.0;
+	double M2 = 0.0;
+	double Min = TNumericLimits<double>::Max();
+	double Max = TNumericLimits<double>::Lowest();
+};
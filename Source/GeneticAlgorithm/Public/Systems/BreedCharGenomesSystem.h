@@ -4,20 +4,28 @@
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
 #include "Components/GenomeComponents.h"
-#include "Components/BreedingPairComponent.h"
+#include "Genome/BitGenomeOps.h"
 #include "BreedCharGenomesSystem.generated.h"
 
+UENUM(BlueprintType)
+enum class ECharCrossoverMode : uint8
+{
+	UniformGene UMETA(DisplayName = "Uniform (per byte)"),
+	UniformBit UMETA(DisplayName = "Uniform (per bit)"),
+	OnePoint UMETA(DisplayName = "One Point"),
+	TwoPoint UMETA(DisplayName = "Two Point")
+};
+
 /**
- * System that breeds char/byte genomes by randomly taking each gene from either parent.
+ * System that breeds char/byte genomes from two parents (see ECharCrossoverMode).
  *
  * Processing pattern mirrors UBreedFloatGenomesSystem:
- * - Iterate in-order over entities with FResetGenomeComponent + FGenomeCharViewComponent.
- * - Consume one FBreedingPairComponent entity per reset entity.
- * - For each gene, pick from ParentA or ParentB with equal probability.
- * - Inner loop uses 32-bit random masks to batch 32 gene picks per RNG call.
+ * - Walk the FBreedingPlan in order; breed entries whose child has FResetGenomeComponent + FGenomeCharViewComponent.
+ * - Uniform modes blend parents 64 bits at a time with random masks (BitGenomeOps::UniformCrossover);
+ *   point modes copy whole segments with cut points on gene boundaries.
  *
  * Notes:
- * - This system does not destroy FBreedingPairComponent entities; use UBreedingPairCleanupSystem afterwards.
+ * - This system does not reset the plan; UGACleanupSystem does that at the end of the GA step.
  */
 UCLASS(BlueprintType, Blueprintable, EditInlineNew)
 class GENETICALGORITHM_API UBreedCharGenomesSystem : public UEcsSystem
@@ -28,7 +36,6 @@ public:
 	{
 		RegisterComponent<FResetGenomeComponent>();
 		RegisterComponent<FGenomeCharViewComponent>();
-		RegisterComponent<FBreedingPairComponent>();
 	}
 
 	// Optional RNG seed for deterministic behavior (0 = use engine RNG)
@@ -37,9 +44,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Breeding|Char")
 	int32 RandomSeed = 0;
 
+	// UniformGene reproduces the classic per-gene coin flip; UniformBit suits binary-encoded genomes
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Breeding|Char")
+	ECharCrossoverMode CrossoverMode = ECharCrossoverMode::UniformGene;
+
+	// Append (child, parents, generation, birth fitness) rows to the registry's FLineageArena
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Breeding|Char")
+	bool bRecordLineage = true;
+
 	virtual void Update_Implementation(float DeltaTime) override;
 private:
-	FRandomStream Rng;
+	FWordRandom Rng;
 	bool bRngSeeded = false;
-	bool bUseStream = false;
 };
@@ -4,19 +4,17 @@
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
 #include "Components/GenomeComponents.h"
-#include "Components/BreedingPairComponent.h"
 #include "BreedFloatGenomesSystem.generated.h"
 
 /**
  * System that breeds float genomes using SBX (Simulated Binary Crossover).
  *
- * It pairs, in-order, entities marked with FResetGenomeComponent (+ float view)
- * with entities carrying FBreedingPairComponent. For each pair, it reads the two
- * parents' float genome views and writes a new child genome into the reset entity.
+ * It walks the FBreedingPlan written by selection in order. For each entry whose child is
+ * flagged with FResetGenomeComponent and owns a float view, it reads the two parents' float
+ * genome views and writes a new child genome into the child entity.
  *
  * Notes:
- * - This system does not destroy FBreedingPairComponent entities; use UBreedingPairCleanupSystem after it.
-* - Iterates directly over views (no per-tick caches) and consumes one FBreedingPair per reset entity.
+ * - This system does not reset the plan; UGACleanupSystem does that at the end of the GA step.
 */
 UCLASS(BlueprintType, Blueprintable, EditInlineNew)
 class GENETICALGORITHM_API UBreedFloatGenomesSystem : public UEcsSystem
@@ -27,7 +25,6 @@ public:
 	{
 		RegisterComponent<FResetGenomeComponent>();
 		RegisterComponent<FGenomeFloatViewComponent>();
-		RegisterComponent<FBreedingPairComponent>();
 	}
 
 	// SBX parameters
@@ -54,8 +51,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Breeding|SBX")
 	int32 RandomSeed = 0;
 
+	// Append (child, parents, generation, birth fitness) rows to the registry's FLineageArena
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Breeding|SBX")
+	bool bRecordLineage = true;
+
 	virtual void Update_Implementation(float DeltaTime) override;
 
+	/**
+	 * Writes an SBX child of ParentA x ParentB into Child (over the shortest of the three) using this system's settings.
+	 * Touches no system state, so it may run on worker threads as long as each thread passes its own RngPtr.
+	 */
+	void BreedGenome(TConstArrayView<float> ParentA, TConstArrayView<float> ParentB, TArrayView<float> Child, FRandomStream* RngPtr) const;
+
 private:
 	// Per-gene SBX child sampling. Returns one child value produced from parents x1, x2.
 	float SampleSbxChild(float X1, float X2, float U, float EtaLocal, bool bPickFirst) const;
@@ -235,6 +235,7 @@ public:
 				const float OldFitness = Fit.Fitness[FitnessIndex];
 				Fit.Fitness[FitnessIndex] = UC.BestFitness;
 				Fit.EliteIndex = i;
+				Registry.patch<FFitnessComponent>(UC.ExistingElite);
 				NewEliteEntities.Add(UC.ExistingElite);
 
 				// Only update debug info and log when fitness genuinely improved
@@ -318,6 +319,8 @@ if (TargetElite == entt::null)
 		FFitnessComponent& Fit = Registry.get<FFitnessComponent>(TargetElite);
 		Fit.Fitness[FitnessIndex] = UC.BestFitness;
 		Fit.EliteIndex = i;
+		// In-place writes above (and on a fresh emplace) must reach on_update observers
+		Registry.patch<FFitnessComponent>(TargetElite);
 		
 		CopyGenomeToElite(UC.SourceEntity, TargetElite, FitnessIndex);
 		NewEliteEntities.Add(TargetElite);
@@ -3,14 +3,14 @@
 
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
-#include "Components/BreedingPairComponent.h"
 #include "Components/GenomeComponents.h"
 #include "GACleanupSystem.generated.h"
 
 /**
  * GA end-of-step cleanup:
- * - Destroys all transient entities that carry FBreedingPairComponent.
+ * - Resets the per-step FBreedingPlan.
  * - Removes FResetGenomeComponent tags from entities so the user can re-apply them next generation.
+ * - Bounds the FLineageArena at LineageMaxResidentRecords: spills it to disk, or drops the oldest rows without a file.
  */
 UCLASS(BlueprintType, Blueprintable, EditInlineNew)
 class GENETICALGORITHM_API UGACleanupSystem : public UEcsSystem
@@ -19,10 +19,17 @@ class GENETICALGORITHM_API UGACleanupSystem : public UEcsSystem
 public:
 	UGACleanupSystem()
 	{
-		RegisterComponent<FBreedingPairComponent>();
 		RegisterComponent<FResetGenomeComponent>();
 		RegisterComponent<FEligibleForBreedingTagComponent>();
 	}
 
+	// Lineage spill target; relative paths resolve under the project's Saved directory. Empty keeps only the newest rows.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Lineage")
+	FString LineageSpillFile;
+
+	// Resident lineage rows kept in memory before they are appended to LineageSpillFile (or discarded without one)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Lineage", meta=(ClampMin="1"))
+	int32 LineageMaxResidentRecords = 1 << 20;
+
 	virtual void Update_Implementation(float DeltaTime) override;
 };
@@ -5,10 +5,15 @@
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
 #include "Components/GenomeComponents.h"
+#include "Statistics/QuantileSketch.h"
 #include "GADebugDataSystem.generated.h"
 
+struct FStreamingStats;
+
 /**
  * System that collects data for GeneticAlgorithm debugging.
+ * Fitness distributions are summarized with streaming stats and quantile sketches
+ * (no per-tick copies or sorts of the population), and history uses a fixed ring buffer.
  */
 UCLASS()
 class GENETICALGORITHM_API UGADebugDataSystem : public UEcsSystem
@@ -20,7 +25,21 @@ public:
 
 	virtual void Update_Implementation(float DeltaTime) override;
 
+	// Quantiles (in [0, 1]) reported in FFitnessDistributionSummary::Quantiles
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Debug")
+	TArray<float> ReportedQuantiles = { 0.05f, 0.25f, 0.5f, 0.75f, 0.95f };
+
+	// Number of equal-width histogram bins in FFitnessDistributionSummary::Histogram
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Debug", meta=(ClampMin="0"))
+	int32 NumHistogramBins = 16;
+
 private:
+	void Summarize(const FStreamingStats& Stats, const FQuantileSketch& Sketch, FFitnessDistributionSummary& Out) const;
+
+	// Reusable sketches to avoid per-tick allocations
+	TArray<FQuantileSketch> PopulationSketches;
+	FQuantileSketch AllSolutionsSketch;
+
 	float SampleTimer = 0.0f;
 	float SampleInterval = 1.0f; // Sample once per second
 };
@@ -0,0 +1,140 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "Containers/Queue.h"
+#include "Math/RandomStream.h"
+#include "IslandGASystem.generated.h"
+
+struct FFitnessComponent;
+struct FResetGenomeComponent;
+struct FGenomeFloatViewComponent;
+class UBreedFloatGenomesSystem;
+class UMutationFloatGenomeSystem;
+struct FLineageParent;
+
+/**
+ * Island-model GA step for float genomes: selection, SBX breeding and mutation for every population
+ * (island, keyed by FFitnessComponent::BuiltForFitnessIndex) run concurrently on the task graph.
+ * Why: The serial selection/breed/mutate systems walk all populations one after another on the game
+ * thread, so GA latency grew with NumPopulations. Here each island works only on its own partition.
+ *
+ * Per update:
+ * 1) Gather (game thread): candidates and reset children are copied into per-island arrays.
+ * 2) Islands (ParallelFor): tournament selection, Breeder->BreedGenome and Mutator->MutateGenome write
+ *    straight into each child's genome view; every MigrationInterval steps each island posts its best
+ *    MigrantsPerIsland genomes to a lock-free MPSC queue. No registry access happens in this phase.
+ * 3) Sync (game thread): children get fitness reset, ids/lineage and FBreedingPlan entries; the queue is
+ *    drained and migrants join the next island in a ring as extra parent candidates for the next step.
+ *
+ * Replaces UTournamentSelectionSystem + UBreedFloatGenomesSystem + UMutationFloatGenomeSystem in the chain;
+ * Breeder and Mutator only supply settings and kernels and must not also run as chain systems.
+ * Elite selection still runs serially before this system (it creates and destroys entities).
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew)
+class GENETICALGORITHM_API UIslandGASystem : public UEcsSystem
+{
+	GENERATED_BODY()
+public:
+	UIslandGASystem()
+	{
+		RegisterComponent<FFitnessComponent>();
+		RegisterComponent<FResetGenomeComponent>();
+		RegisterComponent<FGenomeFloatViewComponent>();
+	}
+
+	// Breeding settings/kernel (SBX parameters, lineage recording)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island")
+	TObjectPtr<UBreedFloatGenomesSystem> Breeder;
+
+	// Mutation settings/kernel
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island")
+	TObjectPtr<UMutationFloatGenomeSystem> Mutator;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island", meta=(ClampMin="2"))
+	int32 TournamentSize = 3;
+
+	// Probability that the best candidate wins the tournament. Higher = stronger pressure.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float SelectionPressure = 0.8f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island")
+	bool bHigherIsBetter = true;
+
+	// Elites in a tournament beat non-elites regardless of SelectionPressure
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island")
+	bool bElitesAlwaysWin = true;
+
+	// Steps between migrations (0 disables migration)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island|Migration", meta=(ClampMin="0"))
+	int32 MigrationInterval = 5;
+
+	// Best genomes each island sends to its ring neighbour per migration
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island|Migration", meta=(ClampMin="0"))
+	int32 MigrantsPerIsland = 1;
+
+	// Optional seed for deterministic runs (0 = seed islands from the engine RNG)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island")
+	int32 RandomSeed = 0;
+
+	/** Base seed from the context to avoid identical behavior in multi-context setups */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Island")
+	int32 ContextSeed = 0;
+
+	virtual void Update_Implementation(float DeltaTime) override;
+
+private:
+	struct FCandidate
+	{
+		entt::entity Entity = entt::null;
+		int64 SolutionId = 0;
+		int32 Generation = -1;
+		float Fitness = 0.0f;
+		bool bIsElite = false;
+		bool bIsMigrant = false;
+		TConstArrayView<float> Genome;
+	};
+
+	struct FChild
+	{
+		entt::entity Entity = entt::null;
+		TArrayView<float> Genome;
+		// Indices into the island's candidates, which stay valid until the next gather
+		int32 ParentA = INDEX_NONE;
+		int32 ParentB = INDEX_NONE;
+		bool bBred = false;
+	};
+
+	struct FMigrant
+	{
+		int32 SourceIsland = INDEX_NONE;
+		entt::entity Entity = entt::null;
+		int64 SolutionId = 0;
+		int32 Generation = -1;
+		float Fitness = 0.0f;
+		TArray<float> Genome;
+	};
+
+	// Population-partitioned working set; only the owning island's task touches it during phase 2
+	struct FIsland
+	{
+		TArray<FCandidate> Candidates;
+		TArray<FChild> Children;
+		TArray<FMigrant> Inbox; // migrants received at the last sync, candidates for this step
+		TArray<int32> Scratch;
+		FRandomStream Rng;
+	};
+
+	void RunIsland(FIsland& Island, int32 IslandIndex, bool bMigrate);
+	int32 RunTournament(FIsland& Island) const;
+	bool IsBetter(const FCandidate& A, const FCandidate& B) const;
+	static FLineageParent ToLineageParent(const FCandidate& Candidate);
+
+	// Reusable caches to avoid per-tick allocations
+	TArray<FIsland> Islands;
+	TQueue<FMigrant, EQueueMode::Mpsc> Outbox;
+
+	int32 StepCount = 0;
+};
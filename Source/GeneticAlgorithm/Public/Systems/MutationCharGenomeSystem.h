@@ -3,18 +3,20 @@
 
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
-#include "Math/RandomStream.h"
+#include "Genome/BitGenomeOps.h"
 #include "MutationCharGenomeSystem.generated.h"
 
 struct FResetGenomeComponent;
 struct FGenomeCharViewComponent;
 
 /**
- * Mutates char-based genomes in-place by flipping individual bits with low probability.
+ * Mutates char-based genomes in-place by flipping individual bits with probability BitFlipProbability.
  *
- * Efficiency: uses geometric skipping over bits to sample only flip locations.
- * Expected time is proportional to the number of flips (O(p * Nbits)) rather than
- * the total number of bits, which is beneficial for small probabilities.
+ * Efficiency: two strategies, picked per update from the probability.
+ * - Low rates use geometric skipping over bits to sample only flip locations; expected time is
+ *   proportional to the number of flips (O(p * Nbits)).
+ * - Rates at or above MaskMutationThreshold XOR each 64-bit word with a Bernoulli mask built from
+ *   MaskPrecisionBits random words, so cost no longer grows with the number of flips.
  *
  * Stateless; only requires FGenomeCharViewComponent.
  */
@@ -33,6 +35,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Mutation", meta=(ClampMin="0.0", ClampMax="1.0"))
 	float BitFlipProbability = 0.01f;
 
+	// Switch from geometric skipping to word masks at this per-bit probability
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Mutation", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float MaskMutationThreshold = 0.0625f;
+
+	// Mask mode quantizes BitFlipProbability to multiples of 1/2^MaskPrecisionBits (costs up to this many RNG words per 64 bits)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Mutation", meta=(ClampMin="1", ClampMax="16"))
+	int32 MaskPrecisionBits = 8;
+
 	// Optional RNG seed for deterministic behavior (0 = use engine RNG)
 	// RNG seeding policy: if RandomSeed != 0, we seed once and advance across updates; we do NOT reseed every Update.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Mutation")
@@ -40,7 +50,6 @@ public:
 
 	virtual void Update_Implementation(float DeltaTime) override;
 private:
-	FRandomStream Rng;
+	FWordRandom Rng;
 	bool bRngSeeded = false;
-	bool bUseStream = false;
 };
@@ -61,6 +61,9 @@ public:
 	int32 ContextSeed = 0;
 
 	virtual void Update_Implementation(float DeltaTime) override;
+
+	/** Mutates one genome in place with this system's settings. Thread-safe when each thread passes its own RngPtr. */
+	void MutateGenome(TArrayView<float> Values, FRandomStream* RngPtr) const;
 private:
 	FRandomStream Rng;
 	bool bRngSeeded = false;
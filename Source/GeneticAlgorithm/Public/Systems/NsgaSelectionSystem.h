@@ -0,0 +1,76 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "Math/RandomStream.h"
+#include "Selection/NonDominatedSort.h"
+#include "NsgaSelectionSystem.generated.h"
+
+struct FFitnessComponent;
+struct FResetGenomeComponent;
+struct FEligibleForBreedingTagComponent;
+
+/**
+ * Multi-objective (NSGA-II) parent selection.
+ * Why: UTournamentSelectionSystem compares one fitness slot per population. Here several slots of
+ * FFitnessComponent::Fitness are objectives at once (e.g. lap progress vs. smoothness vs. speed);
+ * candidates are ranked into Pareto fronts with FNonDominatedSorter, then parents are drawn by binary
+ * tournaments on (front, crowding distance). Parents are appended to the FBreedingPlan like any selection.
+ * Candidate pool: every eligible or elite entity with a genome view that is not flagged for reset.
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew)
+class GENETICALGORITHM_API UNsgaSelectionSystem : public UEcsSystem
+{
+	GENERATED_BODY()
+public:
+	UNsgaSelectionSystem()
+	{
+		RegisterComponent<FFitnessComponent>();
+		RegisterComponent<FResetGenomeComponent>();
+		RegisterComponent<FEligibleForBreedingTagComponent>();
+	}
+
+	// Fitness slots used as objectives. Empty = one objective per population slot. A negative slot disables selection.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|NSGA")
+	TArray<int32> ObjectiveIndices;
+
+	// If true, higher values are better for every objective.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|NSGA")
+	bool bHigherIsBetter = true;
+
+	// Optional seed for deterministic tests (0 means use engine RNG).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|NSGA")
+	int32 RandomSeed = 0;
+
+	/** Base seed from the context to avoid identical behavior in multi-context setups */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|NSGA")
+	int32 ContextSeed = 0;
+
+	virtual void Update_Implementation(float DeltaTime) override;
+
+	/** Front (0 = non-dominated) of each candidate from the last update, parallel to GetCandidates(). */
+	TConstArrayView<int32> GetRanks() const { return Ranks; }
+	TConstArrayView<float> GetCrowding() const { return Crowding; }
+	TConstArrayView<entt::entity> GetCandidates() const { return Candidates; }
+
+private:
+	// Crowded binary tournament: lower front wins, then larger crowding distance, then a coin flip
+	int32 PickParent(FRandomStream* RngStream) const;
+
+	FNonDominatedSorter Sorter;
+
+	// Reusable caches to avoid per-tick allocations
+	TArray<entt::entity> Candidates;
+	TArray<float> Objectives; // column-major, minimized
+	TArray<int32> Ranks;
+	TArray<float> Crowding;
+
+	// RNG state (seed once, advance across updates)
+	FRandomStream Rng;
+	bool bRngSeeded = false;
+	bool bUseStream = false;
+
+	bool bHasLoggedInvalidObjective = false;
+};
@@ -5,16 +5,31 @@
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
 #include "Math/RandomStream.h"
+#include "Selection/AliasTable.h"
 #include "TournamentSelectionSystem.generated.h"
 
 struct FFitnessComponent;
 struct FResetGenomeComponent;
-struct FBreedingPairComponent;
 
+/**
+ * How parents are drawn from a bucket.
+ * Tournament samples K candidates per parent; the other modes build a Walker alias table
+ * once per bucket per tick and then draw each parent in O(1).
+ */
+UENUM(BlueprintType)
+enum class EParentSelectionMode : uint8
+{
+	Tournament UMETA(DisplayName = "Tournament"),
+	LinearRank UMETA(DisplayName = "Linear Rank"),
+	ExponentialRank UMETA(DisplayName = "Exponential Rank"),
+	FitnessProportional UMETA(DisplayName = "Fitness Proportional")
+};
 
 /**
  * Tournament selection system.
  * Why: Select parents by sampling small tournaments over fitness values.
+ * Also supports rank-based and fitness-proportional selection (see EParentSelectionMode),
+ * sampled from per-bucket alias tables rebuilt once per tick.
  * Stateless; operates only on component data.
  */
 UCLASS(BlueprintType, Blueprintable, EditInlineNew)
@@ -26,12 +41,27 @@ public:
 	{
 		RegisterComponent<FFitnessComponent>();
 		RegisterComponent<FResetGenomeComponent>();
-		RegisterComponent<FBreedingPairComponent>();
 		RegisterComponent<FEligibleForBreedingTagComponent>();
 	}
 
 	// Selection parameters are configured per-system asset and treated as constants at runtime.
 	// Unreal does not allow const UPROPERTY; we expose EditDefaultsOnly and never mutate them in code.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection")
+	EParentSelectionMode SelectionMode = EParentSelectionMode::Tournament;
+
+	// LinearRank: expected offspring of the best candidate (1.0 = uniform, 2.0 = worst never picked).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|Rank", meta=(ClampMin="1.0", ClampMax="2.0"))
+	float LinearRankPressure = 1.5f;
+
+	// ExponentialRank: weight ratio between consecutive ranks (closer to 0 = greedier).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|Rank", meta=(ClampMin="0.01", ClampMax="1.0"))
+	float ExponentialRankBase = 0.9f;
+
+	// FitnessProportional: weight floor added after shifting by the bucket's worst fitness,
+	// so the worst candidate keeps a small non-zero chance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|Proportional", meta=(ClampMin="0.0"))
+	float ProportionalWeightFloor = 0.01f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|Tournament", meta=(ClampMin="2"))
 	int32 TournamentSize = 3;
 
@@ -50,6 +80,7 @@ public:
 	// If true, any elite entity that enters a tournament automatically wins it.
 	// Elites still compete among themselves by fitness, but a single elite vs any
 	// non-elite always produces the elite as the winner regardless of SelectionPressure.
+	// In rank modes elites are ranked ahead of all non-elites instead.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Selection|Tournament")
 	bool bElitesAlwaysWin = true;
 
@@ -80,12 +111,24 @@ private:
 	mutable TArray<TArray<FEntityRefFitness>> GroupBuckets; // indexed by fitness dimension
 	mutable TArray<FEntityRefFitness> GlobalBucket;
 	mutable TArray<int32> ScratchIndices;
+	mutable TArray<double> ScratchWeights;
+	mutable TArray<FAliasTable> GroupTables; // parallel to GroupBuckets
+	mutable FAliasTable GlobalTable;
 
 	// RNG state (seed once, advance across updates)
 	FRandomStream Rng;
 	bool bRngSeeded = false;
 	bool bUseStream = false;
 
- // Helper: run a tournament on a bucket and return winning entity, or entt::null
+	// Helper: run a tournament on a bucket and return winning entity, or entt::null
 	entt::entity RunTournament(const TArray<FEntityRefFitness>& Bucket, FRandomStream* RngStream);
+
+	// Helper: build the alias table for a bucket according to SelectionMode
+	void BuildAliasTable(const TArray<FEntityRefFitness>& Bucket, FAliasTable& OutTable);
+
+	// Helper: draw a parent from a bucket using the active mode, or entt::null
+	entt::entity PickParent(const TArray<FEntityRefFitness>& Bucket, const FAliasTable& Table, FRandomStream* RngStream);
+
+	// Strict weak ordering used by both tournaments and ranking (best first)
+	bool IsBetter(const FEntityRefFitness& A, const FEntityRefFitness& B) const;
 };
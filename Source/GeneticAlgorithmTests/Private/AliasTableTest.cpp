@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "Selection/AliasTable.h"
+
+TEST_CLASS(GeneticAlgorithm_AliasTable_Tests, "GeneticAlgorithm.Selection.AliasTable")
+{
+	FRandomStream Rng;
+
+	BEFORE_EACH()
+	{
+		Rng.Initialize(4242);
+	}
+
+	TEST_METHOD(Sampling_Frequencies_Match_Weights)
+	{
+		const TArray<double> Weights = { 1.0, 2.0, 3.0, 4.0 };
+		FAliasTable Table;
+		Table.Build(Weights);
+		ASSERT_THAT(AreEqual(4, Table.Num(), TEXT("Table should have one column per weight")));
+
+		const int32 Draws = 200000;
+		TArray<int32> Counts;
+		Counts.SetNumZeroed(Weights.Num());
+		for (int32 i = 0; i < Draws; ++i)
+		{
+			const int32 Idx = Table.Sample(&Rng);
+			ASSERT_THAT(IsTrue(Counts.IsValidIndex(Idx), TEXT("Sample should be a valid index")));
+			++Counts[Idx];
+		}
+
+		for (int32 i = 0; i < Weights.Num(); ++i)
+		{
+			const float Expected = static_cast<float>(Weights[i] / 10.0);
+			const float Observed = static_cast<float>(Counts[i]) / Draws;
+			ASSERT_THAT(IsNear(Expected, Observed, 0.01f, FString::Printf(TEXT("Frequency of index %d should match its weight"), i)));
+		}
+	}
+
+	TEST_METHOD(Zero_Weights_Are_Never_Sampled)
+	{
+		const TArray<double> Weights = { 0.0, 5.0, -1.0, 5.0 };
+		FAliasTable Table;
+		Table.Build(Weights);
+
+		for (int32 i = 0; i < 10000; ++i)
+		{
+			const int32 Idx = Table.Sample(&Rng);
+			ASSERT_THAT(IsTrue(Idx == 1 || Idx == 3, TEXT("Only positive-weight indices should be sampled")));
+		}
+	}
+
+	TEST_METHOD(All_Zero_Weights_Fall_Back_To_Uniform)
+	{
+		const TArray<double> Weights = { 0.0, 0.0, 0.0 };
+		FAliasTable Table;
+		Table.Build(Weights);
+
+		TArray<int32> Counts;
+		Counts.SetNumZeroed(Weights.Num());
+		for (int32 i = 0; i < 30000; ++i)
+		{
+			++Counts[Table.Sample(&Rng)];
+		}
+		for (int32 i = 0; i < Counts.Num(); ++i)
+		{
+			ASSERT_THAT(IsNear(1.0f / 3.0f, static_cast<float>(Counts[i]) / 30000.0f, 0.02f, TEXT("All-zero weights should sample uniformly")));
+		}
+	}
+
+	TEST_METHOD(Empty_Table_Returns_IndexNone)
+	{
+		FAliasTable Table;
+		Table.Build(TArray<double>());
+		ASSERT_THAT(AreEqual(INDEX_NONE, Table.Sample(&Rng), TEXT("Empty table should return INDEX_NONE")));
+	}
+};
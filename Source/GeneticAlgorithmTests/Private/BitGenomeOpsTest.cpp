@@ -0,0 +1,102 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "Genome/BitGenomeOps.h"
+
+TEST_CLASS(GeneticAlgorithm_BitGenomeOps_Tests, "GeneticAlgorithm.BitGenomeOps")
+{
+	TEST_METHOD(SpreadBitsToBytes_Expands_Every_Pattern)
+	{
+		for (uint32 Bits = 0; Bits < 256; ++Bits)
+		{
+			uint64 Expected = 0;
+			for (int32 Byte = 0; Byte < 8; ++Byte)
+			{
+				if (Bits & (1u << Byte))
+				{
+					Expected |= 0xFFull << (Byte * 8);
+				}
+			}
+			ASSERT_THAT(AreEqual(Expected, BitGenomeOps::SpreadBitsToBytes(Bits), TEXT("Bit i should map to byte i")));
+		}
+	}
+
+	TEST_METHOD(UniformCrossover_Takes_Each_Gene_From_A_Parent)
+	{
+		// 37 bytes exercises full words plus a partial tail word
+		const int32 N = 37;
+		TArray<uint8> A, B, Child;
+		A.Init(0x11, N);
+		B.Init(0xEE, N);
+		Child.Init(0, N);
+		FWordRandom Rng;
+		Rng.Seed(7);
+
+		BitGenomeOps::UniformCrossover(A.GetData(), B.GetData(), Child.GetData(), N, Rng, false);
+
+		int32 FromA = 0;
+		for (int32 i = 0; i < N; ++i)
+		{
+			ASSERT_THAT(IsTrue(Child[i] == 0x11 || Child[i] == 0xEE, TEXT("Per-gene mode must copy whole bytes")));
+			FromA += Child[i] == 0x11 ? 1 : 0;
+		}
+		ASSERT_THAT(IsTrue(FromA > 0 && FromA < N, TEXT("Both parents should contribute")));
+
+		BitGenomeOps::UniformCrossover(A.GetData(), B.GetData(), Child.GetData(), N, Rng, true);
+		for (int32 i = 0; i < N; ++i)
+		{
+			ASSERT_THAT(AreEqual(0, static_cast<int32>(Child[i] & ~(A[i] | B[i])), TEXT("Per-bit mode only uses parent bits")));
+		}
+	}
+
+	TEST_METHOD(SegmentCrossover_Copies_Segments)
+	{
+		const int32 N = 20;
+		TArray<uint8> A, B, Child;
+		A.Init(1, N);
+		B.Init(2, N);
+		Child.Init(0, N);
+
+		BitGenomeOps::SegmentCrossover(A.GetData(), B.GetData(), Child.GetData(), N, 5, 12);
+		for (int32 i = 0; i < N; ++i)
+		{
+			const uint8 Expected = (i >= 5 && i < 12) ? 2 : 1;
+			ASSERT_THAT(AreEqual(Expected, Child[i], TEXT("Middle segment from B, rest from A")));
+		}
+	}
+
+	TEST_METHOD(BernoulliWord_Matches_Probability)
+	{
+		FWordRandom Rng;
+		Rng.Seed(123);
+		int64 Set = 0;
+		const int32 Words = 4000;
+		for (int32 i = 0; i < Words; ++i)
+		{
+			Set += FMath::CountBits(BitGenomeOps::BernoulliWord(Rng, 77, 8));
+		}
+		const double Rate = static_cast<double>(Set) / (Words * 64.0);
+		ASSERT_THAT(IsNear(77.0 / 256.0, Rate, 0.01, TEXT("Set-bit rate should match Numerator / 2^Bits")));
+		ASSERT_THAT(AreEqual(0ull, BitGenomeOps::BernoulliWord(Rng, 0, 8), TEXT("Zero probability yields no bits")));
+		ASSERT_THAT(AreEqual(~0ull, BitGenomeOps::BernoulliWord(Rng, 256, 8), TEXT("Probability one yields all bits")));
+	}
+
+	TEST_METHOD(SkipMutate_Matches_Probability)
+	{
+		const int32 N = 4096;
+		TArray<uint8> Bytes;
+		Bytes.Init(0, N);
+		FWordRandom Rng;
+		Rng.Seed(99);
+
+		BitGenomeOps::SkipMutate(Bytes.GetData(), N, Rng, FMath::Loge(1.0 - 0.02));
+
+		int64 Flipped = 0;
+		for (const uint8 Byte : Bytes)
+		{
+			Flipped += FMath::CountBits(Byte);
+		}
+		ASSERT_THAT(IsNear(0.02, static_cast<double>(Flipped) / (N * 8.0), 0.004, TEXT("Flip rate should be near 2%")));
+	}
+};
@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "entt/entt.hpp"
+#include "Components/GenomeComponents.h"
+#include "EcsCommandBuffer.h"
+
+TEST_CLASS(GeneticAlgorithm_EcsCommandBuffer_Tests, "GeneticAlgorithm.EcsCommandBuffer")
+{
+	entt::registry Registry;
+	FEcsCommandBuffer Buffer;
+
+	AFTER_EACH()
+	{
+		Registry.clear();
+	}
+
+	TEST_METHOD(Nothing_Changes_Until_Playback)
+	{
+		const entt::entity A = Registry.create();
+		Buffer.Emplace<FEligibleForBreedingTagComponent>(A);
+		Buffer.Emplace<FResetGenomeComponent>(Buffer.Create(), FResetGenomeComponent{});
+		ASSERT_THAT(IsFalse(Buffer.IsEmpty(), TEXT("Buffer should hold recorded commands")));
+		ASSERT_THAT(IsFalse(Registry.all_of<FEligibleForBreedingTagComponent>(A), TEXT("Emplace should be deferred")));
+		ASSERT_THAT(AreEqual(0, static_cast<int32>(Registry.view<FResetGenomeComponent>().size()), TEXT("Create should be deferred")));
+
+		Buffer.Playback(Registry);
+		ASSERT_THAT(IsTrue(Buffer.IsEmpty(), TEXT("Playback should drain the buffer")));
+		ASSERT_THAT(IsTrue(Registry.all_of<FEligibleForBreedingTagComponent>(A), TEXT("Tag should be applied at playback")));
+		ASSERT_THAT(AreEqual(1, static_cast<int32>(Registry.view<FResetGenomeComponent>().size()), TEXT("Deferred entity should exist after playback")));
+	}
+
+	TEST_METHOD(Deferred_Entities_Receive_Their_Components)
+	{
+		const FEcsCommandBuffer::FDeferredEntity Deferred = Buffer.Create();
+		Buffer.Emplace<FResetGenomeComponent>(Deferred, FResetGenomeComponent{ FName(TEXT("Payload")) });
+		Buffer.Playback(Registry);
+
+		auto View = Registry.view<FResetGenomeComponent>();
+		ASSERT_THAT(AreEqual(1, static_cast<int32>(View.size()), TEXT("One entity should be created")));
+		const FResetGenomeComponent& Stored = View.get<FResetGenomeComponent>(*View.begin());
+		ASSERT_THAT(IsTrue(Stored.ReasonForReset == FName(TEXT("Payload")), TEXT("Component payload should be preserved")));
+	}
+
+	TEST_METHOD(Last_Emplace_Wins_And_Duplicates_Collapse)
+	{
+		const entt::entity A = Registry.create();
+		Buffer.Emplace<FResetGenomeComponent>(A, FResetGenomeComponent{ FName(TEXT("First")) });
+		Buffer.Emplace<FResetGenomeComponent>(A, FResetGenomeComponent{ FName(TEXT("Second")) });
+		Buffer.Emplace<FEligibleForBreedingTagComponent>(A);
+		Buffer.Emplace<FEligibleForBreedingTagComponent>(A);
+		Buffer.Playback(Registry);
+
+		ASSERT_THAT(IsTrue(Registry.get<FResetGenomeComponent>(A).ReasonForReset == FName(TEXT("Second")), TEXT("Last recorded value should win")));
+		ASSERT_THAT(IsTrue(Registry.all_of<FEligibleForBreedingTagComponent>(A), TEXT("Duplicate tag emplaces should collapse into one")));
+	}
+
+	TEST_METHOD(Clear_Remove_And_Destroy_Are_Batched_And_Skip_Invalid)
+	{
+		const entt::entity A = Registry.create();
+		const entt::entity B = Registry.create();
+		const entt::entity C = Registry.create();
+		Registry.emplace<FEligibleForBreedingTagComponent>(A);
+		Registry.emplace<FEligibleForBreedingTagComponent>(B);
+		Registry.emplace<FResetGenomeComponent>(C);
+
+		Buffer.Clear<FEligibleForBreedingTagComponent>();
+		Buffer.Remove<FResetGenomeComponent>(C);
+		Buffer.Destroy(B);
+		Buffer.Destroy(B);
+		Registry.destroy(A);
+		Buffer.Destroy(A); // stale by playback time
+		Buffer.Playback(Registry);
+
+		ASSERT_THAT(AreEqual(0, static_cast<int32>(Registry.storage<FEligibleForBreedingTagComponent>().size()), TEXT("Clear should empty the tag storage")));
+		ASSERT_THAT(IsFalse(Registry.all_of<FResetGenomeComponent>(C), TEXT("Remove should apply")));
+		ASSERT_THAT(IsFalse(Registry.valid(B), TEXT("B should be destroyed once")));
+		ASSERT_THAT(IsTrue(Registry.valid(C), TEXT("C should be untouched by destroys")));
+	}
+};
@@ -9,7 +9,6 @@
 
 // GA components and systems
 #include "Components/GenomeComponents.h"
-#include "Components/BreedingPairComponent.h"
 #include "Components/EliteComponents.h"
 #include "Systems/EliteSelectionCharSystem.h"
 #include "Systems/EliteSelectionFloatSystem.h"
@@ -94,4 +94,26 @@ TEST_CLASS(SimpleML_GA_MutationChar_Tests, "SimpleML.GA.MutationChar")
 		const int64 minFlips = static_cast<int64>(FMath::FloorToDouble(0.15 * static_cast<double>(totalBits)));
 		ASSERT_THAT(IsTrue(flipped >= minFlips, "Mutation should flip at least 15% of the bits with a 20% probability setting"));
 	}
+
+	TEST_METHOD(Skip_And_Mask_Paths_Agree_On_Rate)
+	{
+		// Same probability through both strategies; both should land near 20%
+		for (const float Threshold : { 1.0f, 0.0f })
+		{
+			for (int32 i = 0; i < Genome.Num(); ++i)
+			{
+				Genome[i] = Original[i];
+			}
+			Mutator->MaskMutationThreshold = Threshold;
+			IEcsEventElement::Execute_Update(Mutator, 0.0f);
+
+			int64 flipped = 0;
+			for (int32 i = 0; i < Genome.Num(); ++i)
+			{
+				flipped += PopCount(static_cast<uint8>(Original[i]) ^ static_cast<uint8>(Genome[i]));
+			}
+			const double fraction = static_cast<double>(flipped) / (Genome.Num() * 8.0);
+			ASSERT_THAT(IsNear(0.20, fraction, 0.03, TEXT("Flip rate should be near the configured probability")));
+		}
+	}
 };
@@ -0,0 +1,192 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "EcsContext.h"
+#include "Engine/World.h"
+#include "entt/entt.hpp"
+#include "Components/GenomeComponents.h"
+#include "Systems/IslandGASystem.h"
+#include "Systems/BreedFloatGenomesSystem.h"
+#include "Systems/MutationFloatGenomeSystem.h"
+#include "Lineage/LineageArena.h"
+#include "Lineage/SolutionIdAllocator.h"
+#include "BreedingPlan.h"
+
+TEST_CLASS(GeneticAlgorithm_IslandGASystem_Tests, "GeneticAlgorithm.IslandGA")
+{
+	static constexpr int32 GenomeSize = 6;
+	static constexpr int32 NumIslands = 2;
+
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AEcsContext> Context;
+	TObjectPtr<UIslandGASystem> System;
+	TArray<TArray<float>> Genomes;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("IslandGATestWorld")));
+		Context = World->SpawnActor<AEcsContext>();
+
+		System = NewObject<UIslandGASystem>();
+		System->RandomSeed = 5;
+		System->MigrationInterval = 0;
+
+		// Copy genes from a parent and leave them untouched, so children show exactly where they came from
+		System->Breeder = NewObject<UBreedFloatGenomesSystem>();
+		System->Breeder->CrossoverProbability = 0.0f;
+		System->Mutator = NewObject<UMutationFloatGenomeSystem>();
+		System->Mutator->PerValueDeltaPercent = 0.0f;
+		System->Mutator->RandomMutationChance = 0.0f;
+		System->Initialize(Context);
+
+		// Genome views point into these buffers; no reallocation while the test runs
+		Genomes.Reset();
+		Genomes.Reserve(32);
+	}
+
+	AFTER_EACH()
+	{
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	entt::entity CreateSolution(int32 Island, float Fitness, float GeneValue)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		const entt::entity Entity = Registry.create();
+
+		FFitnessComponent Fit;
+		Fit.Fitness.Init(0.0f, NumIslands);
+		Fit.Fitness[Island] = Fitness;
+		Fit.BuiltForFitnessIndex = Island;
+		Registry.emplace<FFitnessComponent>(Entity, Fit);
+
+		TArray<float>& Genome = Genomes.AddDefaulted_GetRef();
+		Genome.Init(GeneValue, GenomeSize);
+		Registry.emplace<FGenomeFloatViewComponent>(Entity).Values = Genome;
+		Registry.emplace<FUniqueSolutionComponent>(Entity).Id = FSolutionIdAllocator::Get(Registry).Allocate();
+		return Entity;
+	}
+
+	entt::entity CreateParent(int32 Island, float Fitness, float GeneValue)
+	{
+		const entt::entity Entity = CreateSolution(Island, Fitness, GeneValue);
+		Context->GetRegistry().emplace<FEligibleForBreedingTagComponent>(Entity);
+		return Entity;
+	}
+
+	entt::entity CreateChild(int32 Island)
+	{
+		const entt::entity Entity = CreateSolution(Island, 1.0f, 0.0f);
+		Context->GetRegistry().emplace<FResetGenomeComponent>(Entity);
+		return Entity;
+	}
+
+	bool GenomeEquals(entt::entity Entity, float GeneValue) const
+	{
+		for (const float Value : Context->GetRegistry().get<FGenomeFloatViewComponent>(Entity).Values)
+		{
+			if (!FMath::IsNearlyEqual(Value, GeneValue))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	TEST_METHOD(Each_Island_Breeds_From_Its_Own_Population)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		CreateParent(0, 10.0f, 0.5f);
+		CreateParent(0, 8.0f, 0.5f);
+		CreateParent(1, 10.0f, -0.5f);
+		CreateParent(1, 8.0f, -0.5f);
+		const entt::entity ChildA = CreateChild(0);
+		const entt::entity ChildB = CreateChild(1);
+		const int64 OldIdA = Registry.get<FUniqueSolutionComponent>(ChildA).Id;
+
+		System->Update(0.0f);
+
+		ASSERT_THAT(IsTrue(GenomeEquals(ChildA, 0.5f), TEXT("Island 0 children only see island 0 parents")));
+		ASSERT_THAT(IsTrue(GenomeEquals(ChildB, -0.5f), TEXT("Island 1 children only see island 1 parents")));
+		ASSERT_THAT(AreEqual(0.0f, Registry.get<FFitnessComponent>(ChildA).Fitness[0], TEXT("Children start with zero fitness")));
+		ASSERT_THAT(AreNotEqual(OldIdA, Registry.get<FUniqueSolutionComponent>(ChildA).Id, TEXT("A child is a new solution")));
+
+		const FBreedingPlan& Plan = FBreedingPlan::Get(Registry);
+		ASSERT_THAT(AreEqual(2, Plan.Num()));
+		for (const FBreedingPlanEntry& Entry : Plan.GetEntries())
+		{
+			ASSERT_THAT(AreEqual(Registry.get<FFitnessComponent>(Entry.Child).BuiltForFitnessIndex, Entry.Population));
+			ASSERT_THAT(AreEqual(Entry.Population, Registry.get<FFitnessComponent>(Entry.ParentA).BuiltForFitnessIndex));
+			ASSERT_THAT(AreEqual(Entry.Population, Registry.get<FFitnessComponent>(Entry.ParentB).BuiltForFitnessIndex));
+		}
+	}
+
+	TEST_METHOD(Migrants_Reach_The_Next_Island_And_Keep_Their_Lineage_Id)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		System->MigrationInterval = 1;
+		System->MigrantsPerIsland = 1;
+
+		// Island 1 has no parents of its own, so its child can only be bred from island 0's migrant
+		const entt::entity Source = CreateParent(0, 10.0f, 0.5f);
+		CreateParent(0, 2.0f, 0.25f);
+		const entt::entity Child = CreateChild(1);
+		const int64 SourceId = Registry.get<FUniqueSolutionComponent>(Source).Id;
+
+		// Step 1: island 0 emigrates its best genome, island 1 has nothing to breed from yet
+		System->Update(0.0f);
+		ASSERT_THAT(IsTrue(GenomeEquals(Child, 0.0f), TEXT("No candidates on island 1 before the migrant arrives")));
+
+		// The source is re-bred before the migrant is used; the migrant still carries its old genome and id
+		Registry.get<FUniqueSolutionComponent>(Source).Id = FSolutionIdAllocator::Get(Registry).Allocate();
+		for (float& Value : Registry.get<FGenomeFloatViewComponent>(Source).Values)
+		{
+			Value = -1.0f;
+		}
+
+		// Step 2: the migrant is island 1's only candidate
+		const int64 LineageBefore = FLineageArena::Get(Registry).NumTotal();
+		System->Update(0.0f);
+		ASSERT_THAT(IsTrue(GenomeEquals(Child, 0.5f), TEXT("Island 1 breeds from the genome island 0 sent")));
+
+		const FLineageArena& Arena = FLineageArena::Get(Registry);
+		ASSERT_THAT(AreEqual(LineageBefore + 1, Arena.NumTotal()));
+		const FLineageRecord& Record = Arena[Arena.NumResident() - 1];
+		ASSERT_THAT(AreEqual(Registry.get<FUniqueSolutionComponent>(Child).Id, Record.Id));
+		ASSERT_THAT(AreEqual(SourceId, Record.ParentA, TEXT("Lineage names the migrant's solution, not the re-bred entity")));
+		ASSERT_THAT(AreEqual(SourceId, Record.ParentB));
+	}
+
+	TEST_METHOD(Breeder_And_Mutator_Settings_Drive_The_Kernels)
+	{
+		CreateParent(0, 10.0f, 0.5f);
+		const entt::entity Clamped = CreateChild(0);
+		System->Breeder->ClampMax = 0.25f;
+		System->Update(0.0f);
+		ASSERT_THAT(IsTrue(GenomeEquals(Clamped, 0.25f), TEXT("Children are clamped with the breeder's settings")));
+
+		const entt::entity Mutated = CreateChild(0);
+		System->Breeder->ClampMax = 1.0f;
+		System->Mutator->PerValueDeltaPercent = 0.5f;
+		System->Update(0.0f);
+		ASSERT_THAT(IsFalse(GenomeEquals(Mutated, 0.5f), TEXT("Children are mutated with the mutator's settings")));
+	}
+
+	TEST_METHOD(Missing_Breeder_Skips_The_Step)
+	{
+		CreateParent(0, 10.0f, 0.5f);
+		const entt::entity Child = CreateChild(0);
+		System->Breeder = nullptr;
+
+		System->Update(0.0f);
+
+		ASSERT_THAT(IsTrue(GenomeEquals(Child, 0.0f)));
+		ASSERT_THAT(IsTrue(Context->GetRegistry().all_of<FResetGenomeComponent>(Child), TEXT("The child waits for a configured step")));
+		ASSERT_THAT(AreEqual(0, FBreedingPlan::Get(Context->GetRegistry()).Num()));
+	}
+};
@@ -0,0 +1,144 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "entt/entt.hpp"
+#include "Components/GenomeComponents.h"
+#include "Lineage/SolutionIdAllocator.h"
+#include "Lineage/LineageArena.h"
+
+TEST_CLASS(GeneticAlgorithm_Lineage_Tests, "GeneticAlgorithm.Lineage")
+{
+	TEST_METHOD(Allocator_Ids_Are_Unique_And_NonZero)
+	{
+		entt::registry RegistryA;
+		entt::registry RegistryB;
+		FSolutionIdAllocator& AllocA = FSolutionIdAllocator::Get(RegistryA);
+		FSolutionIdAllocator& AllocB = FSolutionIdAllocator::Get(RegistryB);
+		AllocA.BlockSize = 8;
+		AllocB.BlockSize = 8;
+
+		TSet<int64> Seen;
+		for (int32 i = 0; i < 100; ++i)
+		{
+			for (const int64 Id : { AllocA.Allocate(), AllocB.Allocate(), FUniqueSolutionComponent::GenerateNewId() })
+			{
+				ASSERT_THAT(IsTrue(Id > 0, TEXT("Ids must be positive")));
+				ASSERT_THAT(IsFalse(Seen.Contains(Id), TEXT("Ids must not repeat across registries")));
+				Seen.Add(Id);
+			}
+		}
+	}
+
+	TEST_METHOD(ReserveBlock_Hands_Out_Disjoint_Ranges)
+	{
+		FSolutionIdAllocator::FIdBlock First = FSolutionIdAllocator::ReserveBlock(16);
+		const FSolutionIdAllocator::FIdBlock Second = FSolutionIdAllocator::ReserveBlock(16);
+
+		ASSERT_THAT(AreEqual(16, First.Num(), TEXT("Block should contain the requested count")));
+		ASSERT_THAT(IsTrue(First.End <= Second.Next, TEXT("Consecutive blocks must not overlap")));
+
+		const int64 Start = First.Next;
+		ASSERT_THAT(AreEqual(Start, First.Pop(), TEXT("Pop should return ids in order")));
+		ASSERT_THAT(AreEqual(15, First.Num(), TEXT("Pop should shrink the block")));
+	}
+
+	TEST_METHOD(Cached_Block_Follows_A_Later_Process_Origin)
+	{
+		entt::registry Registry;
+		FSolutionIdAllocator& Alloc = FSolutionIdAllocator::Get(Registry);
+		const int64 Before = Alloc.Allocate(); // caches a block under the default origin
+
+		FSolutionIdAllocator::SetProcessOrigin(3);
+		const int64 After = Alloc.Allocate();
+		const int64 Reserved = FUniqueSolutionComponent::GenerateNewId();
+		FSolutionIdAllocator::SetProcessOrigin(0);
+
+		ASSERT_THAT(AreEqual(int64(0), Before >> FSolutionIdAllocator::SequenceBits));
+		ASSERT_THAT(AreEqual(int64(3), After >> FSolutionIdAllocator::SequenceBits, TEXT("The stale cached block must not outlive the origin change")));
+		ASSERT_THAT(AreEqual(int64(3), Reserved >> FSolutionIdAllocator::SequenceBits));
+	}
+
+	TEST_METHOD(RecordBirth_Links_Parents_And_Increments_Generation)
+	{
+		entt::registry Registry;
+		auto MakeParent = [&Registry](int32 Generation, float Fitness)
+		{
+			const entt::entity E = Registry.create();
+			FUniqueSolutionComponent& Unique = Registry.emplace<FUniqueSolutionComponent>(E);
+			Unique.Id = FSolutionIdAllocator::Get(Registry).Allocate();
+			Unique.Generation = Generation;
+			FFitnessComponent Fit{};
+			Fit.Fitness.Add(Fitness);
+			Registry.emplace<FFitnessComponent>(E, MoveTemp(Fit));
+			return E;
+		};
+		const entt::entity ParentA = MakeParent(2, 10.0f);
+		const entt::entity ParentB = MakeParent(5, 20.0f);
+		const entt::entity Child = Registry.create();
+
+		FLineageArena::RecordBirth(Registry, Child, ParentA, ParentB, 0);
+
+		const FLineageArena& Arena = FLineageArena::Get(Registry);
+		ASSERT_THAT(AreEqual(1, Arena.NumResident(), TEXT("One birth should be recorded")));
+		const FLineageRecord& Row = Arena[0];
+		const FUniqueSolutionComponent& ChildUnique = Registry.get<FUniqueSolutionComponent>(Child);
+		ASSERT_THAT(AreEqual(ChildUnique.Id, Row.Id, TEXT("Row id should match the child's new id")));
+		ASSERT_THAT(AreEqual(Registry.get<FUniqueSolutionComponent>(ParentA).Id, Row.ParentA, TEXT("ParentA id should be recorded")));
+		ASSERT_THAT(AreEqual(Registry.get<FUniqueSolutionComponent>(ParentB).Id, Row.ParentB, TEXT("ParentB id should be recorded")));
+		ASSERT_THAT(AreEqual(6, ChildUnique.Generation, TEXT("Child generation should be max parent generation + 1")));
+		ASSERT_THAT(AreEqual(6, Row.Generation, TEXT("Row generation should match the child")));
+		ASSERT_THAT(IsNear(15.0f, Row.BirthFitness, 1e-6f, TEXT("Birth fitness should be the mean parent fitness")));
+	}
+
+	TEST_METHOD(Arena_Spans_Chunk_Boundary)
+	{
+		entt::registry Registry;
+		FLineageArena& Arena = FLineageArena::Get(Registry);
+		const int32 Count = FLineageArena::RecordsPerChunk + 3;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FLineageRecord Row;
+			Row.Id = i + 1;
+			Row.Generation = i;
+			Arena.Append(Row);
+		}
+
+		ASSERT_THAT(AreEqual(Count, Arena.NumResident(), TEXT("All rows should be resident")));
+		ASSERT_THAT(AreEqual(static_cast<int64>(Count), Arena.NumTotal(), TEXT("Total should match resident before spilling")));
+		ASSERT_THAT(AreEqual(static_cast<int64>(FLineageArena::RecordsPerChunk), Arena[FLineageArena::RecordsPerChunk - 1].Id, TEXT("Last row of the first chunk")));
+		ASSERT_THAT(AreEqual(static_cast<int64>(FLineageArena::RecordsPerChunk + 1), Arena[FLineageArena::RecordsPerChunk].Id, TEXT("First row of the second chunk")));
+		ASSERT_THAT(AreEqual(Count - 1, Arena[Count - 1].Generation, TEXT("Last row should be intact")));
+
+		Arena.Reset();
+		ASSERT_THAT(AreEqual(0, Arena.NumResident(), TEXT("Reset should drop all rows")));
+	}
+
+	TEST_METHOD(DiscardOldest_Keeps_The_Newest_Rows_Without_A_Spill_File)
+	{
+		entt::registry Registry;
+		FLineageArena& Arena = FLineageArena::Get(Registry);
+		const int32 Count = 3 * FLineageArena::RecordsPerChunk + 5;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FLineageRecord Row;
+			Row.Id = i + 1;
+			Arena.Append(Row);
+		}
+
+		Arena.DiscardOldest(FLineageArena::RecordsPerChunk);
+		ASSERT_THAT(AreEqual(FLineageArena::RecordsPerChunk + 5, Arena.NumResident(), TEXT("Only whole chunks are dropped; the cap is rounded up to a chunk")));
+		ASSERT_THAT(AreEqual(static_cast<int64>(Count), Arena.NumTotal(), TEXT("Discarded rows still count as appended")));
+		ASSERT_THAT(AreEqual(static_cast<int64>(2 * FLineageArena::RecordsPerChunk + 1), Arena[0].Id, TEXT("Oldest resident row follows the dropped chunks")));
+		ASSERT_THAT(AreEqual(static_cast<int64>(Count), Arena[Arena.NumResident() - 1].Id, TEXT("Newest row should be intact")));
+
+		// Recycled chunks take new births
+		for (int32 i = 0; i < FLineageArena::RecordsPerChunk; ++i)
+		{
+			FLineageRecord Row;
+			Row.Id = Count + i + 1;
+			Arena.Append(Row);
+		}
+		ASSERT_THAT(AreEqual(static_cast<int64>(Count + FLineageArena::RecordsPerChunk), Arena[Arena.NumResident() - 1].Id));
+	}
+};
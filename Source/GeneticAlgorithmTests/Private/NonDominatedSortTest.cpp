@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "Selection/NonDominatedSort.h"
+
+namespace
+{
+	// Reference ranking by repeatedly peeling off the non-dominated set (O(M N^3), tests only)
+	TArray<int32> BruteForceRanks(const TArray<float>& Objectives, int32 N, int32 M)
+	{
+		TArray<int32> Ranks;
+		Ranks.Init(INDEX_NONE, N);
+		int32 Remaining = N;
+		for (int32 Front = 0; Remaining > 0; ++Front)
+		{
+			TArray<int32> Current;
+			for (int32 i = 0; i < N; ++i)
+			{
+				if (Ranks[i] != INDEX_NONE)
+				{
+					continue;
+				}
+				bool bDominated = false;
+				for (int32 j = 0; j < N && !bDominated; ++j)
+				{
+					bDominated = Ranks[j] == INDEX_NONE && FNonDominatedSorter::Dominates(Objectives.GetData(), N, M, j, i);
+				}
+				if (!bDominated)
+				{
+					Current.Add(i);
+				}
+			}
+			for (const int32 i : Current)
+			{
+				Ranks[i] = Front;
+			}
+			Remaining -= Current.Num();
+		}
+		return Ranks;
+	}
+}
+
+TEST_CLASS(GeneticAlgorithm_NonDominatedSort_Tests, "GeneticAlgorithm.NonDominatedSort")
+{
+	TEST_METHOD(Two_Objectives_Known_Fronts)
+	{
+		// Column-major: f1 then f2. Points: (1,4) (2,2) (4,1) on front 0, (3,3) on front 1, (4,4) on front 2, duplicate (2,2) on front 0
+		const TArray<float> Objectives = { 1, 2, 4, 3, 4, 2,
+		                                   4, 2, 1, 3, 4, 2 };
+		FNonDominatedSorter Sorter;
+		TArray<int32> Ranks;
+		const int32 NumFronts = Sorter.Sort(Objectives, 6, 2, Ranks);
+
+		ASSERT_THAT(AreEqual(3, NumFronts, TEXT("Three fronts expected")));
+		const int32 Expected[] = { 0, 0, 0, 1, 2, 0 };
+		for (int32 i = 0; i < 6; ++i)
+		{
+			ASSERT_THAT(AreEqual(Expected[i], Ranks[i], TEXT("Front index mismatch")));
+		}
+	}
+
+	TEST_METHOD(Matches_Brute_Force_For_Many_Objectives)
+	{
+		FRandomStream Rng(2024);
+		FNonDominatedSorter Sorter;
+		TArray<int32> Ranks;
+		for (const int32 M : { 2, 3, 5 })
+		{
+			const int32 N = 300;
+			TArray<float> Objectives;
+			Objectives.SetNumUninitialized(N * M);
+			for (float& Value : Objectives)
+			{
+				// Coarse values produce plenty of ties and duplicates
+				Value = static_cast<float>(Rng.RandRange(0, 20));
+			}
+
+			Sorter.Sort(Objectives, N, M, Ranks);
+			const TArray<int32> Reference = BruteForceRanks(Objectives, N, M);
+			for (int32 i = 0; i < N; ++i)
+			{
+				ASSERT_THAT(AreEqual(Reference[i], Ranks[i], TEXT("Rank should match the brute-force reference")));
+			}
+		}
+	}
+
+	TEST_METHOD(Large_Single_Front_With_Three_Objectives)
+	{
+		// Every point on the plane f1 + f2 + f3 = 1 is non-dominated: the case where a front scan is quadratic
+		const int32 N = 20000;
+		const int32 M = 3;
+		FRandomStream Rng(7);
+		TArray<float> Objectives;
+		Objectives.SetNumUninitialized(N * M);
+		for (int32 i = 0; i < N; ++i)
+		{
+			const float A = Rng.FRand();
+			const float B = Rng.FRand();
+			const float C = Rng.FRand();
+			const float Sum = A + B + C + KINDA_SMALL_NUMBER;
+			Objectives[i] = A / Sum;
+			Objectives[N + i] = B / Sum;
+			Objectives[2 * N + i] = 1.0f - Objectives[i] - Objectives[N + i];
+		}
+		// The last point becomes the first one with every objective raised, so only the first front dominates it
+		Objectives[N - 1] = Objectives[0] + 0.5f;
+		Objectives[2 * N - 1] = Objectives[N] + 0.5f;
+		Objectives[3 * N - 1] = Objectives[2 * N] + 0.5f;
+
+		FNonDominatedSorter Sorter;
+		TArray<int32> Ranks;
+		Sorter.Sort(Objectives, N, M, Ranks);
+		ASSERT_THAT(AreEqual(1, Ranks[N - 1], TEXT("The raised copy sits behind its original")));
+		int32 FirstFront = 0;
+		for (int32 i = 0; i < N; ++i)
+		{
+			FirstFront += Ranks[i] == 0 ? 1 : 0;
+		}
+		ASSERT_THAT(AreEqual(N - 1, FirstFront, TEXT("Everything else is mutually non-dominated")));
+	}
+
+	TEST_METHOD(Crowding_Favors_Boundaries_And_Sparse_Points)
+	{
+		// Single front on the line f1 + f2 = 10, with x = 0, 1, 2, 6, 10
+		const TArray<float> Objectives = { 0, 1, 2, 6, 10,
+		                                   10, 9, 8, 4, 0 };
+		FNonDominatedSorter Sorter;
+		TArray<int32> Ranks;
+		TArray<float> Crowding;
+		ASSERT_THAT(AreEqual(1, Sorter.Sort(Objectives, 5, 2, Ranks), TEXT("All points are mutually non-dominated")));
+		Sorter.ComputeCrowding(Objectives, 5, 2, Crowding);
+
+		ASSERT_THAT(IsTrue(Crowding[0] >= TNumericLimits<float>::Max(), TEXT("Boundary point is infinitely crowded-distant")));
+		ASSERT_THAT(IsTrue(Crowding[4] >= TNumericLimits<float>::Max(), TEXT("Boundary point is infinitely crowded-distant")));
+		// Interior distance: sum over objectives of (next - prev) / range
+		ASSERT_THAT(IsNear(0.4f, Crowding[1], 1e-5f, TEXT("x=1 neighbours span 2 of 10 per objective")));
+		ASSERT_THAT(IsNear(1.0f, Crowding[2], 1e-5f, TEXT("x=2 neighbours span 5 of 10 per objective")));
+		ASSERT_THAT(IsTrue(Crowding[3] > Crowding[1], TEXT("Sparser points get larger distances")));
+	}
+};
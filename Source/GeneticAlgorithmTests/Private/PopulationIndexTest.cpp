@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "entt/entt.hpp"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+#include "PopulationIndex.h"
+
+TEST_CLASS(GeneticAlgorithm_PopulationIndex_Tests, "GeneticAlgorithm.PopulationIndex")
+{
+	entt::registry Registry;
+
+	AFTER_EACH()
+	{
+		FPopulationIndex::Release(Registry);
+		Registry.clear();
+	}
+
+	entt::entity CreateSolution(int32 Pop, float Value)
+	{
+		const entt::entity E = Registry.create();
+		FFitnessComponent Fit;
+		Fit.Fitness.SetNumZeroed(Pop + 1);
+		Fit.Fitness[Pop] = Value;
+		Fit.BuiltForFitnessIndex = Pop;
+		Registry.emplace<FFitnessComponent>(E, MoveTemp(Fit));
+		return E;
+	}
+
+	TEST_METHOD(Tracks_Membership_And_Aggregates_Per_Population)
+	{
+		FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+		CreateSolution(0, 10.0f);
+		CreateSolution(0, 30.0f);
+		CreateSolution(1, 5.0f);
+
+		ASSERT_THAT(AreEqual(2, Index.NumPopulations(), TEXT("Two populations should be known")));
+		ASSERT_THAT(AreEqual(2, Index.GetMembers(0).Num(), TEXT("Population 0 should have 2 members")));
+		ASSERT_THAT(AreEqual(1, Index.GetMembers(1).Num(), TEXT("Population 1 should have 1 member")));
+		ASSERT_THAT(IsNear(30.0f, Index.GetMaxFitness(0), 0.001f, TEXT("Population 0 max should be 30")));
+		ASSERT_THAT(IsNear(40.0, Index.GetTotalFitness(0), 0.001, TEXT("Population 0 total should be 40")));
+		ASSERT_THAT(IsNear(-MAX_FLT, Index.GetMaxFitness(5), 0.001f, TEXT("Unknown population should report -MAX_FLT")));
+	}
+
+	TEST_METHOD(Max_Recovers_When_Best_Is_Patched_Down_Or_Destroyed)
+	{
+		FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+		const entt::entity A = CreateSolution(0, 10.0f);
+		const entt::entity B = CreateSolution(0, 30.0f);
+		CreateSolution(0, 20.0f);
+
+		Registry.patch<FFitnessComponent>(B, [](FFitnessComponent& Fit) { Fit.Fitness[0] = 0.0f; });
+		ASSERT_THAT(IsNear(20.0f, Index.GetMaxFitness(0), 0.001f, TEXT("Max should fall back to the next best after a patch")));
+		ASSERT_THAT(IsNear(30.0, Index.GetTotalFitness(0), 0.001, TEXT("Total should follow the patched value")));
+
+		Registry.patch<FFitnessComponent>(A, [](FFitnessComponent& Fit) { Fit.Fitness[0] = 50.0f; });
+		ASSERT_THAT(IsNear(50.0f, Index.GetMaxFitness(0), 0.001f, TEXT("Max should rise immediately on a better patch")));
+
+		Registry.destroy(A);
+		ASSERT_THAT(IsNear(20.0f, Index.GetMaxFitness(0), 0.001f, TEXT("Max should be recomputed after the best is destroyed")));
+		ASSERT_THAT(AreEqual(2, Index.GetMembers(0).Num(), TEXT("Destroyed entity should leave the population")));
+	}
+
+	TEST_METHOD(Eligible_And_Elite_Sets_Follow_Tags)
+	{
+		FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+		const entt::entity A = CreateSolution(0, 1.0f);
+		const entt::entity B = CreateSolution(0, 2.0f);
+
+		Registry.emplace<FEligibleForBreedingTagComponent>(A);
+		Registry.emplace<FEligibleForBreedingTagComponent>(B);
+		Registry.emplace<FEliteTagComponent>(B);
+		ASSERT_THAT(AreEqual(2, Index.GetEligible(0).Num(), TEXT("Both entities should be eligible")));
+		ASSERT_THAT(AreEqual(1, Index.GetElites(0).Num(), TEXT("One entity should be elite")));
+		ASSERT_THAT(IsTrue(Index.IsElite(B), TEXT("B should be flagged elite")));
+
+		Registry.clear<FEligibleForBreedingTagComponent>();
+		ASSERT_THAT(AreEqual(0, Index.GetEligible(0).Num(), TEXT("Clearing the tag storage should empty the eligible set")));
+		ASSERT_THAT(AreEqual(1, Index.GetElites(0).Num(), TEXT("Elite set should be unaffected")));
+	}
+
+	TEST_METHOD(Backfills_Existing_Components_On_First_Use)
+	{
+		const entt::entity A = CreateSolution(2, 7.0f);
+		Registry.emplace<FEliteTagComponent>(A);
+		const entt::entity Unassigned = Registry.create();
+		Registry.emplace<FFitnessComponent>(Unassigned);
+
+		FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+		ASSERT_THAT(AreEqual(3, Index.NumPopulations(), TEXT("Population slots should cover index 2")));
+		ASSERT_THAT(AreEqual(1, Index.GetElites(2).Num(), TEXT("Pre-existing elite should be indexed")));
+		ASSERT_THAT(AreEqual(1, Index.NumUnassignedNonElites(), TEXT("Fitness without a valid population should be counted")));
+	}
+};
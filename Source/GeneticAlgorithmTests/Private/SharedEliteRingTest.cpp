@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "Farm/SharedEliteRing.h"
+#include "HAL/PlatformProcess.h"
+
+TEST_CLASS(GeneticAlgorithm_SharedEliteRing_Tests, "GeneticAlgorithm.Farm.SharedEliteRing")
+{
+	FString Name;
+	TUniquePtr<FSharedEliteRing> Owner;
+	TUniquePtr<FSharedEliteRing> Reader;
+
+	BEFORE_EACH()
+	{
+		Name = FString::Printf(TEXT("SimpleMLRingTest_%u"), FPlatformProcess::GetCurrentProcessId());
+		Owner = MakeUnique<FSharedEliteRing>();
+		Reader = MakeUnique<FSharedEliteRing>();
+		ASSERT_THAT(IsTrue(Owner->Create(Name, 4, 8), TEXT("Ring should be created")));
+		ASSERT_THAT(IsTrue(Reader->Open(Name, 4, 8), TEXT("A second mapping should attach to the same ring")));
+	}
+
+	AFTER_EACH()
+	{
+		Reader.Reset();
+		Owner.Reset();
+	}
+
+	TEST_METHOD(Published_Elites_Reach_Other_Processes_Only)
+	{
+		const TArray<float> Genome = { 1.0f, 2.0f, 3.0f };
+		ASSERT_THAT(IsTrue(Owner->Publish(0, 2, 77, 5.5f, Genome)));
+		ASSERT_THAT(IsTrue(Owner->Publish(1, 0, 78, 1.0f, Genome)));
+
+		uint64 Cursor = 0;
+		TArray<FSharedEliteRecord> Records;
+		ASSERT_THAT(AreEqual(1, Reader->Poll(1, Cursor, Records, 16), TEXT("Own records should be skipped")));
+		ASSERT_THAT(AreEqual(static_cast<uint64>(2), Cursor));
+		ASSERT_THAT(AreEqual(0, Records[0].SourceProcess));
+		ASSERT_THAT(AreEqual(2, Records[0].Population));
+		ASSERT_THAT(AreEqual(static_cast<int64>(77), Records[0].SolutionId));
+		ASSERT_THAT(IsNear(5.5f, Records[0].Fitness, 1e-6f));
+		ASSERT_THAT(AreEqual(3, Records[0].Genome.Num()));
+		ASSERT_THAT(IsNear(3.0f, Records[0].Genome[2], 1e-6f));
+
+		Records.Reset();
+		ASSERT_THAT(AreEqual(0, Reader->Poll(1, Cursor, Records, 16), TEXT("Nothing new since the last poll")));
+	}
+
+	TEST_METHOD(Lapped_Reader_Skips_Overwritten_Records)
+	{
+		const TArray<float> Genome = { 0.5f };
+		for (int32 i = 0; i < 10; ++i)
+		{
+			Owner->Publish(0, 0, i + 1, static_cast<float>(i), Genome);
+		}
+
+		uint64 Cursor = 0;
+		TArray<FSharedEliteRecord> Records;
+		ASSERT_THAT(AreEqual(4, Reader->Poll(1, Cursor, Records, 16), TEXT("Only the last NumSlots records survive")));
+		ASSERT_THAT(AreEqual(static_cast<int64>(7), Records[0].SolutionId));
+		ASSERT_THAT(AreEqual(static_cast<int64>(10), Records.Last().SolutionId));
+	}
+
+	TEST_METHOD(Oversized_Genomes_And_Layout_Mismatch_Are_Rejected)
+	{
+		TArray<float> TooLong;
+		TooLong.SetNumZeroed(9);
+		ASSERT_THAT(IsFalse(Owner->Publish(0, 0, 1, 0.0f, TooLong)));
+		ASSERT_THAT(AreEqual(static_cast<uint64>(0), Reader->GetWriteCursor()));
+
+		FSharedEliteRing Mismatch;
+		ASSERT_THAT(IsFalse(Mismatch.Open(Name, 8, 8), TEXT("Different slot count should refuse to attach")));
+	}
+
+	TEST_METHOD(Progress_Round_Trips_Per_Process)
+	{
+		FSharedFarmProgress Progress;
+		Progress.NumContexts = 2;
+		Progress.BestFitness = 42.0f;
+		Progress.Births = 1000;
+		Reader->WriteProgress(3, Progress);
+
+		TArray<FSharedFarmProgress> Read;
+		Owner->ReadProgress(Read);
+		ASSERT_THAT(AreEqual(1, Read.Num(), TEXT("Only written slots are reported")));
+		ASSERT_THAT(AreEqual(3, Read[0].ProcessIndex));
+		ASSERT_THAT(AreEqual(2, Read[0].NumContexts));
+		ASSERT_THAT(IsNear(42.0f, Read[0].BestFitness, 1e-6f));
+		ASSERT_THAT(AreEqual(static_cast<int64>(1000), Read[0].Births));
+	}
+};
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "Statistics/StreamingStats.h"
+#include "Statistics/QuantileSketch.h"
+#include "Statistics/FixedRingBuffer.h"
+
+TEST_CLASS(GeneticAlgorithm_Statistics_Tests, "GeneticAlgorithm.Statistics")
+{
+	TEST_METHOD(StreamingStats_Merge_Matches_Single_Pass)
+	{
+		FStreamingStats All;
+		FStreamingStats Left;
+		FStreamingStats Right;
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			const double Value = FMath::Sin(static_cast<double>(i)) * 10.0 + i * 0.01;
+			All.Add(Value);
+			(i < 300 ? Left : Right).Add(Value);
+		}
+		Left.Merge(Right);
+
+		ASSERT_THAT(AreEqual(All.GetCount(), Left.GetCount(), TEXT("Merged count should match")));
+		ASSERT_THAT(IsNear(All.GetMean(), Left.GetMean(), 1e-9, TEXT("Merged mean should match")));
+		ASSERT_THAT(IsNear(All.GetVariance(), Left.GetVariance(), 1e-6, TEXT("Merged variance should match")));
+		ASSERT_THAT(IsNear(All.GetMin(), Left.GetMin(), 1e-12, TEXT("Merged min should match")));
+		ASSERT_THAT(IsNear(All.GetMax(), Left.GetMax(), 1e-12, TEXT("Merged max should match")));
+	}
+
+	TEST_METHOD(QuantileSketch_Approximates_Uniform_Quantiles)
+	{
+		FRandomStream Rng(777);
+		FQuantileSketch Sketch(100.0);
+		for (int32 i = 0; i < 20000; ++i)
+		{
+			Sketch.Add(Rng.FRandRange(0.0f, 1000.0f));
+		}
+
+		ASSERT_THAT(IsTrue(Sketch.NumCentroids() <= 200, TEXT("Sketch size should stay bounded by the compression")));
+		ASSERT_THAT(IsNear(500.0, Sketch.Quantile(0.5), 15.0, TEXT("Median should be near 500")));
+		ASSERT_THAT(IsNear(50.0, Sketch.Quantile(0.05), 5.0, TEXT("5th percentile should be near 50")));
+		ASSERT_THAT(IsNear(950.0, Sketch.Quantile(0.95), 5.0, TEXT("95th percentile should be near 950")));
+		ASSERT_THAT(IsNear(0.25, Sketch.Cdf(250.0), 0.02, TEXT("CDF at 250 should be near 0.25")));
+	}
+
+	TEST_METHOD(QuantileSketch_Merge_Covers_Both_Inputs)
+	{
+		FQuantileSketch Low;
+		FQuantileSketch High;
+		for (int32 i = 0; i < 5000; ++i)
+		{
+			Low.Add(static_cast<double>(i));
+			High.Add(static_cast<double>(5000 + i));
+		}
+		Low.Merge(High);
+
+		ASSERT_THAT(IsNear(10000.0, Low.GetTotalWeight(), 1e-9, TEXT("Merged weight should be the sum")));
+		ASSERT_THAT(IsNear(0.0, Low.GetMin(), 1e-9, TEXT("Merged min should come from the low sketch")));
+		ASSERT_THAT(IsNear(9999.0, Low.GetMax(), 1e-9, TEXT("Merged max should come from the high sketch")));
+		ASSERT_THAT(IsNear(5000.0, Low.Quantile(0.5), 100.0, TEXT("Merged median should sit between the inputs")));
+	}
+
+	TEST_METHOD(RingBuffer_Keeps_Newest_In_Order)
+	{
+		TFixedRingBuffer<float> Ring;
+		Ring.SetCapacity(3);
+		for (int32 i = 1; i <= 5; ++i)
+		{
+			Ring.Add(static_cast<float>(i));
+		}
+
+		TArray<float> Out;
+		Ring.CopyTo(Out);
+		ASSERT_THAT(AreEqual(3, Out.Num(), TEXT("Ring should hold capacity samples")));
+		ASSERT_THAT(IsNear(3.0f, Out[0], 0.0f, TEXT("Oldest kept sample should be 3")));
+		ASSERT_THAT(IsNear(5.0f, Out[2], 0.0f, TEXT("Newest sample should be last")));
+
+		Ring.SetCapacity(2);
+		ASSERT_THAT(AreEqual(2, Ring.Num(), TEXT("Shrinking should keep the newest samples")));
+		ASSERT_THAT(IsNear(4.0f, Ring[0], 0.0f, TEXT("Oldest sample after shrink should be 4")));
+	}
+};
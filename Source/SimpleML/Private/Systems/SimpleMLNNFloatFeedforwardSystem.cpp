@@ -8,8 +8,8 @@ THIRD_PARTY_INCLUDES_END
 
 void USimpleMLNNFloatFeedforwardSystem::Update_Implementation(float DeltaTime)
 {
-	// Operate on entities that have a network and the IO components
-	auto View = GetView<FNeuralNetworkFloat, FNNInFLoatComp, FNNOutFloatComp>();
+	// Operate on entities that have a network and the IO components (and are not deferred by a scheduler)
+	auto View = GetRegistry().view<FNeuralNetworkFloat, FNNInFLoatComp, FNNOutFloatComp>(entt::exclude<FNNSkipEvaluationTag, FNNHoldOutputTag, FNNExternalEvaluationTag>);
 	for (auto Entity : View)
 	{
 		FNeuralNetworkFloat& NetComp = View.get<FNeuralNetworkFloat>(Entity);
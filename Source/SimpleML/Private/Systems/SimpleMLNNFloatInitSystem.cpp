@@ -1,10 +1,13 @@
 ﻿// Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License.
 
 #include "Systems/SimpleMLNNFloatInitSystem.h"
+#include "Async/ParallelFor.h"
 
 void USimpleMLNNFloatInitSystem::Update_Implementation(float DeltaTime)
 {
-	// Iterate over all entities with a float neural network and initialize weights/biases only
+	// Gather every float neural network that still needs its weights/biases
+	PendingNetworks.Reset();
+	PendingSeeds.Reset();
 	auto View = GetView<FNeuralNetworkFloat>();
 	for (auto Entity : View)
 	{
@@ -14,9 +17,16 @@ void USimpleMLNNFloatInitSystem::Update_Implementation(float DeltaTime)
 			// Initialize weights/biases with a unique seed per entity to ensure diversity in population.
 			// Combine the global context seed with the entity index.
 			const int32 EntityId = static_cast<int32>(entt::to_integral(Entity));
-			const int32 FinalSeed = ContextSeed + EntityId;
-			Comp.Network.InitializeWeightsUniform(static_cast<float>(-1.0f), static_cast<float>(1.0f), FinalSeed);
-			Comp.Network.bIsInitialized = true;
+			PendingNetworks.Add(&Comp.Network);
+			PendingSeeds.Add(ContextSeed + EntityId);
 		}
 	}
+
+	// Each network owns its buffer and random stream, so they initialize independently on worker threads
+	ParallelFor(PendingNetworks.Num(), [this](int32 Index)
+	{
+		TNeuralNetwork<float, FNeuron>& Network = *PendingNetworks[Index];
+		Network.InitializeWeightsUniform(static_cast<float>(-1.0f), static_cast<float>(1.0f), PendingSeeds[Index]);
+		Network.bIsInitialized = true;
+	});
 }
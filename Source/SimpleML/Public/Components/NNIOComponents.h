@@ -15,6 +15,15 @@ struct SIMPLEML_API FNNInFLoatComp
 	TArray<float> Values;
 };
 
+// Tag: skip this entity's evaluation this tick (set by schedulers that evaluate a subset of agents per tick)
+struct FNNSkipEvaluationTag {};
+
+// Tag: hold this entity's last outputs this tick (action repeat); FNNOutFloatComp is not recomputed and consumers keep applying it
+struct FNNHoldOutputTag {};
+
+// Tag: evaluated outside the ECS chain (e.g. on the physics thread); feedforward and IO systems leave it alone
+struct FNNExternalEvaluationTag {};
+
 // Minimal output component carrying a float array for NN outputs
 USTRUCT(BlueprintType)
 struct SIMPLEML_API FNNOutFloatComp
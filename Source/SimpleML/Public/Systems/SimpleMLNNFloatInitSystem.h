@@ -25,4 +25,9 @@ public:
 	/** Base seed from the context to ensure diversity in multi-context setups */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NeuralNetwork|Initialization")
 	int32 ContextSeed = 0;
+
+private:
+	// Reusable caches to avoid per-tick allocations
+	TArray<TNeuralNetwork<float, FNeuron>*> PendingNetworks;
+	TArray<int32> PendingSeeds;
 };
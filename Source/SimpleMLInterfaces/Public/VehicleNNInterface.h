@@ -6,6 +6,33 @@
 #include "UObject/Interface.h"
 #include "VehicleNNInterface.generated.h"
 
+/**
+ * Fixed-size snapshot of the vehicle state the NN reads each tick, filled by IVehicleNNInterface::FillTelemetry.
+ * Plain data with no heap members, so callers keep one on the stack (or in a reusable array) per vehicle.
+ */
+struct FVehicleTelemetry
+{
+	/** Wheels carried per vehicle; extra wheels are ignored, missing ones read as 0 */
+	static constexpr int32 MaxWheels = 4;
+
+	/** Forward gear count NormalizedGear is expressed against */
+	static constexpr int32 ReferenceGearCount = 6;
+
+	float WheelsOnGroundRatio = 1.0f;
+
+	/** Per wheel: 1.0 = firmly on ground, 0.0 = in air */
+	float WheelContact[MaxWheels] = {};
+
+	/** Per wheel: 0.0 = fully extended, 1.0 = fully compressed */
+	float WheelCompression[MaxWheels] = {};
+
+	/** 0.0 = idle, 1.0 = redline */
+	float NormalizedRPM = 0.0f;
+
+	/** 0.0 = reverse/idle, 1.0 = top gear (of ReferenceGearCount) */
+	float NormalizedGear = 0.5f;
+};
+
 /**
  * Interface for vehicles that provide neural network input data.
  *
@@ -29,6 +56,38 @@ class SIMPLEMLINTERFACES_API IVehicleNNInterface
 public:
 	virtual void ApplyNNOutputs(TArrayView<const float> Outputs) = 0;
 
+	/**
+	 * Physics-thread variant used by the trainer's async physics control mode, called from the Chaos pre-simulate
+	 * callback at the control rate. Must only touch physics-thread state (e.g. the vehicle simulation's own inputs).
+	 * Return false when unsupported (the default): the trainer then applies the outputs with ApplyNNOutputs on the
+	 * game thread.
+	 */
+	virtual bool ApplyNNOutputs_Internal(TArrayView<const float> Outputs) { return false; }
+
+	/**
+	 * Writes every telemetry value in one call; this is what the trainer's input system uses.
+	 * Override it for allocation-free telemetry. The default gathers the individual getters below,
+	 * so vehicles that only implement those keep working (at the cost of two temporary arrays).
+	 */
+	virtual void FillTelemetry(FVehicleTelemetry& Out) const
+	{
+		Out.WheelsOnGroundRatio = GetWheelsOnGroundRatio();
+		Out.NormalizedRPM = GetNormalizedRPM();
+		Out.NormalizedGear = GetNormalizedGear(FVehicleTelemetry::ReferenceGearCount);
+
+		TArray<float> PerWheel;
+		GetWheelContactStates(PerWheel);
+		for (int32 i = 0; i < FVehicleTelemetry::MaxWheels; ++i)
+		{
+			Out.WheelContact[i] = i < PerWheel.Num() ? PerWheel[i] : 0.0f;
+		}
+		GetWheelSuspensionCompression(PerWheel);
+		for (int32 i = 0; i < FVehicleTelemetry::MaxWheels; ++i)
+		{
+			Out.WheelCompression[i] = i < PerWheel.Num() ? PerWheel[i] : 0.0f;
+		}
+	}
+
 	virtual float GetWheelsOnGroundRatio() const { return 1.0f; }
 
 	/**
@@ -0,0 +1,267 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Commandlets/VehicleTrainingCommandlet.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "TrainerCheckpoint.h"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+UVehicleTrainingCommandlet::UVehicleTrainingCommandlet()
+{
+	IsClient = false;
+	IsServer = true;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+UWorld* UVehicleTrainingCommandlet::LoadWorld(const FString& MapName) const
+{
+	UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	World->WorldType = EWorldType::Game;
+	World->AddToRoot();
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+			.AllowAudioPlayback(false)
+			.RequiresHitProxies(false)
+			.CreatePhysicsScene(true)
+			.ShouldSimulatePhysics(true)
+			.EnableTraceCollision(true)
+			.CreateFXSystem(false)
+			.SetTransactional(false));
+	}
+	World->UpdateWorldComponents(true, false);
+	World->InitializeActorsForPlay(FURL());
+	return World;
+}
+
+void UVehicleTrainingCommandlet::UnloadWorld(UWorld* World) const
+{
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+}
+
+bool UVehicleTrainingCommandlet::GetBestFitness(TConstArrayView<AVehicleTrainerContext*> Contexts, float& OutBest) const
+{
+	bool bFound = false;
+	for (AVehicleTrainerContext* Context : Contexts)
+	{
+		const bool bHigherIsBetter = Context->TrainerConfig->bHigherIsBetter;
+		auto EliteView = Context->GetRegistry().view<FEliteTagComponent, FFitnessComponent>();
+		for (const entt::entity Entity : EliteView)
+		{
+			const FFitnessComponent& Fit = EliteView.get<FFitnessComponent>(Entity);
+			if (!Fit.Fitness.IsValidIndex(Fit.BuiltForFitnessIndex))
+			{
+				continue;
+			}
+			const float Value = Fit.Fitness[Fit.BuiltForFitnessIndex];
+			if (!bFound || (bHigherIsBetter ? Value > OutBest : Value < OutBest))
+			{
+				OutBest = Value;
+				bFound = true;
+			}
+		}
+	}
+	return bFound;
+}
+
+FString UVehicleTrainingCommandlet::CheckpointPath(const FString& Name, const AVehicleTrainerContext* Context) const
+{
+	return FPaths::ProjectSavedDir() / TEXT("Training") / FString::Printf(TEXT("%s_%d.ckpt"), *Name, Context->ContextIndex);
+}
+
+void UVehicleTrainingCommandlet::WriteCheckpoints(TConstArrayView<AVehicleTrainerContext*> Contexts, const FString& Name, double SimTime) const
+{
+	FTrainerCheckpoint Checkpoint;
+	for (AVehicleTrainerContext* Context : Contexts)
+	{
+		Checkpoint.Capture(Context->GetRegistry(), SimTime);
+		if (Checkpoint.Save(CheckpointPath(Name, Context)))
+		{
+			UE_LOG(LogTemp, Log, TEXT("VehicleTraining: checkpoint of context %d (%d elites) at %.0fs sim time."),
+				Context->ContextIndex, Checkpoint.Elites.Num(), SimTime);
+		}
+	}
+}
+
+int32 UVehicleTrainingCommandlet::Main(const FString& Params)
+{
+	FString MapName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapName))
+	{
+		UE_LOG(LogTemp, Error, TEXT("VehicleTraining: -Map=<package> is required."));
+		return 1;
+	}
+
+	FString ConfigPath;
+	FString CheckpointName = TEXT("VehicleTraining");
+	FString ResumeName;
+	float FixedStep = 1.0f / 60.0f;
+	double MaxSimSeconds = 0.0;
+	double MaxWallSeconds = 0.0;
+	double CheckpointInterval = 600.0;
+	float TargetFitness = 0.0f;
+	FParse::Value(*Params, TEXT("Config="), ConfigPath);
+	FParse::Value(*Params, TEXT("Checkpoint="), CheckpointName);
+	FParse::Value(*Params, TEXT("Resume="), ResumeName);
+	FParse::Value(*Params, TEXT("FixedStep="), FixedStep);
+	FParse::Value(*Params, TEXT("MaxSimSeconds="), MaxSimSeconds);
+	FParse::Value(*Params, TEXT("MaxWallSeconds="), MaxWallSeconds);
+	FParse::Value(*Params, TEXT("CheckpointInterval="), CheckpointInterval);
+	const bool bHasTargetFitness = FParse::Value(*Params, TEXT("TargetFitness="), TargetFitness);
+	FixedStep = FMath::Max(FixedStep, 1e-4f);
+
+	UVehicleTrainerConfig* ConfigOverride = nullptr;
+	if (!ConfigPath.IsEmpty())
+	{
+		ConfigOverride = LoadObject<UVehicleTrainerConfig>(nullptr, *ConfigPath);
+		if (!ConfigOverride)
+		{
+			UE_LOG(LogTemp, Error, TEXT("VehicleTraining: cannot load config '%s'."), *ConfigPath);
+			return 1;
+		}
+	}
+
+	UWorld* World = LoadWorld(MapName);
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("VehicleTraining: cannot load map '%s'."), *MapName);
+		return 1;
+	}
+
+	// Every system that reads FApp delta time sees the same fixed step as the world
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(FixedStep);
+
+	TArray<AVehicleTrainerContext*> Contexts;
+	for (TActorIterator<AVehicleTrainerContext> It(World); It; ++It)
+	{
+		AVehicleTrainerContext* Context = *It;
+		if (ConfigOverride)
+		{
+			Context->TrainerConfig = ConfigOverride;
+		}
+		if (!Context->TrainerConfig)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("VehicleTraining: context %s has no TrainerConfig; skipped."), *Context->GetName());
+			continue;
+		}
+		Context->TrainerConfig->bDebugInfo = false;
+		if (Context->ContextIndex < 0)
+		{
+			Context->ContextIndex = Contexts.Num();
+		}
+		Contexts.Add(Context);
+	}
+	if (Contexts.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("VehicleTraining: map '%s' has no AVehicleTrainerContext with a config."), *MapName);
+		UnloadWorld(World);
+		return 1;
+	}
+
+	// Without a game mode the world settings dispatch BeginPlay to the level's actors
+	World->BeginPlay();
+	if (!World->HasBegunPlay())
+	{
+		World->GetWorldSettings()->NotifyBeginPlay();
+	}
+
+	if (!ResumeName.IsEmpty())
+	{
+		for (AVehicleTrainerContext* Context : Contexts)
+		{
+			FTrainerCheckpoint Checkpoint;
+			if (Checkpoint.Load(CheckpointPath(ResumeName, Context)))
+			{
+				const UVehicleTrainerConfig* Config = Context->TrainerConfig;
+				const int32 Restored = Checkpoint.Restore(Context->GetRegistry(), Config->NumPopulations, Config->EliteCount, Config->bHigherIsBetter, Config->GetGenomeFloatCount());
+				UE_LOG(LogTemp, Log, TEXT("VehicleTraining: context %d resumed %d elites."), Context->ContextIndex, Restored);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("VehicleTraining: %d contexts, fixed step %.4fs, budgets sim %.0fs / wall %.0fs%s."),
+		Contexts.Num(), FixedStep, MaxSimSeconds, MaxWallSeconds,
+		bHasTargetFitness ? *FString::Printf(TEXT(" / fitness %.3f"), TargetFitness) : TEXT(""));
+
+	const double WallStart = FPlatformTime::Seconds();
+	const bool bHigherIsBetter = Contexts[0]->TrainerConfig->bHigherIsBetter;
+	double SimTime = 0.0;
+	double NextCheckpoint = CheckpointInterval;
+	double NextReport = 60.0;
+	const TCHAR* StopReason = TEXT("engine exit requested");
+
+	while (!IsEngineExitRequested())
+	{
+		World->Tick(LEVELTICK_All, FixedStep);
+		FTSTicker::GetCoreTicker().Tick(FixedStep);
+		++GFrameCounter;
+		SimTime += FixedStep;
+
+		if (SimTime >= NextCheckpoint && CheckpointInterval > 0.0)
+		{
+			NextCheckpoint += CheckpointInterval;
+			WriteCheckpoints(Contexts, CheckpointName, SimTime);
+		}
+
+		// Budgets are cheap to test but the fitness scan walks every registry, so only once per sim second
+		const bool bSecondBoundary = FMath::FloorToInt64(SimTime) != FMath::FloorToInt64(SimTime - FixedStep);
+		if (!bSecondBoundary)
+		{
+			continue;
+		}
+		const double WallTime = FPlatformTime::Seconds() - WallStart;
+		float Best = 0.0f;
+		const bool bHasBest = GetBestFitness(Contexts, Best);
+		if (SimTime >= NextReport)
+		{
+			NextReport += 60.0;
+			UE_LOG(LogTemp, Log, TEXT("VehicleTraining: sim %.0fs, wall %.0fs (x%.1f), best elite fitness %s"),
+				SimTime, WallTime, SimTime / FMath::Max(WallTime, 1e-3), bHasBest ? *FString::SanitizeFloat(Best) : TEXT("n/a"));
+		}
+		if (MaxSimSeconds > 0.0 && SimTime >= MaxSimSeconds)
+		{
+			StopReason = TEXT("sim-time budget reached");
+			break;
+		}
+		if (MaxWallSeconds > 0.0 && WallTime >= MaxWallSeconds)
+		{
+			StopReason = TEXT("wall-time budget reached");
+			break;
+		}
+		if (bHasTargetFitness && bHasBest && (bHigherIsBetter ? Best >= TargetFitness : Best <= TargetFitness))
+		{
+			StopReason = TEXT("target fitness reached");
+			break;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("VehicleTraining: stopping after %.0fs sim time (%s)."), SimTime, StopReason);
+	WriteCheckpoints(Contexts, CheckpointName, SimTime);
+	UnloadWorld(World);
+	return 0;
+}
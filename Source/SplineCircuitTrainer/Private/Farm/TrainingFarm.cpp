@@ -0,0 +1,310 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Farm/TrainingFarm.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Lineage/SolutionIdAllocator.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace TrainingFarm
+{
+	const TCHAR* RingArg = TEXT("TrainingFarmRing=");
+	const TCHAR* WorkerArg = TEXT("TrainingFarmWorker=");
+	const TCHAR* SlotsArg = TEXT("TrainingFarmSlots=");
+	const TCHAR* FloatsArg = TEXT("TrainingFarmGenomeFloats=");
+}
+
+// ---------------------------------------------------------------------------
+// Worker
+// ---------------------------------------------------------------------------
+
+FTrainingFarmWorker* FTrainingFarmWorker::Get()
+{
+	// Resolved once per process; contexts only ever touch it from the game thread
+	static TUniquePtr<FTrainingFarmWorker> Instance;
+	static bool bResolved = false;
+	if (bResolved)
+	{
+		return Instance.Get();
+	}
+	bResolved = true;
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FString RingName;
+	int32 WorkerIndex = INDEX_NONE;
+	if (!FParse::Value(CommandLine, TrainingFarm::RingArg, RingName) || !FParse::Value(CommandLine, TrainingFarm::WorkerArg, WorkerIndex))
+	{
+		return nullptr;
+	}
+	int32 NumSlots = FTrainingFarmSettings().RingSlots;
+	int32 MaxGenomeFloats = FTrainingFarmSettings().MaxGenomeFloats;
+	FParse::Value(CommandLine, TrainingFarm::SlotsArg, NumSlots);
+	FParse::Value(CommandLine, TrainingFarm::FloatsArg, MaxGenomeFloats);
+
+	if (WorkerIndex < 0 || WorkerIndex >= FSharedEliteRing::MaxProcesses)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TrainingFarm: worker index %d out of range; running standalone."), WorkerIndex);
+		return nullptr;
+	}
+
+	TUniquePtr<FTrainingFarmWorker> Worker = MakeUnique<FTrainingFarmWorker>();
+	if (!Worker->Ring.Open(RingName, NumSlots, MaxGenomeFloats))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TrainingFarm: could not attach to ring '%s'; running standalone."), *RingName);
+		return nullptr;
+	}
+	Worker->WorkerIndex = WorkerIndex;
+	Worker->StartTime = FPlatformTime::Seconds();
+
+	// Keep solution ids disjoint across processes so migrated elites never collide with local ones
+	FSolutionIdAllocator::SetProcessOrigin(WorkerIndex + 1);
+
+	UE_LOG(LogTemp, Log, TEXT("TrainingFarm: worker %d attached to ring '%s'."), WorkerIndex, *RingName);
+	Instance = MoveTemp(Worker);
+	return Instance.Get();
+}
+
+void FTrainingFarmWorker::ReportContextProgress(const void* ContextKey, const FSharedFarmProgress& Progress)
+{
+	ContextProgress.Add(ContextKey, Progress);
+	PublishProgress();
+}
+
+void FTrainingFarmWorker::RemoveContext(const void* ContextKey)
+{
+	if (ContextProgress.Remove(ContextKey) > 0)
+	{
+		PublishProgress();
+	}
+}
+
+void FTrainingFarmWorker::PublishProgress()
+{
+	FSharedFarmProgress Total;
+	Total.NumContexts = ContextProgress.Num();
+	Total.UptimeSeconds = FPlatformTime::Seconds() - StartTime;
+	bool bFirst = true;
+	for (const TPair<const void*, FSharedFarmProgress>& It : ContextProgress)
+	{
+		const FSharedFarmProgress& Context = It.Value;
+		// Progress aggregation assumes higher fitness is better (the trainer default)
+		Total.BestFitness = bFirst ? Context.BestFitness : FMath::Max(Total.BestFitness, Context.BestFitness);
+		Total.MeanEliteFitness += Context.MeanEliteFitness / ContextProgress.Num();
+		Total.Births += Context.Births;
+		Total.ElitesPublished += Context.ElitesPublished;
+		Total.ElitesInjected += Context.ElitesInjected;
+		bFirst = false;
+	}
+	Ring.WriteProgress(WorkerIndex, Total);
+}
+
+// ---------------------------------------------------------------------------
+// Coordinator
+// ---------------------------------------------------------------------------
+
+FTrainingFarmCoordinator::~FTrainingFarmCoordinator()
+{
+	Stop();
+}
+
+bool FTrainingFarmCoordinator::Start(const FTrainingFarmSettings& InSettings)
+{
+	Stop();
+	Settings = InSettings;
+	Settings.NumWorkers = FMath::Clamp(Settings.NumWorkers, 1, FSharedEliteRing::MaxProcesses);
+	if (Settings.RingName.IsEmpty())
+	{
+		Settings.RingName = FString::Printf(TEXT("SimpleMLFarm_%u"), FPlatformProcess::GetCurrentProcessId());
+	}
+
+	if (!Ring.Create(Settings.RingName, Settings.RingSlots, Settings.MaxGenomeFloats))
+	{
+		return false;
+	}
+
+	const FString Executable = FPlatformProcess::ExecutablePath();
+	for (int32 i = 0; i < Settings.NumWorkers; ++i)
+	{
+		const FString Args = BuildWorkerArgs(i);
+		FProcHandle Handle = FPlatformProcess::CreateProc(*Executable, *Args, true, true, true, nullptr, 0, nullptr, nullptr);
+		if (!Handle.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("TrainingFarm: failed to launch worker %d (%s %s)."), i, *Executable, *Args);
+			continue;
+		}
+		Workers.Add(Handle);
+	}
+
+	if (Workers.Num() == 0)
+	{
+		Ring.Close();
+		return false;
+	}
+
+	NextLogTime = FPlatformTime::Seconds() + Settings.ProgressLogInterval;
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTrainingFarmCoordinator::Tick), 1.0f);
+	UE_LOG(LogTemp, Log, TEXT("TrainingFarm: launched %d workers on ring '%s'."), Workers.Num(), *Settings.RingName);
+	return true;
+}
+
+FString FTrainingFarmCoordinator::BuildWorkerArgs(int32 WorkerIndex) const
+{
+	FString Args;
+	if (FPaths::IsProjectFilePathSet())
+	{
+		Args += FString::Printf(TEXT("\"%s\" "), *FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()));
+	}
+	if (Settings.bHeadlessCommandlet && !Settings.MapName.IsEmpty())
+	{
+		Args += FString::Printf(TEXT("-run=VehicleTraining -Map=%s -Checkpoint=FarmWorker%d "), *Settings.MapName, WorkerIndex);
+	}
+	else
+	{
+		if (!Settings.MapName.IsEmpty())
+		{
+			Args += Settings.MapName + TEXT(" ");
+		}
+		if (GIsEditor)
+		{
+			Args += TEXT("-game ");
+		}
+	}
+	Args += FString::Printf(TEXT("-nullrhi -nosound -unattended -nosplash -log=TrainingFarmWorker_%d.log -%s%s -%s%d -%s%d -%s%d"),
+		WorkerIndex,
+		TrainingFarm::RingArg, *Settings.RingName,
+		TrainingFarm::WorkerArg, WorkerIndex,
+		TrainingFarm::SlotsArg, Settings.RingSlots,
+		TrainingFarm::FloatsArg, Settings.MaxGenomeFloats);
+	if (!Settings.ExtraArgs.IsEmpty())
+	{
+		Args += TEXT(" ") + Settings.ExtraArgs;
+	}
+	return Args;
+}
+
+int32 FTrainingFarmCoordinator::NumRunningWorkers() const
+{
+	int32 Running = 0;
+	for (const FProcHandle& Handle : Workers)
+	{
+		FProcHandle Copy = Handle;
+		Running += FPlatformProcess::IsProcRunning(Copy) ? 1 : 0;
+	}
+	return Running;
+}
+
+bool FTrainingFarmCoordinator::Tick(float /*DeltaTime*/)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (Now >= NextLogTime)
+	{
+		NextLogTime = Now + Settings.ProgressLogInterval;
+		LogProgress();
+	}
+	if (NumRunningWorkers() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TrainingFarm: all workers exited; stopping."));
+		TickHandle.Reset();
+		Stop();
+		return false;
+	}
+	return true;
+}
+
+void FTrainingFarmCoordinator::LogProgress() const
+{
+	TArray<FSharedFarmProgress> Progress;
+	Ring.ReadProgress(Progress);
+
+	int32 Contexts = 0;
+	int64 Births = 0;
+	int64 Published = 0;
+	int64 Injected = 0;
+	float Best = 0.0f;
+	int32 BestWorker = INDEX_NONE;
+	for (const FSharedFarmProgress& Worker : Progress)
+	{
+		Contexts += Worker.NumContexts;
+		Births += Worker.Births;
+		Published += Worker.ElitesPublished;
+		Injected += Worker.ElitesInjected;
+		if (Worker.NumContexts > 0 && (BestWorker == INDEX_NONE || Worker.BestFitness > Best))
+		{
+			Best = Worker.BestFitness;
+			BestWorker = Worker.ProcessIndex;
+		}
+	}
+	UE_LOG(LogTemp, Log, TEXT("TrainingFarm: %d/%d workers running, %d reporting, %d contexts | best %.3f (worker %d) | births %lld | elites published %lld, injected %lld"),
+		NumRunningWorkers(), Workers.Num(), Progress.Num(), Contexts, Best, BestWorker, Births, Published, Injected);
+}
+
+void FTrainingFarmCoordinator::Stop()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+	for (FProcHandle& Handle : Workers)
+	{
+		if (FPlatformProcess::IsProcRunning(Handle))
+		{
+			FPlatformProcess::TerminateProc(Handle, true);
+		}
+		FPlatformProcess::CloseProc(Handle);
+	}
+	Workers.Reset();
+	Ring.Close();
+}
+
+// ---------------------------------------------------------------------------
+// Console
+// ---------------------------------------------------------------------------
+
+namespace TrainingFarm
+{
+	static TUniquePtr<FTrainingFarmCoordinator> Coordinator;
+
+	static FAutoConsoleCommand StartCommand(
+		TEXT("SimpleML.Farm.Start"),
+		TEXT("Launches headless training workers sharing elites: SimpleML.Farm.Start [NumWorkers] [Map]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FTrainingFarmSettings Settings;
+			if (Args.Num() > 0)
+			{
+				LexFromString(Settings.NumWorkers, *Args[0]);
+			}
+			if (Args.Num() > 1)
+			{
+				Settings.MapName = Args[1];
+			}
+			Coordinator = MakeUnique<FTrainingFarmCoordinator>();
+			if (!Coordinator->Start(Settings))
+			{
+				Coordinator.Reset();
+			}
+		}));
+
+	static FAutoConsoleCommand StatusCommand(
+		TEXT("SimpleML.Farm.Status"),
+		TEXT("Logs aggregated progress of the running training farm"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			if (Coordinator && Coordinator->IsRunning())
+			{
+				Coordinator->LogProgress();
+			}
+		}));
+
+	static FAutoConsoleCommand StopCommand(
+		TEXT("SimpleML.Farm.Stop"),
+		TEXT("Terminates all training farm workers"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			Coordinator.Reset();
+		}));
+}
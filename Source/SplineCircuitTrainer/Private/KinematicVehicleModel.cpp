@@ -0,0 +1,197 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "KinematicVehicleModel.h"
+#include "Components/KinematicVehicleComponent.h"
+
+FKinematicVehicleBatch& FKinematicVehicleBatch::Get(entt::registry& Registry)
+{
+	if (FKinematicVehicleBatch* Existing = Registry.ctx().find<FKinematicVehicleBatch>())
+	{
+		return *Existing;
+	}
+
+	// Stored on the heap by the context (too large for the small buffer), so the bound address stays stable
+	FKinematicVehicleBatch& Batch = Registry.ctx().emplace<FKinematicVehicleBatch>();
+	Registry.on_destroy<FKinematicVehicleComponent>().connect<&FKinematicVehicleBatch::OnComponentDestroyed>(Batch);
+	return Batch;
+}
+
+void FKinematicVehicleBatch::OnComponentDestroyed(entt::registry& Registry, entt::entity Entity)
+{
+	const int32 Slot = Registry.get<FKinematicVehicleComponent>(Entity).Slot;
+	if (X.IsValidIndex(Slot))
+	{
+		Remove(Slot);
+	}
+}
+
+int32 FKinematicVehicleBatch::Add(const FVector& LocationCm, float YawRadians)
+{
+	if (FreeSlots.Num() > 0)
+	{
+		// Released rows already hold zero controls
+		const int32 Slot = FreeSlots.Pop(EAllowShrinking::No);
+		ResetSlot(Slot, LocationCm, YawRadians);
+		return Slot;
+	}
+
+	const int32 Slot = X.Num();
+	for (TArray<float>* Column : { &X, &Y, &Z, &Yaw, &ForwardSpeed, &LateralSpeed, &YawRate, &SteerAngle, &EngineRPM, &Gear,
+		&LongitudinalAccel, &LateralAccel, &SteerInput, &ThrottleInput, &BrakeInput })
+	{
+		Column->Add(0.0f);
+	}
+	ResetSlot(Slot, LocationCm, YawRadians);
+	return Slot;
+}
+
+void FKinematicVehicleBatch::Remove(int32 Slot)
+{
+	// The row keeps being stepped with the batch; at rest with no input it stays put
+	ResetSlot(Slot, FVector::ZeroVector, 0.0f);
+	SteerInput[Slot] = 0.0f;
+	ThrottleInput[Slot] = 0.0f;
+	BrakeInput[Slot] = 0.0f;
+	FreeSlots.Add(Slot);
+}
+
+void FKinematicVehicleBatch::ResetSlot(int32 Slot, const FVector& LocationCm, float YawRadians)
+{
+	X[Slot] = LocationCm.X * 0.01f;
+	Y[Slot] = LocationCm.Y * 0.01f;
+	Z[Slot] = LocationCm.Z * 0.01f;
+	Yaw[Slot] = YawRadians;
+	ForwardSpeed[Slot] = 0.0f;
+	LateralSpeed[Slot] = 0.0f;
+	YawRate[Slot] = 0.0f;
+	SteerAngle[Slot] = 0.0f;
+	EngineRPM[Slot] = 0.0f;
+	Gear[Slot] = 0.0f;
+	LongitudinalAccel[Slot] = 0.0f;
+	LateralAccel[Slot] = 0.0f;
+}
+
+FVector FKinematicVehicleBatch::GetVelocityCm(int32 Slot) const
+{
+	float S, C;
+	FMath::SinCos(&S, &C, Yaw[Slot]);
+	const float Vx = ForwardSpeed[Slot];
+	const float Vy = LateralSpeed[Slot];
+	return FVector(Vx * C - Vy * S, Vx * S + Vy * C, 0.0f) * 100.0f;
+}
+
+void FKinematicVehicleBatch::Step(const FKinematicVehicleParams& Params, float DeltaTime)
+{
+	const int32 Count = Num();
+	const int32 NumGears = Params.GearRatios.Num();
+	if (Count == 0 || NumGears == 0 || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// Per-step constants hoisted out of the batch loop
+	constexpr float Gravity = 9.81f;
+	const float Dt = DeltaTime;
+	const float Lf = Params.FrontAxleDistance;
+	const float Lr = Params.RearAxleDistance;
+	const float Wheelbase = Lf + Lr;
+	const float InvMass = 1.0f / Params.Mass;
+	const float InvInertia = 1.0f / Params.YawInertia;
+	const float FrontGrip = Params.Friction * Params.Mass * Gravity * Lr / Wheelbase;
+	const float RearGrip = Params.Friction * Params.Mass * Gravity * Lf / Wheelbase;
+	const float MaxSteer = FMath::DegreesToRadians(Params.MaxSteerAngle);
+	const float SteerAlpha = FMath::Min(1.0f, Dt * Params.SteerResponse);
+	const float WheelToRPM = 60.0f / (UE_TWO_PI * Params.WheelRadius);
+	const float InvRedline = 1.0f / Params.RedlineRPM;
+	const float InvBlend = 1.0f / Params.LowSpeedBlend;
+	const float TopGear = static_cast<float>(NumGears - 1);
+
+	float* RESTRICT PX = X.GetData();
+	float* RESTRICT PY = Y.GetData();
+	float* RESTRICT PYaw = Yaw.GetData();
+	float* RESTRICT PVx = ForwardSpeed.GetData();
+	float* RESTRICT PVy = LateralSpeed.GetData();
+	float* RESTRICT PR = YawRate.GetData();
+	float* RESTRICT PSteer = SteerAngle.GetData();
+	float* RESTRICT PRpm = EngineRPM.GetData();
+	float* RESTRICT PGear = Gear.GetData();
+	float* RESTRICT PAx = LongitudinalAccel.GetData();
+	float* RESTRICT PAy = LateralAccel.GetData();
+	const float* RESTRICT InSteer = SteerInput.GetData();
+	const float* RESTRICT InThrottle = ThrottleInput.GetData();
+	const float* RESTRICT InBrake = BrakeInput.GetData();
+	const float* RESTRICT Ratios = Params.GearRatios.GetData();
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		// Steering actuator lag
+		const float TargetSteer = FMath::Clamp(InSteer[i], -1.0f, 1.0f) * MaxSteer;
+		const float Delta = PSteer[i] + (TargetSteer - PSteer[i]) * SteerAlpha;
+		PSteer[i] = Delta;
+
+		const float Vx = PVx[i];
+		const float Vy = PVy[i];
+		const float R = PR[i];
+		float SinDelta, CosDelta;
+		FMath::SinCos(&SinDelta, &CosDelta, Delta);
+
+		// Saturating linear tires on the slip angle of each axle
+		const float SlipSpeed = FMath::Max(Vx, Params.LowSpeedBlend);
+		const float SlipFront = FMath::Atan2(Vy + Lf * R, SlipSpeed) - Delta;
+		const float SlipRear = FMath::Atan2(Vy - Lr * R, SlipSpeed);
+		const float FyFront = FMath::Clamp(-Params.FrontCorneringStiffness * SlipFront, -FrontGrip, FrontGrip);
+		const float FyRear = FMath::Clamp(-Params.RearCorneringStiffness * SlipRear, -RearGrip, RearGrip);
+
+		// Engine and gearbox: rpm follows the driven wheels, torque curve peaks mid-range, limiter at redline.
+		// The gear is clamped first: GearRatios may have been shortened since the row last shifted.
+		PGear[i] = FMath::Clamp(PGear[i], 0.0f, TopGear);
+		const float Ratio = Ratios[static_cast<int32>(PGear[i])] * Params.FinalDriveRatio;
+		const float WheelRPM = Vx * WheelToRPM;
+		const float RawRPM = WheelRPM * Ratio;
+		const float RPM = FMath::Clamp(RawRPM, Params.IdleRPM, Params.RedlineRPM);
+		const float RpmFraction = RPM * InvRedline;
+		const float Shape = 0.7f + 0.3f * (1.0f - FMath::Square(2.0f * RpmFraction - 1.0f));
+		const float Throttle = FMath::Clamp(InThrottle[i], -1.0f, 1.0f);
+		const float Limiter = RawRPM < Params.RedlineRPM ? 1.0f : 0.0f;
+		const float DriveForce = FMath::Min(Params.MaxEngineTorque * Shape * FMath::Max(Throttle, 0.0f) * Ratio / Params.WheelRadius * Limiter, RearGrip);
+
+		const float BrakeAmount = FMath::Clamp(FMath::Max(-Throttle, 0.0f) + InBrake[i], 0.0f, 1.0f);
+		const float Resistance = Params.Drag * Vx * Vx + Params.RollingResistance * Vx;
+		const float Fx = DriveForce - BrakeAmount * Params.BrakeForce - Resistance;
+
+		// Dynamic bicycle model in the body frame (semi-implicit Euler)
+		const float Ax = (Fx - FyFront * SinDelta) * InvMass + Vy * R;
+		const float Ay = (FyRear + FyFront * CosDelta) * InvMass - Vx * R;
+		const float Ar = (Lf * FyFront * CosDelta - Lr * FyRear) * InvInertia;
+
+		const float NewVx = FMath::Max(Vx + Ax * Dt, 0.0f); // no reverse gear: brakes stop the car
+		float NewVy = Vy + Ay * Dt;
+		float NewR = R + Ar * Dt;
+
+		// Blend into the kinematic bicycle at low speed, where slip dynamics are stiff and meaningless
+		const float DynamicWeight = FMath::Min(NewVx * InvBlend, 1.0f);
+		const float KinematicR = NewVx * FMath::Tan(Delta) / Wheelbase;
+		NewR = DynamicWeight * NewR + (1.0f - DynamicWeight) * KinematicR;
+		NewVy *= DynamicWeight;
+
+		const float NewYaw = PYaw[i] + NewR * Dt;
+		float SinYaw, CosYaw;
+		FMath::SinCos(&SinYaw, &CosYaw, NewYaw);
+		PX[i] += (NewVx * CosYaw - NewVy * SinYaw) * Dt;
+		PY[i] += (NewVx * SinYaw + NewVy * CosYaw) * Dt;
+		PYaw[i] = NewYaw;
+		PVx[i] = NewVx;
+		PVy[i] = NewVy;
+		PR[i] = NewR;
+
+		// Automatic gearbox with hysteresis (upshift drops rpm well above the downshift point)
+		const float Up = (RPM >= Params.UpshiftRPM && PGear[i] < TopGear) ? 1.0f : 0.0f;
+		const float Down = (RawRPM <= Params.DownshiftRPM && PGear[i] > 0.0f) ? 1.0f : 0.0f;
+		PGear[i] += Up - Down;
+		PRpm[i] = RPM;
+
+		// Accelerations felt by the chassis, for suspension load-transfer telemetry
+		PAx[i] = Ax - Vy * R;
+		PAy[i] = Ay + Vx * R;
+	}
+}
@@ -0,0 +1,75 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "KinematicVehiclePawn.h"
+#include "Components/StaticMeshComponent.h"
+
+AKinematicVehiclePawn::AKinematicVehiclePawn()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	Body = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Body"));
+	Body->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Body->SetSimulatePhysics(false);
+	Body->SetGenerateOverlapEvents(false);
+	Body->SetCanEverAffectNavigation(false);
+	RootComponent = Body;
+}
+
+void AKinematicVehiclePawn::ApplyNNOutputs(TArrayView<const float> Outputs)
+{
+	SteerInput = Outputs.Num() > 0 ? FMath::Clamp(Outputs[0], -1.0f, 1.0f) : 0.0f;
+	ThrottleInput = Outputs.Num() > 1 ? FMath::Clamp(Outputs[1], -1.0f, 1.0f) : 0.0f;
+	BrakeInput = Outputs.Num() > 2 ? FMath::Clamp(Outputs[2], 0.0f, 1.0f) : 0.0f;
+}
+
+void AKinematicVehiclePawn::FillTelemetry(FVehicleTelemetry& Out) const
+{
+	static_assert(FVehicleTelemetry::MaxWheels == 4, "Surrogate telemetry assumes four wheels");
+	Out.WheelsOnGroundRatio = 1.0f;
+	for (float& Contact : Out.WheelContact)
+	{
+		Contact = 1.0f;
+	}
+	ComputeSuspensionCompression(Out.WheelCompression);
+	Out.NormalizedRPM = NormalizedRPM;
+	Out.NormalizedGear = GetNormalizedGear(FVehicleTelemetry::ReferenceGearCount);
+}
+
+void AKinematicVehiclePawn::GetWheelContactStates(TArray<float>& OutStates) const
+{
+	OutStates.Init(1.0f, 4);
+}
+
+void AKinematicVehiclePawn::GetWheelSuspensionCompression(TArray<float>& OutCompression) const
+{
+	OutCompression.SetNumUninitialized(4);
+	ComputeSuspensionCompression(OutCompression.GetData());
+}
+
+void AKinematicVehiclePawn::ComputeSuspensionCompression(float OutCompression[4]) const
+{
+	// FL, FR, RL, RR: braking loads the front, cornering right (positive lateral accel) loads the left side
+	const float Pitch = -LongitudinalG * CompressionPerG;
+	const float Roll = LateralG * CompressionPerG;
+	OutCompression[0] = FMath::Clamp(RestCompression + Pitch + Roll, 0.0f, 1.0f);
+	OutCompression[1] = FMath::Clamp(RestCompression + Pitch - Roll, 0.0f, 1.0f);
+	OutCompression[2] = FMath::Clamp(RestCompression - Pitch + Roll, 0.0f, 1.0f);
+	OutCompression[3] = FMath::Clamp(RestCompression - Pitch - Roll, 0.0f, 1.0f);
+}
+
+float AKinematicVehiclePawn::GetNormalizedGear(int32 MaxGear) const
+{
+	const int32 TopGear = MaxGear > 0 ? MaxGear : NumGears;
+	return FMath::Clamp(static_cast<float>(Gear + 1) / static_cast<float>(FMath::Max(TopGear, 1)), 0.0f, 1.0f);
+}
+
+void AKinematicVehiclePawn::SetTelemetry(const FVector& InVelocity, float InNormalizedRPM, int32 InGear, int32 InNumGears, float LongitudinalAccel, float LateralAccel)
+{
+	constexpr float InvGravity = 1.0f / 9.81f;
+	Velocity = InVelocity;
+	NormalizedRPM = InNormalizedRPM;
+	Gear = InGear;
+	NumGears = InNumGears;
+	LongitudinalG = LongitudinalAccel * InvGravity;
+	LateralG = LateralAccel * InvGravity;
+}
@@ -0,0 +1,373 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "SplineTrackIndex.h"
+#include "Components/SplineComponent.h"
+
+FSplineTrackIndex& FSplineTrackIndex::Get(entt::registry& Registry)
+{
+	if (FSplineTrackIndex* Existing = Registry.ctx().find<FSplineTrackIndex>())
+	{
+		return *Existing;
+	}
+	return Registry.ctx().emplace<FSplineTrackIndex>();
+}
+
+bool FSplineTrackIndex::EnsureBuilt(const USplineComponent* InSpline, float SampleSpacing)
+{
+	if (!InSpline)
+	{
+		return false;
+	}
+
+	const bool bUpToDate = IsBuilt()
+		&& SourceSpline.Get() == InSpline
+		&& Spacing == FMath::Max(SampleSpacing, 1.0f)
+		&& SourceHash == HashSpline(*InSpline);
+	if (!bUpToDate)
+	{
+		Build(InSpline, SampleSpacing);
+	}
+	Spline = InSpline;
+	return IsBuilt();
+}
+
+uint32 FSplineTrackIndex::HashSpline(const USplineComponent& InSpline)
+{
+	auto HashVector = [](uint32 Hash, const FVector& V)
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(V.X));
+		Hash = HashCombineFast(Hash, GetTypeHash(V.Y));
+		return HashCombineFast(Hash, GetTypeHash(V.Z));
+	};
+
+	const FTransform& Transform = InSpline.GetComponentTransform();
+	const int32 NumPoints = InSpline.GetNumberOfSplinePoints();
+	uint32 Hash = HashCombineFast(GetTypeHash(NumPoints), GetTypeHash(InSpline.IsClosedLoop()));
+	Hash = HashVector(Hash, Transform.GetLocation());
+	Hash = HashVector(Hash, Transform.GetRotation().Euler());
+	Hash = HashVector(Hash, Transform.GetScale3D());
+	Hash = HashVector(Hash, InSpline.GetDefaultUpVector(ESplineCoordinateSpace::Local));
+
+	// Local space: the transform above already covers moving the whole component
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		Hash = HashVector(Hash, InSpline.GetLocationAtSplinePoint(i, ESplineCoordinateSpace::Local));
+		Hash = HashVector(Hash, InSpline.GetArriveTangentAtSplinePoint(i, ESplineCoordinateSpace::Local));
+		Hash = HashVector(Hash, InSpline.GetLeaveTangentAtSplinePoint(i, ESplineCoordinateSpace::Local));
+		Hash = HashVector(Hash, InSpline.GetRotationAtSplinePoint(i, ESplineCoordinateSpace::Local).Euler());
+		Hash = HashVector(Hash, InSpline.GetScaleAtSplinePoint(i));
+		Hash = HashCombineFast(Hash, GetTypeHash(static_cast<uint8>(InSpline.GetSplinePointType(i))));
+	}
+	return Hash;
+}
+
+void FSplineTrackIndex::Build(const USplineComponent* InSpline, float SampleSpacing)
+{
+	Positions.Reset();
+	InputKeys.Reset();
+	Distances.Reset();
+	Tangents.Reset();
+	Ups.Reset();
+	Rights.Reset();
+	Features.Reset();
+	SegmentInvLengthSquared.Reset();
+	CellStart.Reset();
+	CellSegments.Reset();
+
+	SourceSpline = InSpline;
+	Spline = InSpline;
+	SourceNumPoints = InSpline->GetNumberOfSplinePoints();
+	SourceHash = HashSpline(*InSpline);
+	++BuildStamp;
+	bClosedLoop = InSpline->IsClosedLoop();
+	Spacing = FMath::Max(SampleSpacing, 1.0f);
+	Length = InSpline->GetSplineLength();
+	const int32 NumSegments = SourceNumPoints > 1 ? (bClosedLoop ? SourceNumPoints : SourceNumPoints - 1) : 0;
+	LastInputKey = static_cast<float>(NumSegments);
+	if (Length <= 0.0f || NumSegments == 0)
+	{
+		return;
+	}
+
+	// 1. Arc-length samples at a uniform step no longer than Spacing; first and last sit on the spline ends
+	const int32 NumSamples = FMath::Max(FMath::CeilToInt(Length / Spacing), 1) + 1;
+	SampleStep = Length / (NumSamples - 1);
+	InvSampleStep = 1.0f / SampleStep;
+	Positions.SetNumUninitialized(NumSamples);
+	InputKeys.SetNumUninitialized(NumSamples);
+	Distances.SetNumUninitialized(NumSamples);
+	Tangents.SetNumUninitialized(NumSamples);
+	Ups.SetNumUninitialized(NumSamples);
+	Rights.SetNumUninitialized(NumSamples);
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		const float Distance = i == NumSamples - 1 ? Length : i * SampleStep;
+		Distances[i] = Distance;
+		InputKeys[i] = i == NumSamples - 1 ? LastInputKey : InSpline->GetInputKeyValueAtDistanceAlongSpline(Distance);
+		Positions[i] = InSpline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+		Tangents[i] = InSpline->GetDirectionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+		Ups[i] = InSpline->GetUpVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+		Rights[i] = InSpline->GetRightVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+	}
+
+	// 2. Feature table: tangent, up and signed curvature (central differences of the tangent, wrapped on loops)
+	Features.SetNumUninitialized(NumSamples);
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		const int32 Prev = i > 0 ? i - 1 : (bClosedLoop ? NumSamples - 2 : 0);
+		const int32 Next = i < NumSamples - 1 ? i + 1 : (bClosedLoop ? 1 : NumSamples - 1);
+		const float Span = (Next - Prev + (Next < Prev ? NumSamples - 1 : 0)) * SampleStep;
+		const FVector Turn = FVector::CrossProduct(Tangents[Prev], Tangents[Next]);
+		const float Bend = FVector::DotProduct(Turn, Ups[i]);
+
+		FSplineTrackFeature& Feature = Features[i];
+		Feature.Tangent = FVector3f(Tangents[i]);
+		Feature.Up = FVector3f(Ups[i]);
+		Feature.Curvature = Span > 0.0f ? (Tangents[Next] - Tangents[Prev]).Size() / Span : 0.0f;
+		Feature.CurvatureSign = Bend > UE_KINDA_SMALL_NUMBER ? 1.0f : (Bend < -UE_KINDA_SMALL_NUMBER ? -1.0f : 0.0f);
+	}
+
+	const int32 NumPolySegments = NumSamples - 1;
+	SegmentInvLengthSquared.SetNumUninitialized(NumPolySegments);
+	FBox2D Bounds(ForceInit);
+	for (int32 s = 0; s < NumPolySegments; ++s)
+	{
+		const float LengthSquared = FVector::DistSquared(Positions[s], Positions[s + 1]);
+		SegmentInvLengthSquared[s] = LengthSquared > UE_SMALL_NUMBER ? 1.0f / LengthSquared : 0.0f;
+	}
+	for (const FVector& Position : Positions)
+	{
+		Bounds += FVector2D(Position);
+	}
+
+	// 3. Grid: cells of at least a few samples, and never many more cells than segments
+	const FVector2D Extent = Bounds.GetSize();
+	const float Area = FMath::Max(Extent.X * Extent.Y, 1.0f);
+	CellSize = FMath::Max(4.0f * Spacing, FMath::Sqrt(Area / (4.0f * NumPolySegments)));
+	InvCellSize = 1.0f / CellSize;
+	GridOrigin = Bounds.Min;
+	GridSizeX = FMath::FloorToInt(Extent.X * InvCellSize) + 1;
+	GridSizeY = FMath::FloorToInt(Extent.Y * InvCellSize) + 1;
+
+	// 4. Bucket every segment into the cells its XY bounding box overlaps (count, prefix sum, fill)
+	auto ForEachCell = [this](int32 Segment, auto&& Func)
+	{
+		const FVector2D A(Positions[Segment]);
+		const FVector2D B(Positions[Segment + 1]);
+		const int32 MinX = FMath::Clamp(FMath::FloorToInt((FMath::Min(A.X, B.X) - GridOrigin.X) * InvCellSize), 0, GridSizeX - 1);
+		const int32 MaxX = FMath::Clamp(FMath::FloorToInt((FMath::Max(A.X, B.X) - GridOrigin.X) * InvCellSize), 0, GridSizeX - 1);
+		const int32 MinY = FMath::Clamp(FMath::FloorToInt((FMath::Min(A.Y, B.Y) - GridOrigin.Y) * InvCellSize), 0, GridSizeY - 1);
+		const int32 MaxY = FMath::Clamp(FMath::FloorToInt((FMath::Max(A.Y, B.Y) - GridOrigin.Y) * InvCellSize), 0, GridSizeY - 1);
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				Func(Y * GridSizeX + X);
+			}
+		}
+	};
+
+	CellStart.SetNumZeroed(GridSizeX * GridSizeY + 1);
+	for (int32 s = 0; s < NumPolySegments; ++s)
+	{
+		ForEachCell(s, [this](int32 Cell) { ++CellStart[Cell + 1]; });
+	}
+	for (int32 c = 1; c < CellStart.Num(); ++c)
+	{
+		CellStart[c] += CellStart[c - 1];
+	}
+	CellSegments.SetNumUninitialized(CellStart.Last());
+	TArray<int32> Fill(CellStart.GetData(), CellStart.Num() - 1);
+	for (int32 s = 0; s < NumPolySegments; ++s)
+	{
+		ForEachCell(s, [this, &Fill, s](int32 Cell) { CellSegments[Fill[Cell]++] = s; });
+	}
+}
+
+float FSplineTrackIndex::ClosestOnSegment(int32 Segment, const FVector& Location, float& OutT) const
+{
+	const FVector& A = Positions[Segment];
+	const FVector AB = Positions[Segment + 1] - A;
+	OutT = FMath::Clamp(FVector::DotProduct(Location - A, AB) * SegmentInvLengthSquared[Segment], 0.0f, 1.0f);
+	return FVector::DistSquared(Location, A + AB * OutT);
+}
+
+FSplineTrackProjection FSplineTrackIndex::Project(const FVector& Location) const
+{
+	check(IsBuilt());
+
+	// 1. Ring search over the grid; after ring R every unvisited segment is at least R cells away in XY
+	const int32 CellX = FMath::FloorToInt((Location.X - GridOrigin.X) * InvCellSize);
+	const int32 CellY = FMath::FloorToInt((Location.Y - GridOrigin.Y) * InvCellSize);
+	const int32 FirstRing = FMath::Max(0, FMath::Max(FMath::Max(-CellX, -CellY), FMath::Max(CellX - (GridSizeX - 1), CellY - (GridSizeY - 1))));
+
+	int32 BestSegment = INDEX_NONE;
+	float BestT = 0.0f;
+	float BestDistanceSquared = TNumericLimits<float>::Max();
+
+	auto VisitCell = [&](int32 X, int32 Y)
+	{
+		const int32 Cell = Y * GridSizeX + X;
+		for (int32 i = CellStart[Cell]; i < CellStart[Cell + 1]; ++i)
+		{
+			const int32 Segment = CellSegments[i];
+			float T;
+			const float DistanceSquared = ClosestOnSegment(Segment, Location, T);
+			if (DistanceSquared < BestDistanceSquared)
+			{
+				BestDistanceSquared = DistanceSquared;
+				BestSegment = Segment;
+				BestT = T;
+			}
+		}
+	};
+
+	for (int32 Ring = FirstRing; ; ++Ring)
+	{
+		const int32 MinY = FMath::Max(CellY - Ring, 0);
+		const int32 MaxY = FMath::Min(CellY + Ring, GridSizeY - 1);
+		const int32 MinX = FMath::Max(CellX - Ring, 0);
+		const int32 MaxX = FMath::Min(CellX + Ring, GridSizeX - 1);
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			if (Y == CellY - Ring || Y == CellY + Ring)
+			{
+				for (int32 X = MinX; X <= MaxX; ++X)
+				{
+					VisitCell(X, Y);
+				}
+			}
+			else
+			{
+				if (CellX - Ring >= 0)
+				{
+					VisitCell(CellX - Ring, Y);
+				}
+				if (Ring > 0 && CellX + Ring < GridSizeX)
+				{
+					VisitCell(CellX + Ring, Y);
+				}
+			}
+		}
+
+		const float Reach = Ring * CellSize;
+		const bool bCoversGrid = CellX - Ring <= 0 && CellY - Ring <= 0 && CellX + Ring >= GridSizeX - 1 && CellY + Ring >= GridSizeY - 1;
+		if ((BestSegment != INDEX_NONE && BestDistanceSquared <= Reach * Reach) || bCoversGrid)
+		{
+			break;
+		}
+	}
+
+	return Finish(Location, BestSegment, BestT);
+}
+
+FSplineTrackProjection FSplineTrackIndex::ProjectNear(const FVector& Location, float PreviousDistance) const
+{
+	check(IsBuilt());
+
+	// Segments covering [PreviousDistance - Window, PreviousDistance + Window]; wraps on closed loops
+	const int32 NumSegments = Positions.Num() - 1;
+	const int32 Reach = FMath::CeilToInt(WarmStartWindow * InvSampleStep);
+	const int32 Center = FMath::Clamp(FMath::FloorToInt(PreviousDistance * InvSampleStep), 0, NumSegments - 1);
+	if (2 * Reach + 1 >= NumSegments)
+	{
+		return Project(Location);
+	}
+	const int32 First = bClosedLoop ? Center - Reach : FMath::Max(Center - Reach, 0);
+	const int32 Last = bClosedLoop ? Center + Reach : FMath::Min(Center + Reach, NumSegments - 1);
+
+	int32 BestSegment = INDEX_NONE;
+	int32 BestOffset = 0;
+	float BestT = 0.0f;
+	float BestDistanceSquared = TNumericLimits<float>::Max();
+	for (int32 i = First; i <= Last; ++i)
+	{
+		const int32 Segment = (i + NumSegments) % NumSegments;
+		float T;
+		const float DistanceSquared = ClosestOnSegment(Segment, Location, T);
+		if (DistanceSquared < BestDistanceSquared)
+		{
+			BestDistanceSquared = DistanceSquared;
+			BestSegment = Segment;
+			BestOffset = i;
+			BestT = T;
+		}
+	}
+
+	// A minimum pinned to a window edge that is not a track end may continue outside the window
+	const bool bOnLowerEdge = BestOffset == First && BestT <= 0.0f && (bClosedLoop || First > 0);
+	const bool bOnUpperEdge = BestOffset == Last && BestT >= 1.0f && (bClosedLoop || Last < NumSegments - 1);
+	if (bOnLowerEdge || bOnUpperEdge || BestDistanceSquared > FMath::Square(WarmStartMaxResidual))
+	{
+		return Project(Location);
+	}
+	return Finish(Location, BestSegment, BestT);
+}
+
+FSplineTrackProjection FSplineTrackIndex::Finish(const FVector& Location, int32 Segment, float T) const
+{
+	// Chord result, then Gauss-Newton on the spline within the segment's key range
+	const int32 S = Segment;
+	const float KeyA = InputKeys[S];
+	const float KeyB = InputKeys[S + 1];
+	float Key = FMath::Lerp(KeyA, KeyB, T);
+	FVector Point = FMath::Lerp(Positions[S], Positions[S + 1], T);
+	if (Spline && RefineIterations > 0 && KeyB > KeyA)
+	{
+		for (int32 Iteration = 0; Iteration < RefineIterations; ++Iteration)
+		{
+			const FVector SplinePoint = Spline->GetLocationAtSplineInputKey(Key, ESplineCoordinateSpace::World);
+			const FVector Derivative = Spline->GetTangentAtSplineInputKey(Key, ESplineCoordinateSpace::World);
+			const float DerivativeSquared = Derivative.SizeSquared();
+			if (DerivativeSquared <= UE_SMALL_NUMBER)
+			{
+				break;
+			}
+			Key = FMath::Clamp(Key + FVector::DotProduct(Location - SplinePoint, Derivative) / DerivativeSquared, KeyA, KeyB);
+		}
+		Point = Spline->GetLocationAtSplineInputKey(Key, ESplineCoordinateSpace::World);
+	}
+	const float Alpha = KeyB > KeyA ? (Key - KeyA) / (KeyB - KeyA) : T;
+
+	FSplineTrackProjection Result;
+	Result.Sample = S;
+	Result.InputKey = Key;
+	Result.Distance = FMath::Lerp(Distances[S], Distances[S + 1], Alpha);
+	Result.Location = Point;
+	Result.DistanceSquared = FVector::DistSquared(Location, Point);
+	Result.Tangent = FMath::Lerp(Tangents[S], Tangents[S + 1], Alpha).GetSafeNormal(UE_SMALL_NUMBER, Tangents[S]);
+	Result.Up = FMath::Lerp(Ups[S], Ups[S + 1], Alpha).GetSafeNormal(UE_SMALL_NUMBER, Ups[S]);
+	Result.Right = FMath::Lerp(Rights[S], Rights[S + 1], Alpha).GetSafeNormal(UE_SMALL_NUMBER, Rights[S]);
+
+	// A closed loop's end is its start
+	if (bClosedLoop && Result.InputKey >= LastInputKey)
+	{
+		Result.InputKey -= LastInputKey;
+		Result.Distance = 0.0f;
+	}
+	return Result;
+}
+
+FSplineTrackFeature FSplineTrackIndex::SampleFeatures(float Distance) const
+{
+	// Fixed step: index and weight come straight from the distance, no search and no branches
+	const float X = FMath::Clamp(Distance * InvSampleStep, 0.0f, static_cast<float>(Features.Num() - 1));
+	const int32 I = FMath::Min(static_cast<int32>(X), Features.Num() - 2);
+	const float Alpha = X - static_cast<float>(I);
+	const FSplineTrackFeature& A = Features[I];
+	const FSplineTrackFeature& B = Features[I + 1];
+
+	FSplineTrackFeature Result;
+	Result.Tangent = FMath::Lerp(A.Tangent, B.Tangent, Alpha);
+	Result.Tangent *= FMath::InvSqrt(FMath::Max(Result.Tangent.SizeSquared(), UE_SMALL_NUMBER));
+	Result.Up = FMath::Lerp(A.Up, B.Up, Alpha);
+	Result.Up *= FMath::InvSqrt(FMath::Max(Result.Up.SizeSquared(), UE_SMALL_NUMBER));
+	Result.Curvature = FMath::Lerp(A.Curvature, B.Curvature, Alpha);
+	Result.CurvatureSign = Alpha < 0.5f ? A.CurvatureSign : B.CurvatureSign;
+	return Result;
+}
+
+FVector FSplineTrackIndex::GetTangentAtDistance(float Distance) const
+{
+	return FVector(SampleFeatures(Distance).Tangent);
+}
@@ -0,0 +1,169 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/FarmEliteExchangeSystem.h"
+#include "Farm/TrainingFarm.h"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+#include "Lineage/SolutionIdAllocator.h"
+#include "BreedingPlan.h"
+#include "GAStepGate.h"
+
+UFarmEliteExchangeSystem::UFarmEliteExchangeSystem()
+{
+	RegisterComponent<FEliteTagComponent>();
+	RegisterComponent<FFitnessComponent>();
+	RegisterComponent<FUniqueSolutionComponent>();
+	RegisterComponent<FEliteOwnedFloatGenome>();
+	RegisterComponent<FGenomeFloatViewComponent>();
+}
+
+void UFarmEliteExchangeSystem::BeginDestroy()
+{
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		if (FTrainingFarmWorker* Farm = FTrainingFarmWorker::Get())
+		{
+			Farm->RemoveContext(this);
+		}
+	}
+	Super::BeginDestroy();
+}
+
+void UFarmEliteExchangeSystem::Update_Implementation(float /*DeltaTime*/)
+{
+	FTrainingFarmWorker* Farm = FTrainingFarmWorker::Get();
+	if (!Farm)
+	{
+		return;
+	}
+
+	auto& Registry = GetRegistry();
+	if (!FGAStepGate::IsPopulationStep(Registry))
+	{
+		return;
+	}
+
+	// Children scheduled this step are bred by now; the plan is reset by cleanup right after
+	Progress.Births += FBreedingPlan::Get(Registry).Num();
+
+	const double Now = GetContext()->GetWorld()->GetTimeSeconds();
+	if (Now < NextExchangeTime)
+	{
+		return;
+	}
+	NextExchangeTime = Now + ExchangeInterval;
+
+	FSharedEliteRing& Ring = Farm->GetRing();
+	if (!bCursorInitialized)
+	{
+		// Only migrants published from now on; older ones were bred against a different starting point
+		ReadCursor = Ring.GetWriteCursor();
+		bCursorInitialized = true;
+	}
+
+	// Gather scored elites, best first within each population
+	const float Neutral = bHigherIsBetter ? -MAX_FLT : MAX_FLT;
+	Elites.Reset();
+	auto EliteView = Registry.view<FEliteTagComponent, FFitnessComponent, FUniqueSolutionComponent, FEliteOwnedFloatGenome>();
+	for (const entt::entity Entity : EliteView)
+	{
+		const FFitnessComponent& Fit = EliteView.get<FFitnessComponent>(Entity);
+		if (Fit.Fitness.IsValidIndex(Fit.BuiltForFitnessIndex) && Fit.Fitness[Fit.BuiltForFitnessIndex] != Neutral)
+		{
+			Elites.Add({ Entity, Fit.BuiltForFitnessIndex, Fit.Fitness[Fit.BuiltForFitnessIndex] });
+		}
+	}
+	Elites.Sort([this](const FEliteRef& A, const FEliteRef& B)
+	{
+		return A.Population != B.Population ? A.Population < B.Population : IsBetter(A.Fitness, B.Fitness);
+	});
+
+	// 1. Publish the top elites of each population that are new since the last exchange
+	int32 RankInPopulation = 0;
+	for (int32 i = 0; i < Elites.Num(); ++i)
+	{
+		const FEliteRef& Elite = Elites[i];
+		RankInPopulation = (i > 0 && Elites[i - 1].Population == Elite.Population) ? RankInPopulation + 1 : 0;
+		if (RankInPopulation >= ElitesPerPopulation)
+		{
+			continue;
+		}
+		const int64 Id = EliteView.get<FUniqueSolutionComponent>(Elite.Entity).Id;
+		if (MarkPublished(Id) && Ring.Publish(Farm->GetWorkerIndex(), Elite.Population, Id, Elite.Fitness, EliteView.get<FEliteOwnedFloatGenome>(Elite.Entity).Values))
+		{
+			++Progress.ElitesPublished;
+		}
+	}
+
+	// 2. Inject migrants over the worst local elite of their population when they beat it
+	Incoming.Reset();
+	Ring.Poll(Farm->GetWorkerIndex(), ReadCursor, Incoming, MaxMigrantsPerExchange);
+	for (const FSharedEliteRecord& Migrant : Incoming)
+	{
+		FEliteRef* Worst = nullptr;
+		for (FEliteRef& Elite : Elites)
+		{
+			if (Elite.Population == Migrant.Population && (!Worst || IsBetter(Worst->Fitness, Elite.Fitness)))
+			{
+				Worst = &Elite;
+			}
+		}
+		if (!Worst || !IsBetter(Migrant.Fitness, Worst->Fitness))
+		{
+			continue;
+		}
+		FEliteOwnedFloatGenome& Owned = EliteView.get<FEliteOwnedFloatGenome>(Worst->Entity);
+		if (Owned.Values.Num() != Migrant.Genome.Num())
+		{
+			continue; // different network layout; the farm should run one config
+		}
+
+		// Copy in place so the elite's genome view stays valid
+		FMemory::Memcpy(Owned.Values.GetData(), Migrant.Genome.GetData(), sizeof(float) * Migrant.Genome.Num());
+		FUniqueSolutionComponent& Unique = EliteView.get<FUniqueSolutionComponent>(Worst->Entity);
+		Unique.Id = FSolutionIdAllocator::Get(Registry).Allocate();
+		Unique.SourceId = Migrant.SolutionId;
+		// patch so FPopulationIndex sees the new elite fitness
+		const int32 Population = Worst->Population;
+		const float Fitness = Migrant.Fitness;
+		Registry.patch<FFitnessComponent>(Worst->Entity, [Population, Fitness](FFitnessComponent& Fit) { Fit.Fitness[Population] = Fitness; });
+		Worst->Fitness = Migrant.Fitness;
+		MarkPublished(Unique.Id); // never echo a migrant back
+		++Progress.ElitesInjected;
+	}
+
+	// 3. Progress
+	Progress.NumContexts = 1;
+	Progress.BestFitness = 0.0f;
+	Progress.MeanEliteFitness = 0.0f;
+	for (int32 i = 0; i < Elites.Num(); ++i)
+	{
+		Progress.BestFitness = (i == 0 || IsBetter(Elites[i].Fitness, Progress.BestFitness)) ? Elites[i].Fitness : Progress.BestFitness;
+		Progress.MeanEliteFitness += Elites[i].Fitness / Elites.Num();
+	}
+	Farm->ReportContextProgress(this, Progress);
+}
+
+bool UFarmEliteExchangeSystem::MarkPublished(int64 Id)
+{
+	bool bAlreadyPublished = false;
+	PublishedIds.Add(Id, &bAlreadyPublished);
+	if (bAlreadyPublished)
+	{
+		return false;
+	}
+
+	// Ids of replaced elites would otherwise accumulate for the whole run; only the oldest one is forgotten,
+	// so the current elites are never republished
+	if (PublishedOrder.Num() < MaxPublishedIds)
+	{
+		PublishedOrder.Add(Id);
+	}
+	else
+	{
+		PublishedIds.Remove(PublishedOrder[PublishedHead]);
+		PublishedOrder[PublishedHead] = Id;
+		PublishedHead = (PublishedHead + 1) % MaxPublishedIds;
+	}
+	return true;
+}
@@ -4,8 +4,11 @@
 #include "VehicleTrainerContext.h"
 #include "VehicleTrainerConfig.h"
 #include "Components/GenomeComponents.h"
+#include "GAStepGate.h"
+#include "Lineage/SolutionIdAllocator.h"
 #include "Components/EliteComponents.h"
 #include "Components/NetworkComponent.h"
+#include "Async/ParallelFor.h"
 
 UGAStalenessSystem::UGAStalenessSystem()
 {
@@ -33,6 +36,13 @@ void UGAStalenessSystem::Update_Implementation(float DeltaTime)
 	}
 
 	auto& Registry = GetRegistry();
+
+	// One history sample per GA step; a sharded chain fires several times per step
+	if (!FGAStepGate::IsPopulationStep(Registry))
+	{
+		return;
+	}
+
 	const float CurrentTime = TrainerContext->GetWorld()->GetTimeSeconds();
 	const bool bHigherIsBetter = Config->bHigherIsBetter;
 
@@ -169,8 +179,11 @@ void UGAStalenessSystem::Update_Implementation(float DeltaTime)
 	}
 
 	// 5b. Re-randomize NN weights for ALL non-elite entities in this population
+	// Seeds are drawn here in view order; networks that already have their layout get new weights in place on
+	// worker threads, so genome views stay valid and a nuke does not reallocate every network of the population
 	{
-		TArray<FNeuralNetworkLayerDescriptor> LayerDescriptors = Config->GetNNLayerDescriptors();
+		TArray<FNeuralNetworkFloat*> Networks;
+		TArray<int32> Seeds;
 		auto PopView = Registry.view<FFitnessComponent, FNeuralNetworkFloat>(entt::exclude_t<FEliteTagComponent>{});
 
 		for (auto E : PopView)
@@ -181,7 +194,14 @@ void UGAStalenessSystem::Update_Implementation(float DeltaTime)
 				FNeuralNetworkFloat& NetComp = PopView.get<FNeuralNetworkFloat>(E);
 				// Reinitialize with a random seed to get fresh random weights
 				const int32 RandomSeed = FMath::RandRange(1, 2147483647);
-				NetComp.Initialize(LayerDescriptors, RandomSeed);
+				if (NetComp.Network.GetDataView().Num() > 0)
+				{
+					Networks.Add(&NetComp);
+					Seeds.Add(RandomSeed);
+					continue;
+				}
+
+				NetComp.Initialize(Config->GetNNLayerDescriptors(), RandomSeed);
 
 				// Update the genome view to point to the reinitialized network data
 				if (FGenomeFloatViewComponent* GenomeView = Registry.try_get<FGenomeFloatViewComponent>(E))
@@ -190,6 +210,11 @@ void UGAStalenessSystem::Update_Implementation(float DeltaTime)
 				}
 			}
 		}
+
+		ParallelFor(Networks.Num(), [&Networks, &Seeds](int32 Index)
+		{
+			Networks[Index]->Network.InitializeWeights(Seeds[Index]);
+		});
 	}
 
 	// 5c. Find the global best elite's genome BEFORE destroying any elites
@@ -240,7 +265,7 @@ void UGAStalenessSystem::Update_Implementation(float DeltaTime)
 			// EliteView (which requires FEliteTagComponent + FFitnessComponent + FUniqueSolutionComponent)
 			// will not see this entity, causing duplicate elites to be created every tick.
 			FUniqueSolutionComponent& NewUnique = Registry.emplace<FUniqueSolutionComponent>(NewElite);
-			NewUnique.Id = FUniqueSolutionComponent::GenerateNewId();
+			NewUnique.Id = FSolutionIdAllocator::Get(Registry).Allocate();
 			NewUnique.SourceId = GlobalBestSourceId;
 
 			FFitnessComponent NewFit{};
@@ -0,0 +1,117 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/KinematicVehicleSystem.h"
+#include "VehicleComponent.h"
+#include "KinematicVehiclePawn.h"
+#include "Components/KinematicVehicleComponent.h"
+#include "Engine/World.h"
+
+UKinematicVehicleSystem::UKinematicVehicleSystem()
+{
+	RegisterComponent<FVehicleComponent>();
+	RegisterComponent<FKinematicVehicleComponent>();
+}
+
+void UKinematicVehicleSystem::Update_Implementation(float DeltaTime)
+{
+	UWorld* World = GetContext() ? GetContext()->GetWorld() : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	entt::registry& Registry = GetRegistry();
+	FKinematicVehicleBatch& Batch = FKinematicVehicleBatch::Get(Registry);
+
+	// 1. Classify vehicles the system has not seen yet
+	auto NewView = Registry.view<FVehicleComponent>(entt::exclude<FKinematicVehicleComponent>);
+	for (const entt::entity Entity : NewView)
+	{
+		AKinematicVehiclePawn* Pawn = Cast<AKinematicVehiclePawn>(NewView.get<FVehicleComponent>(Entity).VehiclePawn);
+		FKinematicVehicleComponent& Kinematic = Registry.emplace<FKinematicVehicleComponent>(Entity);
+		if (Pawn)
+		{
+			Kinematic.LastWrittenLocation = Pawn->GetActorLocation();
+			Kinematic.Slot = Batch.Add(Kinematic.LastWrittenLocation, FMath::DegreesToRadians(Pawn->GetActorRotation().Yaw));
+		}
+	}
+
+	// 2. Gather controls, resync teleported pawns
+	Active.Reset();
+	auto View = GetView<FVehicleComponent, FKinematicVehicleComponent>();
+	for (const entt::entity Entity : View)
+	{
+		const FKinematicVehicleComponent& Kinematic = View.get<FKinematicVehicleComponent>(Entity);
+		AKinematicVehiclePawn* Pawn = Kinematic.Slot != INDEX_NONE ? Cast<AKinematicVehiclePawn>(View.get<FVehicleComponent>(Entity).VehiclePawn) : nullptr;
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		const int32 Slot = Kinematic.Slot;
+		const FVector Location = Pawn->GetActorLocation();
+		if (!Location.Equals(Kinematic.LastWrittenLocation, 1.0))
+		{
+			Batch.ResetSlot(Slot, Location, FMath::DegreesToRadians(Pawn->GetActorRotation().Yaw));
+		}
+		Batch.SteerInput[Slot] = Pawn->GetSteerInput();
+		Batch.ThrottleInput[Slot] = Pawn->GetThrottleInput();
+		Batch.BrakeInput[Slot] = Pawn->GetBrakeInput();
+		Active.Emplace(Pawn, Slot);
+	}
+
+	// 3. Fixed substeps over the world time elapsed since the previous update (the chain runs below frame rate)
+	const double Now = World->GetTimeSeconds();
+	if (LastWorldTime >= 0.0)
+	{
+		Accumulator += Now - LastWorldTime;
+	}
+	LastWorldTime = Now;
+
+	const float Step = FMath::Max(FixedStep, 1e-3f);
+	int32 Substeps = 0;
+	while (Accumulator >= Step && Substeps < MaxSubsteps)
+	{
+		Batch.Step(Params, Step);
+		Accumulator -= Step;
+		++Substeps;
+	}
+	if (Substeps == MaxSubsteps)
+	{
+		Accumulator = FMath::Min(Accumulator, static_cast<double>(Step));
+	}
+
+	// 4. Scatter pose and telemetry
+	const float RpmRange = FMath::Max(Params.RedlineRPM - Params.IdleRPM, 1.0f);
+	const int32 NumGears = FMath::Max(Params.GearRatios.Num(), 1);
+	for (const TPair<AKinematicVehiclePawn*, int32>& Entry : Active)
+	{
+		AKinematicVehiclePawn* Pawn = Entry.Key;
+		const int32 Slot = Entry.Value;
+		const FRotator Rotation(0.0f, FMath::RadiansToDegrees(Batch.Yaw[Slot]), 0.0f);
+		Pawn->SetActorLocationAndRotation(Batch.GetLocationCm(Slot), Rotation);
+
+		const FVector Velocity = Batch.GetVelocityCm(Slot);
+		if (USceneComponent* Root = Pawn->GetRootComponent())
+		{
+			Root->ComponentVelocity = Velocity;
+		}
+		Pawn->SetTelemetry(Velocity,
+			FMath::Clamp((Batch.EngineRPM[Slot] - Params.IdleRPM) / RpmRange, 0.0f, 1.0f),
+			static_cast<int32>(Batch.Gear[Slot]), NumGears,
+			Batch.LongitudinalAccel[Slot], Batch.LateralAccel[Slot]);
+	}
+
+	// Read back after the move so a sweep/attachment adjustment is not mistaken for a reset next update
+	for (const entt::entity Entity : View)
+	{
+		FKinematicVehicleComponent& Kinematic = View.get<FKinematicVehicleComponent>(Entity);
+		if (Kinematic.Slot != INDEX_NONE)
+		{
+			if (const APawn* Pawn = View.get<FVehicleComponent>(Entity).VehiclePawn)
+			{
+				Kinematic.LastWrittenLocation = Pawn->GetActorLocation();
+			}
+		}
+	}
+}
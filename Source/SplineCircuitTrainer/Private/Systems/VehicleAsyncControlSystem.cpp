@@ -0,0 +1,254 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/VehicleAsyncControlSystem.h"
+#include "VehicleComponent.h"
+#include "VehicleNNInterface.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "Components/NNIOComponents.h"
+#include "Components/NetworkComponent.h"
+#include "Components/GenomeComponents.h"
+#include "Components/SplineComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Pawn.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PBDRigidsSolver.h"
+
+namespace
+{
+	void OnAsyncControlDestroyed(entt::registry& Registry, entt::entity Entity)
+	{
+		const FVehicleAsyncControlComponent& AsyncComp = Registry.get<FVehicleAsyncControlComponent>(Entity);
+		if (AsyncComp.Alive)
+		{
+			AsyncComp.Alive->store(false, std::memory_order_release);
+		}
+	}
+}
+
+UVehicleAsyncControlSystem::UVehicleAsyncControlSystem()
+{
+	RegisterComponent<FVehicleComponent>();
+	RegisterComponent<FNeuralNetworkFloat>();
+	RegisterComponent<FNNOutFloatComp>();
+}
+
+void UVehicleAsyncControlSystem::Update_Implementation(float DeltaTime)
+{
+	AVehicleTrainerContext* TrainerContext = GetTypedContext<AVehicleTrainerContext>();
+	if (!TrainerContext || !TrainerContext->TrainerConfig)
+	{
+		return;
+	}
+
+	const UVehicleTrainerConfig& Config = *TrainerContext->TrainerConfig;
+	entt::registry& Registry = GetRegistry();
+
+	USplineComponent* Spline = TrainerContext->GetCircuitSpline();
+	FSplineTrackIndex& Track = FSplineTrackIndex::Get(Registry);
+	if (!Config.bAsyncPhysicsControl || !Spline || !Track.EnsureBuilt(Spline, Config.TrackSampleSpacing) || !EnsureCallback())
+	{
+		// Every vehicle is evaluated by the chain
+		ReleaseCallback();
+		Registry.clear<FNNExternalEvaluationTag>();
+		return;
+	}
+
+	RefreshShared(Config, Track, *Spline);
+
+	if (!bDestroySignalConnected)
+	{
+		Registry.on_destroy<FVehicleAsyncControlComponent>().disconnect<&OnAsyncControlDestroyed>();
+		Registry.on_destroy<FVehicleAsyncControlComponent>().connect<&OnAsyncControlDestroyed>();
+		bDestroySignalConnected = true;
+	}
+
+	// 1) Only the latest decision matters; older outputs were already applied on the physics thread or superseded
+	TSimCallbackOutputHandle<FVehicleAsyncControlOutput> Latest;
+	while (TSimCallbackOutputHandle<FVehicleAsyncControlOutput> Output = Callback->PopOutputData_External())
+	{
+		Latest = MoveTemp(Output);
+	}
+	if (Latest)
+	{
+		ApplyOutputs(*Latest, Config.VehicleOutputCount);
+	}
+
+	// 2) Vehicle list for the next physics steps
+	FVehicleAsyncControlInput* Input = Callback->GetProducerInputData_External();
+	Input->Shared = Shared;
+	Input->Agents.Reset();
+
+	auto View = Registry.view<FVehicleComponent, FNeuralNetworkFloat>();
+	for (const entt::entity Entity : View)
+	{
+		FVehicleComponent& VehicleComp = View.get<FVehicleComponent>(Entity);
+		APawn* Pawn = IsValid(VehicleComp.VehiclePawn) ? VehicleComp.VehiclePawn.Get() : nullptr;
+		const UPrimitiveComponent* Root = Pawn ? Cast<UPrimitiveComponent>(Pawn->GetRootComponent()) : nullptr;
+		const FBodyInstance* BodyInstance = Root ? Root->GetBodyInstance() : nullptr;
+		Chaos::FSingleParticlePhysicsProxy* Proxy = BodyInstance && BodyInstance->IsInstanceSimulatingPhysics() ? BodyInstance->GetPhysicsActorHandle() : nullptr;
+		if (!Proxy)
+		{
+			// No simulated body to read on the physics thread: the chain keeps evaluating this vehicle
+			Registry.remove<FNNExternalEvaluationTag>(Entity);
+			Registry.remove<FVehicleAsyncControlComponent>(Entity);
+			continue;
+		}
+
+		FVehicleAsyncControlComponent& AsyncComp = Registry.get_or_emplace<FVehicleAsyncControlComponent>(Entity);
+		if (!AsyncComp.Alive)
+		{
+			AsyncComp.Alive = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(true);
+			Pawn->OnDestroyed.AddUniqueDynamic(this, &UVehicleAsyncControlSystem::HandlePawnDestroyed);
+		}
+
+		// A reset assigns a new solution id; hand the physics thread a copy of the (possibly bred) network
+		const FUniqueSolutionComponent* Solution = Registry.try_get<FUniqueSolutionComponent>(Entity);
+		const int64 SolutionId = Solution ? Solution->Id : 0;
+		if (!AsyncComp.Network || AsyncComp.SolutionId != SolutionId)
+		{
+			AsyncComp.Network = MakeShared<FVehicleControlNetwork, ESPMode::ThreadSafe>(View.get<FNeuralNetworkFloat>(Entity).Network);
+			AsyncComp.SolutionId = SolutionId;
+		}
+
+		FVehicleAsyncAgentInput& Agent = Input->Agents.AddDefaulted_GetRef();
+		Agent.Entity = Entity;
+		Agent.Proxy = Proxy;
+		Agent.Alive = AsyncComp.Alive;
+		Agent.Control = VehicleComp.GetNNInterface();
+		Agent.Network = AsyncComp.Network;
+		if (Agent.Control)
+		{
+			Agent.Control->FillTelemetry(Agent.Telemetry);
+		}
+
+		if (!Registry.all_of<FNNExternalEvaluationTag>(Entity))
+		{
+			Registry.emplace<FNNExternalEvaluationTag>(Entity);
+		}
+	}
+}
+
+void UVehicleAsyncControlSystem::HandlePawnDestroyed(AActor* DestroyedActor)
+{
+	if (!GetContext())
+	{
+		return;
+	}
+
+	// Removing the component clears its Alive flag before the body proxy and the pawn are released
+	entt::registry& Registry = GetRegistry();
+	auto View = Registry.view<FVehicleComponent, FVehicleAsyncControlComponent>();
+	for (const entt::entity Entity : View)
+	{
+		if (View.get<FVehicleComponent>(Entity).VehiclePawn == DestroyedActor)
+		{
+			Registry.remove<FNNExternalEvaluationTag>(Entity);
+			Registry.remove<FVehicleAsyncControlComponent>(Entity);
+		}
+	}
+}
+
+void UVehicleAsyncControlSystem::Deinitialize_Implementation()
+{
+	ReleaseCallback();
+	Super::Deinitialize_Implementation();
+}
+
+bool UVehicleAsyncControlSystem::EnsureCallback()
+{
+	UWorld* World = GetContext() ? GetContext()->GetWorld() : nullptr;
+	FPhysScene* PhysScene = World ? World->GetPhysicsScene() : nullptr;
+	Chaos::FPBDRigidsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr;
+	if (Callback && Solver == CallbackSolver)
+	{
+		return true;
+	}
+
+	ReleaseCallback();
+	if (!Solver)
+	{
+		return false;
+	}
+
+	if (!UPhysicsSettings::Get()->bTickPhysicsAsync && !bHasLoggedSyncPhysics)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UVehicleAsyncControlSystem: async physics is disabled in the project settings; control runs on the synchronous physics step"));
+		bHasLoggedSyncPhysics = true;
+	}
+
+	Callback = Solver->CreateAndRegisterSimCallbackObject_External<FVehicleAsyncControlCallback>();
+	CallbackSolver = Solver;
+	return Callback != nullptr;
+}
+
+void UVehicleAsyncControlSystem::ReleaseCallback()
+{
+	if (Callback && CallbackSolver)
+	{
+		CallbackSolver->UnregisterAndFreeSimCallbackObject_External(Callback);
+	}
+	Callback = nullptr;
+	CallbackSolver = nullptr;
+}
+
+void UVehicleAsyncControlSystem::RefreshShared(const UVehicleTrainerConfig& Config, const FSplineTrackIndex& Track, const USplineComponent& Spline)
+{
+	// Keyed on the config's values, so runtime edits of the same asset rebuild the data too
+	const uint32 ConfigHash = FVehicleAsyncControlShared::HashConfig(Config);
+	if (Shared && SharedConfigHash == ConfigHash && SharedTrackStamp == Track.GetBuildStamp())
+	{
+		return;
+	}
+
+	// Physics steps still holding the previous data keep it alive through their own reference
+	TSharedPtr<FVehicleAsyncControlShared, ESPMode::ThreadSafe> NewShared = MakeShared<FVehicleAsyncControlShared, ESPMode::ThreadSafe>();
+	NewShared->Track = Track;
+	NewShared->Track.RefineIterations = 0;
+	NewShared->Schema.Compile(Config);
+	NewShared->FutureDistances = Config.FutureDotProductDistances;
+	NewShared->InputContext.Init(Config, NewShared->Track, Spline);
+	NewShared->InputContext.FutureDistances = &NewShared->FutureDistances;
+	NewShared->RecurrentInputCount = Config.RecurrentInputCount;
+	NewShared->NetworkOutputCount = Config.GetTotalOutputCount();
+	NewShared->ControlOutputCount = Config.VehicleOutputCount;
+	NewShared->ControlPeriod = 1.0f / FMath::Max(Config.AsyncControlHz, 1.0f);
+
+	Shared = NewShared;
+	SharedConfigHash = ConfigHash;
+	SharedTrackStamp = Track.GetBuildStamp();
+}
+
+void UVehicleAsyncControlSystem::ApplyOutputs(const FVehicleAsyncControlOutput& Output, int32 ControlOutputCount)
+{
+	entt::registry& Registry = GetRegistry();
+	const int32 Stride = Output.OutputStride;
+
+	for (int32 i = 0; i < Output.Entities.Num(); ++i)
+	{
+		const entt::entity Entity = Output.Entities[i];
+		if (!Registry.valid(Entity) || !Registry.all_of<FNNExternalEvaluationTag>(Entity))
+		{
+			continue;
+		}
+
+		const TArrayView<const float> Values(Output.Outputs.GetData() + i * Stride, Stride);
+		if (FNNOutFloatComp* OutComp = Registry.try_get<FNNOutFloatComp>(Entity))
+		{
+			OutComp->Values.Reset(Stride);
+			OutComp->Values.Append(Values.GetData(), Stride);
+		}
+
+		// Vehicles that cannot take outputs on the physics thread get the latest decision here
+		if (!Output.AppliedInternal[i])
+		{
+			FVehicleComponent& VehicleComp = Registry.get<FVehicleComponent>(Entity);
+			if (IVehicleNNInterface* VehicleInterface = VehicleComp.GetNNInterface())
+			{
+				VehicleInterface->ApplyNNOutputs(Values.Left(FMath::Min(ControlOutputCount, Stride)));
+			}
+		}
+	}
+}
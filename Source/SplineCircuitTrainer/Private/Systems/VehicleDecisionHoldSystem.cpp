@@ -0,0 +1,100 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/VehicleDecisionHoldSystem.h"
+#include "VehicleComponent.h"
+#include "Components/VehicleDecisionComponent.h"
+#include "Components/SplineProjectionComponent.h"
+#include "Components/NNIOComponents.h"
+#include "VehicleLibrary.h"
+#include "VehicleShardSchedule.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "SplineTrackIndex.h"
+#include "Components/SplineComponent.h"
+#include "GameFramework/Pawn.h"
+
+UVehicleDecisionHoldSystem::UVehicleDecisionHoldSystem()
+{
+	RegisterComponent<FVehicleComponent>();
+	RegisterComponent<FNNOutFloatComp>();
+	RegisterComponent<FVehicleDecisionComponent>();
+}
+
+void UVehicleDecisionHoldSystem::Update_Implementation(float DeltaTime)
+{
+	AVehicleTrainerContext* TrainerContext = GetTypedContext<AVehicleTrainerContext>();
+	if (!TrainerContext || !TrainerContext->TrainerConfig)
+	{
+		return;
+	}
+
+	const UVehicleTrainerConfig& Config = *TrainerContext->TrainerConfig;
+	entt::registry& Registry = GetRegistry();
+
+	USplineComponent* Spline = TrainerContext->GetCircuitSpline();
+	FSplineTrackIndex& Track = FSplineTrackIndex::Get(Registry);
+	if (Config.DecisionHoldMaxSec <= 0.0f || !Spline || !Track.EnsureBuilt(Spline, Config.TrackSampleSpacing))
+	{
+		// Every vehicle decides every firing
+		Registry.clear<FNNHoldOutputTag>();
+		return;
+	}
+
+	// Time since this vehicle's network shard last ran, not the chain's (shorter) period
+	const float VehicleDeltaTime = FVehicleShardSchedule::GetVehicleDeltaTime(Registry, EVehicleShardChannel::Network, DeltaTime);
+	const float SplineLength = Track.GetLength();
+
+	auto View = Registry.view<FVehicleComponent, FNNOutFloatComp>(entt::exclude<FNNSkipEvaluationTag, FNNExternalEvaluationTag>);
+	FSplineProjectionComponent ProjectionScratch;
+
+	for (auto Entity : View)
+	{
+		const APawn* Pawn = View.get<FVehicleComponent>(Entity).VehiclePawn;
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		// Key inputs, measured as the input system does
+		const FSplineProjectionComponent& Projection = UVehicleLibrary::GetFrameProjection(Registry, Entity, Track, Pawn, ProjectionScratch);
+		const float LookaheadDistance = FMath::Clamp(Projection.Distance + Config.CurvatureLookaheadDistance, 0.0f, SplineLength);
+		const FVector LookaheadTangent = FVector(Track.SampleFeatures(LookaheadDistance).Tangent);
+		const float Curvature = 1.0f - FMath::Clamp(FVector::DotProduct(Projection.Tangent, LookaheadTangent), 0.0f, 1.0f);
+		const float LateralOffset = Projection.SignedLateralOffset;
+		const float Speed = Pawn->GetVelocity().Size();
+
+		// A missing component (new vehicle, or removed by the reset system) forces a decision
+		FVehicleDecisionComponent* Decision = Registry.try_get<FVehicleDecisionComponent>(Entity);
+		bool bDecide = Decision == nullptr;
+		if (Decision)
+		{
+			Decision->TimeSinceDecision += VehicleDeltaTime;
+			bDecide = Decision->TimeSinceDecision + KINDA_SMALL_NUMBER >= Config.DecisionHoldMaxSec
+				|| FMath::Abs(Curvature - Decision->Curvature) > Config.DecisionHoldCurvatureThreshold
+				|| FMath::Abs(LateralOffset - Decision->LateralOffset) > Config.DecisionHoldLateralOffsetCM
+				|| FMath::Abs(Speed - Decision->Speed) > Config.DecisionHoldSpeedCMS;
+		}
+		else
+		{
+			Decision = &Registry.emplace<FVehicleDecisionComponent>(Entity);
+		}
+
+		if (bDecide)
+		{
+			Decision->TimeSinceDecision = 0.0f;
+			Decision->Curvature = Curvature;
+			Decision->LateralOffset = LateralOffset;
+			Decision->Speed = Speed;
+			Decision->HeldTicks = 0;
+			Registry.remove<FNNHoldOutputTag>(Entity);
+		}
+		else
+		{
+			++Decision->HeldTicks;
+			if (!Registry.all_of<FNNHoldOutputTag>(Entity))
+			{
+				Registry.emplace<FNNHoldOutputTag>(Entity);
+			}
+		}
+	}
+}
@@ -4,15 +4,18 @@
 #include "VehicleTrainerContext.h"
 #include "VehicleTrainerConfig.h"
 #include "VehicleComponent.h"
-#include "VehicleLibrary.h"
+#include "VehicleSpawnPoint.h"
 #include "Components/TrainingDataComponent.h"
 #include "Components/NNIOComponents.h"
 #include "Components/SplineComponent.h"
 #include "Components/NetworkComponent.h"
 #include "Components/GenomeComponents.h"
+#include "Lineage/SolutionIdAllocator.h"
 #include "GameFramework/Pawn.h"
 #include "AIController.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
+#include "Async/ParallelFor.h"
 
 UVehicleEntityFactory::UVehicleEntityFactory()
 {
@@ -41,102 +44,180 @@ void UVehicleEntityFactory::Initialize_Implementation(AEcsContext* InContext)
 		return;
 	}
 
-	int32 Population = TrainerContext->TrainerConfig->Population;
-	int32 NumPopulations = TrainerContext->TrainerConfig->NumPopulations;
-	TSubclassOf<APawn> PawnClass = TrainerContext->TrainerConfig->VehiclePawnClass;
+	const UVehicleTrainerConfig& Config = *TrainerContext->TrainerConfig;
+	const int32 Population = Config.Population;
+	const int32 NumPopulations = Config.NumPopulations;
 
+	// Everything shared by all vehicles is resolved once
+	FVehicleSpawnPoint& SpawnPoint = FVehicleSpawnPoint::Get(InRegistry);
+	if (!SpawnPoint.EnsureBuilt(TrainerContext->GetCircuitSpline(), Config.SpawnParametricDistance, Config.SpawnVerticalOffset))
+	{
+		SpawnPoint = FVehicleSpawnPoint();
+		SpawnPoint.Location = TrainerContext->GetActorLocation();
+		SpawnPoint.Rotation = TrainerContext->GetActorRotation();
+	}
+
+	const TArray<FNeuralNetworkLayerDescriptor> LayerDescriptors = Config.GetNNLayerDescriptors();
+	const bool bHasNetwork = LayerDescriptors.Num() >= 2;
+
+	// 1) Create the pool: entities with their network and genome view, but no pawn (and so no NN buffers) yet
+	PendingVehicles.Reset(NumPopulations * Population);
+	NextPendingVehicle = 0;
 	for (int32 p = 0; p < NumPopulations; ++p)
 	{
 		for (int32 i = 0; i < Population; ++i)
 		{
-			// Create ECS entity
-			entt::entity Entity = InRegistry.create();
-
-			// Spawn Pawn
-			FActorSpawnParameters SpawnParams;
-			SpawnParams.Owner = TrainerContext;
-			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-			SpawnParams.Name = FName(*FString::Printf(TEXT("Vehicle_P%d_V%d"), p, i));
-			
-			FVector SpawnLocation;
-			FRotator SpawnRotation;
-
-			if (USplineComponent* Spline = TrainerContext->GetCircuitSpline())
-			{
-				UVehicleLibrary::GetVehicleSpawnTransform(Spline, TrainerContext->TrainerConfig->SpawnParametricDistance, TrainerContext->TrainerConfig->SpawnVerticalOffset, SpawnLocation, SpawnRotation);
-			}
-			else
-			{
-				SpawnLocation = TrainerContext->GetActorLocation();
-				SpawnRotation = TrainerContext->GetActorRotation();
-			}
-
-			APawn* NewPawn = World->SpawnActor<APawn>(PawnClass, SpawnLocation, SpawnRotation, SpawnParams);
-			
-			if (NewPawn)
-			{
+			const entt::entity Entity = InRegistry.create();
+			InRegistry.emplace<FNeuralNetworkFloat>(Entity);
+			InRegistry.emplace<FGenomeFloatViewComponent>(Entity);
+			PendingVehicles.Add({ Entity, p, i });
+		}
+	}
+
+	// 2) Build the networks on worker threads; each one only touches its own components
+	if (bHasNetwork)
+	{
+		TArray<TPair<FNeuralNetworkFloat*, FGenomeFloatViewComponent*>> Networks;
+		Networks.Reserve(PendingVehicles.Num());
+		for (const FPendingVehicle& Pending : PendingVehicles)
+		{
+			Networks.Emplace(&InRegistry.get<FNeuralNetworkFloat>(Pending.Entity), &InRegistry.get<FGenomeFloatViewComponent>(Pending.Entity));
+		}
+
+		ParallelFor(Networks.Num(), [&](int32 Index)
+		{
+			const FPendingVehicle& Pending = PendingVehicles[Index];
+			FNeuralNetworkFloat& NetComp = *Networks[Index].Key;
+			NetComp.Initialize(LayerDescriptors, Pending.Population * Population + Pending.Index);
+
+			// Link Genome View to Network Data
+			Networks[Index].Value->Values = NetComp.Network.GetDataView();
+		});
+	}
+
+	// 3) Spawn the first batch now so training starts this frame; the rest follow one batch per frame
+	SpawnPendingVehicles();
+}
+
+void UVehicleEntityFactory::Deinitialize_Implementation()
+{
+	if (AEcsContext* EcsContext = GetContext())
+	{
+		if (UWorld* World = EcsContext->GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(SpawnTimerHandle);
+		}
+	}
+	PendingVehicles.Reset();
+	NextPendingVehicle = 0;
+
+	Super::Deinitialize_Implementation();
+}
+
+void UVehicleEntityFactory::SpawnPendingVehicles()
+{
+	AVehicleTrainerContext* TrainerContext = GetTypedContext<AVehicleTrainerContext>();
+	UWorld* World = TrainerContext ? TrainerContext->GetWorld() : nullptr;
+	if (!World || !TrainerContext->TrainerConfig)
+	{
+		return;
+	}
+
+	// A manual call replaces the scheduled batch instead of adding one
+	World->GetTimerManager().ClearTimer(SpawnTimerHandle);
+
+	const UVehicleTrainerConfig& Config = *TrainerContext->TrainerConfig;
+	const int32 Budget = Config.SpawnBudgetPerFrame > 0 ? Config.SpawnBudgetPerFrame : PendingVehicles.Num();
+	entt::registry& Registry = GetRegistry();
+
+	int32 Spawned = 0;
+	while (NextPendingVehicle < PendingVehicles.Num() && Spawned < Budget)
+	{
+		const FPendingVehicle& Pending = PendingVehicles[NextPendingVehicle++];
+		if (Registry.valid(Pending.Entity) && SpawnVehicle(Pending, Config))
+		{
+			++Spawned;
+		}
+	}
+
+	if (NextPendingVehicle < PendingVehicles.Num())
+	{
+		SpawnTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UVehicleEntityFactory::SpawnPendingVehicles);
+	}
+	else
+	{
+		PendingVehicles.Empty();
+		NextPendingVehicle = 0;
+	}
+}
+
+bool UVehicleEntityFactory::SpawnVehicle(const FPendingVehicle& Pending, const UVehicleTrainerConfig& Config)
+{
+	AVehicleTrainerContext* TrainerContext = GetTypedContext<AVehicleTrainerContext>();
+	UWorld* World = TrainerContext->GetWorld();
+	entt::registry& InRegistry = GetRegistry();
+	const int32 p = Pending.Population;
+	const int32 i = Pending.Index;
+
+	// Spawn Pawn
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = TrainerContext;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.Name = FName(*FString::Printf(TEXT("Vehicle_P%d_V%d"), p, i));
+
+	const FVehicleSpawnPoint& SpawnPoint = FVehicleSpawnPoint::Get(InRegistry);
+	APawn* NewPawn = World->SpawnActor<APawn>(Config.VehiclePawnClass, SpawnPoint.Location, SpawnPoint.Rotation, SpawnParams);
+	if (!NewPawn)
+	{
+		return false;
+	}
+
 #if WITH_EDITOR
-				NewPawn->SetActorLabel(FString::Printf(TEXT("Vehicle_P%d_V%d"), p, i));
+	NewPawn->SetActorLabel(FString::Printf(TEXT("Vehicle_P%d_V%d"), p, i));
 #endif
-				// Spawn AI Controller and possess
-				if (AAIController* AIController = World->SpawnActor<AAIController>())
-				{
-					AIController->Possess(NewPawn);
-				}
-
-				// Add VehicleComponent to entity with pawn reference
-				InRegistry.emplace<FVehicleComponent>(Entity, NewPawn);
-
-				// Add training data component
-				FTrainingDataComponent& TrainingData = InRegistry.emplace<FTrainingDataComponent>(Entity);
-				USplineComponent* Spline = TrainerContext->GetCircuitSpline();
-				UVehicleLibrary::SetTrainingData(TrainingData, Spline, SpawnLocation, World->GetTimeSeconds());
-				
-				// Initialize segment pass count array to match number of spline segments
-				// For a closed/looped spline with N points there are N segments (last point connects back to first)
-				// For an open spline with N points there are N-1 segments
-				if (Spline)
-				{
-					int32 NumPoints = Spline->GetNumberOfSplinePoints();
-					int32 NumSegments = NumPoints > 1 ? (Spline->IsClosedLoop() ? NumPoints : NumPoints - 1) : 0;
-					if (NumSegments > 0)
-					{
-						TrainingData.SegmentPassCount.Init(0, NumSegments);
-					}
-				}
-				
-
-				// Add NN Input and Output components
-				FNNInFLoatComp& InComp = InRegistry.emplace<FNNInFLoatComp>(Entity);
-				FNNOutFloatComp& OutComp = InRegistry.emplace<FNNOutFloatComp>(Entity);
-				FNeuralNetworkFloat& NetComp = InRegistry.emplace<FNeuralNetworkFloat>(Entity);
-
-				// Add Genome component
-				FGenomeFloatViewComponent& GenomeView = InRegistry.emplace<FGenomeFloatViewComponent>(Entity);
-
-				// Add Fitness component
-				FFitnessComponent& FitComp = InRegistry.emplace<FFitnessComponent>(Entity);
-				FitComp.Fitness.AddZeroed(p+1);
-				FitComp.BuiltForFitnessIndex = p;
-
-				// Add Unique ID component
-				FUniqueSolutionComponent& UniqueComp = InRegistry.emplace<FUniqueSolutionComponent>(Entity);
-				UniqueComp.Id = FUniqueSolutionComponent::GenerateNewId();
-
-				// Initialize Neural Network from config
-				TArray<FNeuralNetworkLayerDescriptor> LayerDescriptors = TrainerContext->TrainerConfig->GetNNLayerDescriptors();
-				if (LayerDescriptors.Num() >= 2)
-				{
-					NetComp.Initialize(LayerDescriptors, p * Population + i);
-					
-					// Link Genome View to Network Data
-					GenomeView.Values = NetComp.Network.GetDataView();
-
-					// Set NN input and output sizes based on descriptors
-					InComp.Values.Init(0.5f, TrainerContext->TrainerConfig->GetTotalInputCount());
-					OutComp.Values.SetNumZeroed(TrainerContext->TrainerConfig->GetTotalOutputCount());
-				}
-			}
+	// Spawn AI Controller and possess
+	if (Config.bSpawnAIControllers)
+	{
+		if (AAIController* AIController = World->SpawnActor<AAIController>())
+		{
+			AIController->Possess(NewPawn);
 		}
 	}
+
+	const entt::entity Entity = Pending.Entity;
+
+	// Add VehicleComponent to entity with pawn reference; resolve its NN interface once here
+	InRegistry.emplace<FVehicleComponent>(Entity, NewPawn).GetNNInterface();
+
+	// NN buffers come with the pawn, so the feedforward only sees entities that can be driven
+	FNNInFLoatComp& InComp = InRegistry.emplace<FNNInFLoatComp>(Entity);
+	FNNOutFloatComp& OutComp = InRegistry.emplace<FNNOutFloatComp>(Entity);
+	if (InRegistry.get<FNeuralNetworkFloat>(Entity).Network.GetInputSize() > 0)
+	{
+		InComp.Values.Init(0.5f, Config.GetTotalInputCount());
+		OutComp.Values.SetNumZeroed(Config.GetTotalOutputCount());
+	}
+
+	// Add training data component
+	FTrainingDataComponent& TrainingData = InRegistry.emplace<FTrainingDataComponent>(Entity);
+	SpawnPoint.InitTrainingData(TrainingData, World->GetTimeSeconds());
+
+	// Initialize segment pass count array to match number of spline segments
+	if (SpawnPoint.NumSegments > 0)
+	{
+		TrainingData.SegmentPassCount.Init(0, SpawnPoint.NumSegments);
+	}
+
+	// Add Fitness component
+	// Filled before emplace so on_construct observers see the final population index
+	FFitnessComponent FitComp;
+	FitComp.Fitness.AddZeroed(p+1);
+	FitComp.BuiltForFitnessIndex = p;
+	InRegistry.emplace<FFitnessComponent>(Entity, MoveTemp(FitComp));
+
+	// Add Unique ID component
+	FUniqueSolutionComponent& UniqueComp = InRegistry.emplace<FUniqueSolutionComponent>(Entity);
+	UniqueComp.Id = FSolutionIdAllocator::Get(InRegistry).Allocate();
+
+	return true;
 }
@@ -4,6 +4,7 @@
 #include "Components/TrainingDataComponent.h"
 #include "Components/GenomeComponents.h"
 #include "Components/EliteComponents.h"
+#include "PopulationIndex.h"
 #include "VehicleTrainerContext.h"
 #include "VehicleTrainerConfig.h"
 #include "Engine/World.h"
@@ -26,31 +27,19 @@ void UVehicleFitnessEligibilitySystem::Update_Implementation(float DeltaTime)
 	float CurrentTime = GetContext()->GetWorld()->GetTimeSeconds();
 	UVehicleTrainerConfig* Config = TrainerContext->TrainerConfig;
 
+	// Tags are recorded and inserted in one batch at the end; the views below exclude elites and
+	// reset-flagged entities where needed, so none of them depends on tags added earlier this tick.
+
 	// 1. Ensure all elites are marked as eligible.
 	// Elites might not have FResetGenomeComponent, but they should always be eligible for breeding.
 	auto EliteView = GetRegistry().view<FEliteTagComponent>(entt::exclude_t<FEligibleForBreedingTagComponent>{});
 	for (auto Entity : EliteView)
 	{
-		GetRegistry().emplace<FEligibleForBreedingTagComponent>(Entity);
+		CommandBuffer.Emplace<FEligibleForBreedingTagComponent>(Entity);
 	}
 
-	// Find the highest fitness per population index
-	TMap<int32, float> MaxFitnessPerPop;
-	auto AllFitnessView = GetView<FFitnessComponent>();
-
-	for (auto Entity : AllFitnessView)
-	{
-		const FFitnessComponent& Fit = AllFitnessView.get<FFitnessComponent>(Entity);
-		const int32 PopIdx = Fit.BuiltForFitnessIndex;
-		if (PopIdx >= 0 && PopIdx < Fit.Fitness.Num())
-		{
-			float& PopMax = MaxFitnessPerPop.FindOrAdd(PopIdx);
-			if (Fit.Fitness[PopIdx] > PopMax)
-			{
-				PopMax = Fit.Fitness[PopIdx];
-			}
-		}
-	}
+	// Highest fitness per population comes from the incrementally maintained index
+	const FPopulationIndex& Index = FPopulationIndex::Get(GetRegistry());
 
 	// 3. Identify entities eligible for breeding
 	// Criteria:
@@ -90,34 +79,9 @@ void UVehicleFitnessEligibilitySystem::Update_Implementation(float DeltaTime)
 			continue;
 		}
 
-		float Age = CurrentTime - Data.CreationTime;
-		
-		if (Age < Config->MinBreedAge)
+		if (MeetsBreedThreshold(*Config, Index, Data, FitComp, CurrentTime))
 		{
-			continue;
-		}
-
-		const int32 PopIdx = FitComp.BuiltForFitnessIndex;
-		float MaxFitness = -MAX_FLT;
-		if (PopIdx >= 0 && PopIdx < FitComp.Fitness.Num())
-		{
-			MaxFitness = MaxFitnessPerPop.FindRef(PopIdx);
-		}
-
-		float EntityFitness = (PopIdx >= 0 && PopIdx < FitComp.Fitness.Num()) ? FitComp.Fitness[PopIdx] : -MAX_FLT;
-
-		// Eligibility check:
-		// If MaxFitness is still very low, we might want a minimum threshold or just let them through if they lived long enough.
-		// But the prompt says "at least that much" of the highest fitness.
-		bool bPassFitnessThreshold = true;
-		if (MaxFitness > -MAX_FLT)
-		{
-			bPassFitnessThreshold = (EntityFitness >= MaxFitness * Config->HighestFitnessFactor);
-		}
-
-		if (bPassFitnessThreshold)
-		{
-			GetRegistry().emplace<FEligibleForBreedingTagComponent>(Entity);
+			CommandBuffer.Emplace<FEligibleForBreedingTagComponent>(Entity);
 		}
 	}
 
@@ -131,30 +95,30 @@ void UVehicleFitnessEligibilitySystem::Update_Implementation(float DeltaTime)
 		const FTrainingDataComponent& Data = ActiveView.get<FTrainingDataComponent>(Entity);
 		const FFitnessComponent& FitComp = ActiveView.get<FFitnessComponent>(Entity);
 
-		float Age = CurrentTime - Data.CreationTime;
-		if (Age < Config->MinBreedAge)
-		{
-			continue;
-		}
-
-		const int32 PopIdx = FitComp.BuiltForFitnessIndex;
-		float MaxFitness = -MAX_FLT;
-		if (PopIdx >= 0 && PopIdx < FitComp.Fitness.Num())
+		if (MeetsBreedThreshold(*Config, Index, Data, FitComp, CurrentTime))
 		{
-			MaxFitness = MaxFitnessPerPop.FindRef(PopIdx);
+			CommandBuffer.Emplace<FEligibleForBreedingTagComponent>(Entity);
 		}
+	}
 
-		float EntityFitness = (PopIdx >= 0 && PopIdx < FitComp.Fitness.Num()) ? FitComp.Fitness[PopIdx] : -MAX_FLT;
+	CommandBuffer.Playback(GetRegistry());
+}
 
-		bool bPassActive = true;
-		if (MaxFitness > -MAX_FLT)
-		{
-			bPassActive = (EntityFitness >= MaxFitness * Config->HighestFitnessFactor);
-		}
+bool UVehicleFitnessEligibilitySystem::MeetsBreedThreshold(const UVehicleTrainerConfig& Config, const FPopulationIndex& Index, const FTrainingDataComponent& Data, const FFitnessComponent& FitComp, float CurrentTime)
+{
+	const float Age = CurrentTime - Data.CreationTime;
+	if (Age < Config.MinBreedAge)
+	{
+		return false;
+	}
 
-		if (bPassActive)
-		{
-			GetRegistry().emplace<FEligibleForBreedingTagComponent>(Entity);
-		}
+	// Without a valid population there is nothing to compare against
+	const int32 PopIdx = FitComp.BuiltForFitnessIndex;
+	if (PopIdx < 0 || PopIdx >= FitComp.Fitness.Num())
+	{
+		return true;
 	}
+	// Floored at 0: per-population maxima have always started from a zero baseline
+	const float MaxFitness = FMath::Max(0.0f, Index.GetMaxFitness(PopIdx));
+	return FitComp.Fitness[PopIdx] >= MaxFitness * Config.HighestFitnessFactor;
 }
@@ -5,6 +5,7 @@
 #include "Components/GenomeComponents.h"
 #include "VehicleTrainerContext.h"
 #include "Components/SplineComponent.h"
+#include "VehicleShardSchedule.h"
 
 UVehicleFitnessSystem::UVehicleFitnessSystem()
 {
@@ -14,7 +15,7 @@ UVehicleFitnessSystem::UVehicleFitnessSystem()
 
 void UVehicleFitnessSystem::Update_Implementation(float DeltaTime)
 {
-	auto View = GetView<FTrainingDataComponent, FFitnessComponent>();
+	auto View = GetRegistry().view<FTrainingDataComponent, FFitnessComponent>(entt::exclude<FGASkipEvaluationTag>);
 
 	// Get total number of segments from the spline (used for fitness scaling)
 	int32 NumSegments = 0;
@@ -114,6 +115,8 @@ void UVehicleFitnessSystem::Update_Implementation(float DeltaTime)
 				Fitness = TrainingData.DistanceTraveled * TrainingData.DistanceTraveled;
 			}
 			FitComp.Fitness[FitnessIndex] = Fitness;
+			// Notify on_update observers (population index) of the in-place write
+			GetRegistry().patch<FFitnessComponent>(Entity);
 		}
 	}
 }
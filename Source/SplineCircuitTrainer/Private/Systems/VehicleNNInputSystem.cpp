@@ -3,7 +3,9 @@
 /**
  * VehicleNNInputSystem - Collects vehicle state for neural network inputs.
  *
- * Input Layout (all normalized to [-1, 1] or [0, 1]):
+ * The layout comes from UVehicleTrainerConfig::InputFeatures compiled into an FVehicleInputSchema: each enabled
+ * feature owns a run of inputs at its schema offset, disabled ones are neither laid out nor computed. The default
+ * list reproduces the original layout (all normalized to [-1, 1] or [0, 1]):
  *
  *  Spline Position (9 inputs):
  *   0: Signed distance to spline [-1,1]
@@ -38,16 +40,22 @@
  *  already feed the NN's previous output back into its input, so the network
  *  inherently knows what it commanded last frame.
  *
- *  Total: 28 base inputs + recurrent neurons
+ *  Total: 28 default inputs + recurrent neurons
  */
 
 #include "Systems/VehicleNNInputSystem.h"
 #include "VehicleComponent.h"
+#include "Components/SplineProjectionComponent.h"
+#include "VehicleLibrary.h"
 #include "Components/NNIOComponents.h"
 #include "VehicleTrainerContext.h"
 #include "VehicleTrainerConfig.h"
 #include "VehicleNNInterface.h"
+#include "KinematicVehicleModel.h"
+#include "Components/KinematicVehicleComponent.h"
 #include "Components/SplineComponent.h"
+#include "SplineTrackIndex.h"
+#include "Async/ParallelFor.h"
 
 UVehicleNNInputSystem::UVehicleNNInputSystem()
 {
@@ -70,244 +78,106 @@ void UVehicleNNInputSystem::Update_Implementation(float DeltaTime)
 	}
 
 	const UVehicleTrainerConfig& Config = *TrainerContext->TrainerConfig;
+	entt::registry& Registry = GetRegistry();
+
+	// All closest-point queries go through the baked track index
+	FSplineTrackIndex& Track = FSplineTrackIndex::Get(Registry);
+	if (!Track.EnsureBuilt(Spline, Config.TrackSampleSpacing))
+	{
+		return;
+	}
 
 	// Cache spline properties
-	const float SplineLength = Spline->GetSplineLength();
-	if (SplineLength <= 0.0f)
+	if (Track.GetLength() <= 0.0f)
 	{
 		return;
 	}
 
-	// Spline up vector (default up vector from spline component)
-	const FVector SplineUpVector = Spline->GetDefaultUpVector(ESplineCoordinateSpace::World) != FVector::ZeroVector
-		? Spline->GetDefaultUpVector(ESplineCoordinateSpace::World)
-		: FVector::UpVector;
+	FVehicleInputContext InputContext;
+	InputContext.Init(Config, Track, *Spline);
 
-	// Pre-compute reciprocal normalization factors (multiplication is faster than division)
-	const float InvMaxVelocityNorm    = 1.0f / Config.MaxVelocityNormalization;
-	const float InvMaxForwardVelocity = 1.0f / Config.MaxForwardVelocity;
-	const float InvMaxVerticalVelocity = 1.0f / Config.MaxVerticalVelocity;
-	const float InvMaxAngularVelocity  = 1.0f / Config.MaxAngularVelocityDegPerSec;
-	const float InvMaxDistance         = 1.0f / Config.MaxDistanceNormalization;
-	const float InvMaxHeight           = 1.0f / Config.MaxHeightDifferenceCM;
-	const float InvMaxPitchRoll        = 1.0f / Config.MaxPitchRollRadians;
-	const float InvSplineLength        = 1.0f / SplineLength;
-	const float LookaheadDistance      = Config.CurvatureLookaheadDistance;
+	// Feature layout, scales and clamp ranges: recompiled only when a value they depend on changes
+	if (Schema.CompiledHash != FVehicleInputSchema::HashConfig(Config))
+	{
+		Schema.Compile(Config);
+	}
+	const int32 TotalInputCount = Schema.Num() + Config.RecurrentInputCount;
+
+	const bool bNeedsAngularVelocity = Schema.Uses(EVehicleInputSource::AngularVelocity);
+	const bool bNeedsTelemetry = Schema.Uses(EVehicleInputSource::WheelsOnGround) || Schema.Uses(EVehicleInputSource::WheelContacts)
+		|| Schema.Uses(EVehicleInputSource::WheelCompressions) || Schema.Uses(EVehicleInputSource::EngineRPM) || Schema.Uses(EVehicleInputSource::Gear);
 
-	const int32 TotalInputCount = Config.GetTotalInputCount();
+	// 1) Snapshot: every UObject / interface call of the stage happens in this pass
+	InputBuffers.Reset();
+	States.Reset();
 
-	const TArray<float>& FutureDistances = Config.FutureDotProductDistances;
+	const FKinematicVehicleBatch* KinematicBatch = Registry.ctx().find<FKinematicVehicleBatch>();
 
-	auto View = GetView<FVehicleComponent, FNNInFLoatComp>();
+	// Vehicles outside the active network shard (FNNSkipEvaluationTag) or holding their outputs (FNNHoldOutputTag) keep
+	// last tick's inputs; the physics thread computes its own for FNNExternalEvaluationTag
+	auto View = Registry.view<FVehicleComponent, FNNInFLoatComp>(entt::exclude<FNNSkipEvaluationTag, FNNHoldOutputTag, FNNExternalEvaluationTag>);
+	FSplineProjectionComponent ProjectionScratch;
 
 	for (auto Entity : View)
 	{
-		const FVehicleComponent& VehicleComp = View.get<FVehicleComponent>(Entity);
+		FVehicleComponent& VehicleComp = View.get<FVehicleComponent>(Entity);
 		FNNInFLoatComp& InComp = View.get<FNNInFLoatComp>(Entity);
 
-		if (!VehicleComp.VehiclePawn)
+		APawn* Pawn = VehicleComp.VehiclePawn;
+		if (!Pawn)
 		{
 			continue;
 		}
 
-		APawn* Pawn = VehicleComp.VehiclePawn;
-
-		// Ensure input array is correctly sized
+		// Ensure input array is correctly sized; the feature pass writes through the raw pointer
 		InComp.Values.SetNumZeroed(TotalInputCount);
+		InputBuffers.Add(InComp.Values.GetData());
+		FVehicleInputState& State = States.AddDefaulted_GetRef();
 
-		// Get vehicle interface for wheel/engine data
-		const bool bImplementsInterface = Pawn->GetClass()->ImplementsInterface(UVehicleNNInterface::StaticClass());
-		const IVehicleNNInterface* VehicleInterface = bImplementsInterface ? Cast<IVehicleNNInterface>(Pawn) : nullptr;
+		// Closest point on spline, shared with the other systems this tick (FSplineProjectionComponent)
+		const FSplineProjectionComponent& Projection = UVehicleLibrary::GetFrameProjection(Registry, Entity, Track, Pawn, ProjectionScratch);
+		State.Location = Projection.VehicleLocation;
+		State.ClosestPoint = Projection.ClosestPoint;
+		State.Tangent = Projection.Tangent;
+		State.Distance = Projection.Distance;
 
-		// Actor transform and velocity
-		const FVector ActorLocation = Pawn->GetActorLocation();
 		const FRotator ActorRotation = Pawn->GetActorRotation();
-		const FVector ActorVelocity = Pawn->GetVelocity();
-
-		// Find closest point on spline (input key, not distance)
-		const float CurrentInputKey = Spline->FindInputKeyClosestToWorldLocation(ActorLocation);
-		const FVector SplineLocation = Spline->GetLocationAtSplineInputKey(CurrentInputKey, ESplineCoordinateSpace::World);
+		State.Forward = ActorRotation.Vector();
+		State.Pitch = FMath::DegreesToRadians(ActorRotation.Pitch);
+		State.Roll = FMath::DegreesToRadians(ActorRotation.Roll);
+		State.Velocity = Pawn->GetVelocity();
 
-		// Spline tangent at closest point
-		FVector SplineTangent = Spline->GetDirectionAtSplineInputKey(CurrentInputKey, ESplineCoordinateSpace::World);
-		if (SplineTangent.IsNearlyZero())
+		// Angular velocity from root primitive component (in degrees/s); kinematic surrogates have no body, use their yaw rate
+		if (bNeedsAngularVelocity)
 		{
-			SplineTangent = Spline->GetDirectionAtSplineInputKey(0, ESplineCoordinateSpace::World);
+			const FKinematicVehicleComponent* Kinematic = Registry.try_get<FKinematicVehicleComponent>(Entity);
+			if (KinematicBatch && Kinematic && Kinematic->Slot != INDEX_NONE)
+			{
+				State.AngularVelocity = FVector(0.0f, 0.0f, FMath::RadiansToDegrees(KinematicBatch->YawRate[Kinematic->Slot]));
+			}
+			else if (const UPrimitiveComponent* RootPrimitive = Cast<UPrimitiveComponent>(Pawn->GetRootComponent()))
+			{
+				State.AngularVelocity = RootPrimitive->GetPhysicsAngularVelocityInDegrees();
+			}
 		}
 
-		// Distance along spline for lookahead calculations
-		const float CurrentSplineDistance = Spline->GetDistanceAlongSplineAtLocation(ActorLocation, ESplineCoordinateSpace::World);
-
-		// Vector from spline to actor
-		const FVector ToActorVector = ActorLocation - SplineLocation;
-
-		// Spline right vector (perpendicular to tangent in horizontal plane)
-		const FVector SplineRightVector = FVector::CrossProduct(SplineTangent, SplineUpVector).GetSafeNormal();
-
-		// --- Calculate inputs ---
-
-		// Signed distance to spline
-		const float SignedDistance = FVector::DotProduct(ToActorVector, SplineRightVector);
-
-		// Height above/below spline
-		const float HeightAboveSpline = FVector::DotProduct(ToActorVector, SplineUpVector);
-
-		// Current orientation - Z cross product
-		const FVector ActorForward = ActorRotation.Vector();
-		const float CurrentOrientation = FVector::DotProduct(FVector::CrossProduct(SplineTangent, ActorForward), SplineUpVector);
-
-		// Future orientation dot products (use distance-based lookahead, not input key + distance)
-		TArray<float> FutureOrientations;
-		FutureOrientations.SetNum(FutureDistances.Num());
-		for (int32 i = 0; i < FutureDistances.Num(); ++i)
-		{
-			const float LookaheadDistanceAlongSpline = FMath::Clamp(CurrentSplineDistance + FutureDistances[i], 0.0f, SplineLength);
-			const float LookaheadInputKey = Spline->FindInputKeyClosestToWorldLocation(
-				Spline->GetLocationAtDistanceAlongSpline(LookaheadDistanceAlongSpline, ESplineCoordinateSpace::World));
-			const FVector FutureTangent = Spline->GetDirectionAtSplineInputKey(LookaheadInputKey, ESplineCoordinateSpace::World);
-			FutureOrientations[i] = FVector::DotProduct(FVector::CrossProduct(FutureTangent, ActorForward), SplineUpVector);
-		}
-
-		// Velocity magnitude
-		const float VelocityMagnitude = ActorVelocity.Size();
-
-		// Pitch and roll angles (convert degrees to radians for normalization)
-		const float PitchAngleRad = FMath::DegreesToRadians(ActorRotation.Pitch);
-		const float RollAngleRad = FMath::DegreesToRadians(ActorRotation.Roll);
-
-		// Angular velocity from root primitive component (in degrees/s)
-		const FVector AngularVelocity = Cast<UPrimitiveComponent>(Pawn->GetRootComponent())
-			? Cast<UPrimitiveComponent>(Pawn->GetRootComponent())->GetPhysicsAngularVelocityInDegrees()
-			: FVector::ZeroVector;
-
-		// Forward velocity along spline tangent
-		const float ForwardVelocityAlongSpline = FVector::DotProduct(ActorVelocity, SplineTangent);
-
-		// Lateral velocity (perpendicular to spline)
-		const float LateralVelocity = FVector::DotProduct(ActorVelocity, SplineRightVector);
-
-		// Vertical velocity
-		const float VerticalVelocity = FVector::DotProduct(ActorVelocity, SplineUpVector);
-
-		// Spline curvature ahead (use distance-based lookahead, not input key + distance)
-		const float CurvatureLookaheadDistance = FMath::Clamp(CurrentSplineDistance + LookaheadDistance, 0.0f, SplineLength);
-		const float CurvatureLookaheadKey = Spline->FindInputKeyClosestToWorldLocation(
-			Spline->GetLocationAtDistanceAlongSpline(CurvatureLookaheadDistance, ESplineCoordinateSpace::World));
-		const FVector CurvatureTangent = Spline->GetDirectionAtSplineInputKey(CurvatureLookaheadKey, ESplineCoordinateSpace::World);
-		const float Curvature = 1.0f - FMath::Clamp(FVector::DotProduct(SplineTangent, CurvatureTangent), 0.0f, 1.0f);
-
-		// Spline curvature direction (signed)
-		const float CurvatureDirection = FVector::DotProduct(FVector::CrossProduct(SplineTangent, CurvatureTangent), SplineUpVector);
-
-		// Spline progress (normalized 0-1 along circuit)
-		const float SplineProgress = CurrentSplineDistance * InvSplineLength;
-
-		// Engine state inputs from vehicle interface
-		float NormalizedRPM = 0.0f;
-		float NormalizedGear = 0.5f;
-		if (VehicleInterface)
-		{
-			NormalizedRPM = VehicleInterface->GetNormalizedRPM();
-			NormalizedGear = VehicleInterface->GetNormalizedGear(6);
-		}
-
-		// Per-wheel inputs from vehicle interface
-		TArray<float> WheelContactStates;
-		TArray<float> WheelSuspensionCompression;
+		// Wheel/engine telemetry: one virtual call on the interface cached in FVehicleComponent; defaults without it
+		const IVehicleNNInterface* VehicleInterface = bNeedsTelemetry ? VehicleComp.GetNNInterface() : nullptr;
 		if (VehicleInterface)
 		{
-			VehicleInterface->GetWheelContactStates(WheelContactStates);
-			VehicleInterface->GetWheelSuspensionCompression(WheelSuspensionCompression);
-		}
-
-		// Wheels on ground ratio
-		const float WheelsOnGroundRatio = VehicleInterface ? VehicleInterface->GetWheelsOnGroundRatio() : 1.0f;
-
-		// --- Write normalized inputs ---
-		int32 InputIndex = 0;
-
-		// --- Spline Position (9 inputs) ---
-
-		// 0: Signed distance to spline [-1,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(SignedDistance * InvMaxDistance, -1.0f, 1.0f);
-
-		// 1: Current orientation Z-cross product [-1,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(CurrentOrientation, -1.0f, 1.0f);
-
-		// 2,3: Future orientations [-1,1]
-		for (const float Orientation : FutureOrientations)
-		{
-			InComp.Values[InputIndex++] = FMath::Clamp(Orientation, -1.0f, 1.0f);
-		}
-
-		// 4: Height above/below spline [-1,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(HeightAboveSpline * InvMaxHeight, -1.0f, 1.0f);
-
-		// 5: Spline curvature ahead [0,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(Curvature, 0.0f, 1.0f);
-
-		// 6: Spline curvature direction (signed) [-1,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(CurvatureDirection, -1.0f, 1.0f);
-
-		// 7: Spline progress (normalized 0-1) [0,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(SplineProgress, 0.0f, 1.0f);
-
-		// 8: Forward velocity along spline tangent [-1,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(ForwardVelocityAlongSpline * InvMaxForwardVelocity, -1.0f, 1.0f);
-
-		// --- Vehicle Dynamics (6 inputs) ---
-
-		// 9: Velocity magnitude [0,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(VelocityMagnitude * InvMaxVelocityNorm, 0.0f, 1.0f);
-
-		// 10: Pitch angle [-1,1] (radians)
-		InComp.Values[InputIndex++] = FMath::Clamp(PitchAngleRad * InvMaxPitchRoll, -1.0f, 1.0f);
-
-		// 11: Roll angle [-1,1] (radians)
-		InComp.Values[InputIndex++] = FMath::Clamp(RollAngleRad * InvMaxPitchRoll, -1.0f, 1.0f);
-
-		// 12: Lateral velocity (perpendicular to spline) [-1,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(LateralVelocity * InvMaxVelocityNorm, -1.0f, 1.0f);
-
-		// 13: Vertical velocity [-1,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(VerticalVelocity * InvMaxVerticalVelocity, -1.0f, 1.0f);
-
-		// 14,15,16: Angular velocity (pitch/yaw/roll rates) [-1,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(AngularVelocity.X * InvMaxAngularVelocity, -1.0f, 1.0f);
-		InComp.Values[InputIndex++] = FMath::Clamp(AngularVelocity.Y * InvMaxAngularVelocity, -1.0f, 1.0f);
-		InComp.Values[InputIndex++] = FMath::Clamp(AngularVelocity.Z * InvMaxAngularVelocity, -1.0f, 1.0f);
-
-		// --- Wheels (9 inputs) ---
-
-		// 17: Wheels on ground ratio [0,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(WheelsOnGroundRatio, 0.0f, 1.0f);
-
-		// 18-21: Per-wheel contact states [0,1]
-		for (int32 i = 0; i < 4 && i < WheelContactStates.Num(); ++i)
-		{
-			InComp.Values[InputIndex++] = WheelContactStates[i];
-		}
-		while (InputIndex < 22)
-		{
-			InComp.Values[InputIndex++] = 0.0f;
+			VehicleInterface->FillTelemetry(State.Telemetry);
 		}
+	}
 
-		// 22-25: Per-wheel suspension compression [0,1]
-		for (int32 i = 0; i < 4 && i < WheelSuspensionCompression.Num(); ++i)
-		{
-			InComp.Values[InputIndex++] = WheelSuspensionCompression[i];
-		}
-		while (InputIndex < 26)
+	// 2) Features: pure math over the snapshot, chunked so each task amortizes its scheduling cost
+	const int32 NumVehicles = InputBuffers.Num();
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumVehicles, InputChunkSize);
+	ParallelFor(NumChunks, [this, &InputContext, NumVehicles](int32 ChunkIdx)
+	{
+		const int32 End = FMath::Min((ChunkIdx + 1) * InputChunkSize, NumVehicles);
+		for (int32 Index = ChunkIdx * InputChunkSize; Index < End; ++Index)
 		{
-			InComp.Values[InputIndex++] = 0.0f;
+			Schema.WriteInputs(States[Index], InputContext, InputBuffers[Index]);
 		}
-
-		// --- Engine (2 inputs) ---
-
-		// 26: Normalized engine RPM [0,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(NormalizedRPM, 0.0f, 1.0f);
-
-		// 27: Normalized current gear [0,1]
-		InComp.Values[InputIndex++] = FMath::Clamp(NormalizedGear, 0.0f, 1.0f);
-	}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 }
@@ -6,8 +6,6 @@
 #include "VehicleNNInterface.h"
 #include "VehicleTrainerContext.h"
 #include "VehicleTrainerConfig.h"
-#include "GameFramework/Pawn.h"
-#include "UObject/Interface.h"
 
 UVehicleNNOutputSystem::UVehicleNNOutputSystem()
 {
@@ -23,23 +21,21 @@ void UVehicleNNOutputSystem::Update_Implementation(float DeltaTime)
 		return;
 	}
 
-	auto View = GetView<FVehicleComponent, FNNOutFloatComp>();
+	auto View = GetRegistry().view<FVehicleComponent, FNNOutFloatComp>(entt::exclude<FNNSkipEvaluationTag, FNNExternalEvaluationTag>);
 
 	const int32 OutputCount = TrainerContext->TrainerConfig->VehicleOutputCount;
 
 	for (auto Entity : View)
 	{
-		const FVehicleComponent& VehicleComp = View.get<FVehicleComponent>(Entity);
+		FVehicleComponent& VehicleComp = View.get<FVehicleComponent>(Entity);
 		const FNNOutFloatComp& OutComp = View.get<FNNOutFloatComp>(Entity);
 
-		if (VehicleComp.VehiclePawn && VehicleComp.VehiclePawn->GetClass()->ImplementsInterface(UVehicleNNInterface::StaticClass()))
+		IVehicleNNInterface* VehicleInterface = VehicleComp.GetNNInterface();
+		if (VehicleInterface && OutComp.Values.Num() >= OutputCount)
 		{
-			if (OutComp.Values.Num() >= OutputCount)
-			{
-				// Only pass the first N elements (ignoring recurrence outputs)
-				TArrayView<const float> OutputView(OutComp.Values.GetData(), OutputCount);
-				Cast<IVehicleNNInterface>(VehicleComp.VehiclePawn)->ApplyNNOutputs(OutputView);
-			}
+			// Only pass the first N elements (ignoring recurrence outputs)
+			TArrayView<const float> OutputView(OutComp.Values.GetData(), OutputCount);
+			VehicleInterface->ApplyNNOutputs(OutputView);
 		}
 	}
 }
@@ -8,6 +8,10 @@
 #include "VehicleTrainerConfig.h"
 #include "Components/GenomeComponents.h"
 #include "Components/SplineComponent.h"
+#include "SplineTrackIndex.h"
+#include "Components/SplineProjectionComponent.h"
+#include "VehicleShardSchedule.h"
+#include "Components/NNIOComponents.h"
 #include "GameFramework/Pawn.h"
 
 UVehicleProgressSystem::UVehicleProgressSystem()
@@ -30,16 +34,24 @@ void UVehicleProgressSystem::Update_Implementation(float DeltaTime)
 		return;
 	}
 
-	float SplineLength = Spline->GetSplineLength();
-	if (SplineLength <= 0.0f)
+	float MinProgressPerPeriod = 0.0f;
+	float TrackSampleSpacing = GetDefault<UVehicleTrainerConfig>()->TrackSampleSpacing;
+	if (TrainerContext->TrainerConfig)
+	{
+		MinProgressPerPeriod = TrainerContext->TrainerConfig->MinimumProgressBetweenEvaluations;
+		TrackSampleSpacing = TrainerContext->TrainerConfig->TrackSampleSpacing;
+	}
+
+	FSplineTrackIndex& Track = FSplineTrackIndex::Get(GetRegistry());
+	if (!Track.EnsureBuilt(Spline, TrackSampleSpacing))
 	{
 		return;
 	}
 
-	float MinProgress = 0.0f;
-	if (TrainerContext->TrainerConfig)
+	float SplineLength = Track.GetLength();
+	if (SplineLength <= 0.0f)
 	{
-		MinProgress = TrainerContext->TrainerConfig->MinimumProgressBetweenEvaluations;
+		return;
 	}
 
 	// Pre-calculate segment count for normalized distance within segment
@@ -48,23 +60,32 @@ void UVehicleProgressSystem::Update_Implementation(float DeltaTime)
 	int32 NumPoints = Spline->GetNumberOfSplinePoints();
 	int32 NumSegments = NumPoints > 1 ? (Spline->IsClosedLoop() ? NumPoints : NumPoints - 1) : 0;
 
-	auto View = GetView<FVehicleComponent, FTrainingDataComponent>();
+	// Vehicles outside the chain's active shard are skipped; the others integrate the time since their shard last ran
+	auto View = GetRegistry().view<FVehicleComponent, FTrainingDataComponent>();
+	const float VehicleDeltaTime = FVehicleShardSchedule::GetVehicleDeltaTime(GetRegistry(), ShardChannel, DeltaTime);
+	const bool bGAChannel = ShardChannel == EVehicleShardChannel::GA;
+	FSplineProjectionComponent ProjectionScratch;
+
+	// The threshold is set per GA period; scaling it by the actual interval keeps the implied minimum speed
+	// the same whichever chain this instance runs in
+	const float MinProgress = MinProgressPerPeriod * VehicleDeltaTime / AVehicleTrainerContext::GADecisionPeriodSec;
 	
 	for (auto Entity : View)
 	{
 		const FVehicleComponent& VehicleComp = View.get<FVehicleComponent>(Entity);
 		FTrainingDataComponent& TrainingData = View.get<FTrainingDataComponent>(Entity);
 
-		if (!VehicleComp.VehiclePawn)
+		if (!VehicleComp.VehiclePawn || (bGAChannel ? GetRegistry().all_of<FGASkipEvaluationTag>(Entity) : GetRegistry().all_of<FNNSkipEvaluationTag>(Entity)))
 		{
 			continue;
 		}
 
 		APawn* Pawn = VehicleComp.VehiclePawn;
-		FVector PawnLocation = Pawn->GetActorLocation();
 
-		float CurrentSplineDistance = Spline->GetDistanceAlongSplineAtLocation(PawnLocation, ESplineCoordinateSpace::World);
-		float CurrentInputKey = Spline->FindInputKeyClosestToWorldLocation(PawnLocation);
+		// Shared per-tick projection; warm-started, falls back to a global search after teleports/resets
+		const FSplineProjectionComponent& Projection = UVehicleLibrary::GetFrameProjection(GetRegistry(), Entity, Track, Pawn, ProjectionScratch);
+		float CurrentSplineDistance = Projection.Distance;
+		float CurrentInputKey = Projection.InputKey;
 		int32 CurrentSegment = FMath::FloorToInt(CurrentInputKey);
 
 		float Delta = CurrentSplineDistance - TrainingData.LastSplineDistance;
@@ -130,7 +151,7 @@ void UVehicleProgressSystem::Update_Implementation(float DeltaTime)
 		}
 		else
 		{
-			TrainingData.TimeSinceLastProgress += DeltaTime;
+			TrainingData.TimeSinceLastProgress += VehicleDeltaTime;
 		}
 
 		// ---- Segment-based progress validation ----
@@ -0,0 +1,227 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/VehicleReactiveGASystem.h"
+#include "Systems/BreedFloatGenomesSystem.h"
+#include "Systems/MutationFloatGenomeSystem.h"
+#include "Systems/VehicleResetSystem.h"
+#include "Systems/VehicleFitnessEligibilitySystem.h"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+#include "Components/TrainingDataComponent.h"
+#include "Lineage/LineageArena.h"
+#include "PopulationIndex.h"
+#include "VehicleComponent.h"
+#include "VehicleLibrary.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "Engine/World.h"
+
+UVehicleReactiveGASystem::UVehicleReactiveGASystem()
+{
+	RegisterComponent<FVehicleComponent>();
+	RegisterComponent<FResetGenomeComponent>();
+	RegisterComponent<FFitnessComponent>();
+	RegisterComponent<FGenomeFloatViewComponent>();
+}
+
+void UVehicleReactiveGASystem::Update_Implementation(float DeltaTime)
+{
+	AVehicleTrainerContext* TrainerContext = GetTypedContext<AVehicleTrainerContext>();
+	if (!TrainerContext || !TrainerContext->TrainerConfig)
+	{
+		return;
+	}
+
+	entt::registry& Registry = GetRegistry();
+	auto View = Registry.view<FVehicleComponent, FResetGenomeComponent, FFitnessComponent, FGenomeFloatViewComponent>(entt::exclude<FEliteTagComponent>);
+	if (View.begin() == View.end())
+	{
+		return;
+	}
+	if (!Breeder || !Mutator || !Resetter)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("VehicleReactiveGASystem: Breeder, Mutator and Resetter must be set; flagged vehicles are left to the GA step."));
+		return;
+	}
+
+	if (!bRngSeeded)
+	{
+		Rng.Initialize(ContextSeed != 0 ? ContextSeed : FMath::Rand());
+		bRngSeeded = true;
+	}
+
+	const UVehicleTrainerConfig& Config = *TrainerContext->TrainerConfig;
+	const FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+	const float CurrentTime = GetContext()->GetWorld()->GetTimeSeconds();
+
+	// 1) Breed every replacement first: parents are read from live vehicles, which the resets below do not touch
+	Children.Reset();
+	Replaced.Reset();
+	CandidatePopulation = INDEX_NONE;
+	for (const entt::entity Entity : View)
+	{
+		const FFitnessComponent& Fit = View.get<FFitnessComponent>(Entity);
+		const int32 Pop = Fit.BuiltForFitnessIndex;
+		if (!Fit.Fitness.IsValidIndex(Pop) || WouldEnterElites(Config, Index, Entity, Pop, Fit.Fitness[Pop]))
+		{
+			continue;
+		}
+
+		// Re-randomized by the reset system instead of bred
+		if (View.get<FResetGenomeComponent>(Entity).ReasonForReset == UVehicleLibrary::ReasonBackwardStart)
+		{
+			Replaced.Add(Entity);
+			continue;
+		}
+
+		if (CandidatePopulation != Pop)
+		{
+			GatherCandidates(Config, Index, Pop, CurrentTime);
+		}
+		if (Candidates.Num() == 0)
+		{
+			continue;
+		}
+
+		const FCandidate& A = Candidates[RunTournament(Config)];
+		const FCandidate& B = Candidates[RunTournament(Config)];
+		const TArrayView<float> ChildGenome = View.get<FGenomeFloatViewComponent>(Entity).Values;
+		Breeder->BreedGenome(A.Genome, B.Genome, ChildGenome, &Rng);
+		Mutator->MutateGenome(ChildGenome, &Rng);
+
+		Children.Add({ Entity, A.Entity, B.Entity, Pop });
+		Replaced.Add(Entity);
+	}
+
+	if (Replaced.Num() == 0)
+	{
+		return;
+	}
+
+	// 2) One reset pass for all replaced vehicles (training data, fitness, solution id, teleport)
+	Resetter->ResetVehicles(Replaced);
+
+	// 3) Lineage for the bred children; the reset already gave every replaced vehicle a fresh id
+	if (Breeder->bRecordLineage)
+	{
+		for (const FChild& Child : Children)
+		{
+			FLineageArena::RecordBirth(Registry, Child.Entity, Child.ParentA, Child.ParentB, Child.Population);
+		}
+	}
+
+	Registry.remove<FResetGenomeComponent>(Replaced.GetData(), Replaced.GetData() + Replaced.Num());
+}
+
+bool UVehicleReactiveGASystem::WouldEnterElites(const UVehicleTrainerConfig& Config, const FPopulationIndex& Index, entt::entity Entity, int32 Pop, float Fitness)
+{
+	const entt::registry& Registry = GetRegistry();
+	const FUniqueSolutionComponent* Unique = Registry.try_get<FUniqueSolutionComponent>(Entity);
+	const TConstArrayView<entt::entity> Elites = Index.GetElites(Pop);
+
+	bool bHasWorst = false;
+	float WorstElite = 0.0f;
+	for (const entt::entity Elite : Elites)
+	{
+		const FFitnessComponent* EliteFit = Registry.try_get<FFitnessComponent>(Elite);
+		if (!EliteFit || !EliteFit->Fitness.IsValidIndex(Pop))
+		{
+			continue;
+		}
+		const float EliteFitness = EliteFit->Fitness[Pop];
+
+		// Already snapshotted: only an improvement on its own elite copy still matters
+		const FUniqueSolutionComponent* EliteUnique = Registry.try_get<FUniqueSolutionComponent>(Elite);
+		if (Unique && EliteUnique && EliteUnique->SourceId == Unique->Id)
+		{
+			return Config.bHigherIsBetter ? Fitness > EliteFitness : Fitness < EliteFitness;
+		}
+
+		if (!bHasWorst || (Config.bHigherIsBetter ? EliteFitness < WorstElite : EliteFitness > WorstElite))
+		{
+			WorstElite = EliteFitness;
+			bHasWorst = true;
+		}
+	}
+
+	if (Elites.Num() < Config.EliteCount || !bHasWorst)
+	{
+		return true;
+	}
+	return Config.bHigherIsBetter ? Fitness > WorstElite : Fitness < WorstElite;
+}
+
+void UVehicleReactiveGASystem::GatherCandidates(const UVehicleTrainerConfig& Config, const FPopulationIndex& Index, int32 Pop, float CurrentTime)
+{
+	const entt::registry& Registry = GetRegistry();
+	Candidates.Reset();
+	CandidatePopulation = Pop;
+
+	auto AddCandidate = [this, &Registry, Pop](entt::entity Entity, bool bIsElite)
+	{
+		const FGenomeFloatViewComponent* Genome = Registry.try_get<FGenomeFloatViewComponent>(Entity);
+		if (!Genome || Genome->Values.Num() == 0)
+		{
+			return;
+		}
+		FCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+		Candidate.Entity = Entity;
+		Candidate.Fitness = Registry.get<FFitnessComponent>(Entity).Fitness[Pop];
+		Candidate.bIsElite = bIsElite;
+		Candidate.Genome = Genome->Values;
+	};
+
+	for (const entt::entity Entity : Index.GetElites(Pop))
+	{
+		AddCandidate(Entity, true);
+	}
+
+	// Eligibility tags only exist during a GA step, so the breeding threshold is evaluated here
+	for (const entt::entity Entity : Index.GetMembers(Pop))
+	{
+		if (Index.IsElite(Entity) || Registry.any_of<FResetGenomeComponent>(Entity))
+		{
+			continue;
+		}
+		const FTrainingDataComponent* Data = Registry.try_get<FTrainingDataComponent>(Entity);
+		if (Data && UVehicleFitnessEligibilitySystem::MeetsBreedThreshold(Config, Index, *Data, Registry.get<FFitnessComponent>(Entity), CurrentTime))
+		{
+			AddCandidate(Entity, false);
+		}
+	}
+}
+
+bool UVehicleReactiveGASystem::IsBetter(const UVehicleTrainerConfig& Config, const FCandidate& A, const FCandidate& B) const
+{
+	if (Config.bElitesAlwaysWin && A.bIsElite != B.bIsElite)
+	{
+		return A.bIsElite;
+	}
+	return Config.bHigherIsBetter ? A.Fitness > B.Fitness : A.Fitness < B.Fitness;
+}
+
+int32 UVehicleReactiveGASystem::RunTournament(const UVehicleTrainerConfig& Config)
+{
+	const int32 Size = Candidates.Num();
+	const int32 K = FMath::Clamp(Config.TournamentSize, 1, Size);
+	int32 Best = INDEX_NONE;
+	int32 Second = INDEX_NONE;
+	for (int32 i = 0; i < K; ++i)
+	{
+		const int32 Pick = Rng.RandRange(0, Size - 1);
+		if (Best == INDEX_NONE || IsBetter(Config, Candidates[Pick], Candidates[Best]))
+		{
+			Second = Best;
+			Best = Pick;
+		}
+		else if (Second == INDEX_NONE || IsBetter(Config, Candidates[Pick], Candidates[Second]))
+		{
+			Second = Pick;
+		}
+	}
+	if (Second == INDEX_NONE || (Config.bElitesAlwaysWin && Candidates[Best].bIsElite))
+	{
+		return Best;
+	}
+	return (Config.SelectionPressure >= 1.0f || Rng.FRand() <= Config.SelectionPressure) ? Best : Second;
+}
@@ -5,9 +5,14 @@
 #include "Components/TrainingDataComponent.h"
 #include "Components/GenomeComponents.h"
 #include "Components/EliteComponents.h"
+#include "PopulationIndex.h"
 #include "VehicleTrainerContext.h"
 #include "VehicleTrainerConfig.h"
 #include "Components/SplineComponent.h"
+#include "SplineTrackIndex.h"
+#include "Components/SplineProjectionComponent.h"
+#include "VehicleShardSchedule.h"
+#include "Components/NNIOComponents.h"
 #include "GameFramework/Pawn.h"
 #include "DrawDebugHelpers.h"
 #include "VehicleLibrary.h"
@@ -32,29 +37,47 @@ void UVehicleResetFlagSystem::Update_Implementation(float DeltaTime)
 		return;
 	}
 
+	FSplineTrackIndex& Track = FSplineTrackIndex::Get(GetRegistry());
+	if (!Track.EnsureBuilt(Spline, TrainerContext->TrainerConfig->TrackSampleSpacing))
+	{
+		return;
+	}
+
 	float MaxDistThreshold = TrainerContext->TrainerConfig->MaxSplineDistanceThreshold;
 	float MinAverageVelocity = TrainerContext->TrainerConfig->MinAverageVelocity;
 	float MinAgeForReset = TrainerContext->TrainerConfig->MinAgeForReset;
 	float NoProgressTimeout = TrainerContext->TrainerConfig->NoProgressTimeout;
 	float CurrentTime = TrainerContext->GetWorld()->GetTimeSeconds();
 
-	auto View = GetView<FVehicleComponent, FTrainingDataComponent>();
+	// Vehicles already flagged wait for the GA step (or for reactive replacement) and are not checked again
+	auto View = GetRegistry().view<FVehicleComponent, FTrainingDataComponent>(entt::exclude<FResetGenomeComponent>);
 	entt::registry& Registry = GetRegistry();
+	const bool bGAChannel = ShardChannel == EVehicleShardChannel::GA;
+	FSplineProjectionComponent ProjectionScratch;
 
-	// Gather elite SourceIds to check if a car is an elite
-	TSet<int64> EliteSourceIds;
-	auto EliteView = Registry.view<FEliteTagComponent, FUniqueSolutionComponent>();
-	for (auto EliteEntity : EliteView)
+	// Elite SourceIds are only needed for debug drawing; gather them from the population index
+	// (a handful of elites per population) instead of scanning the registry every tick.
+	EliteSourceIds.Reset();
+	if (TrainerContext->TrainerConfig->bDebugInfo)
 	{
-		EliteSourceIds.Add(EliteView.get<FUniqueSolutionComponent>(EliteEntity).SourceId);
+		const FPopulationIndex& Index = FPopulationIndex::Get(Registry);
+		for (int32 Pop = 0; Pop < Index.NumPopulations(); ++Pop)
+		{
+			for (const entt::entity EliteEntity : Index.GetElites(Pop))
+			{
+				if (const FUniqueSolutionComponent* Unique = Registry.try_get<FUniqueSolutionComponent>(EliteEntity))
+				{
+					EliteSourceIds.Add(Unique->SourceId);
+				}
+			}
+		}
 	}
 
 	for (auto Entity : View)
 	{
-		// Skip if already flagged for reset
-		if (Registry.all_of<FResetGenomeComponent>(Entity))
+		// Vehicles outside the chain's active shard are checked when their shard runs
+		if (bGAChannel ? Registry.all_of<FGASkipEvaluationTag>(Entity) : Registry.all_of<FNNSkipEvaluationTag>(Entity))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Skipping entity %d because it is already flagged for reset"), Entity);
 			continue;
 		}
 
@@ -66,23 +89,23 @@ void UVehicleResetFlagSystem::Update_Implementation(float DeltaTime)
 			continue;
 		}
 
-		FVector PawnLocation = VehicleComp.VehiclePawn->GetActorLocation();
+		const FSplineProjectionComponent& Projection = UVehicleLibrary::GetFrameProjection(Registry, Entity, Track, VehicleComp.VehiclePawn, ProjectionScratch);
+		const FVector PawnLocation = Projection.VehicleLocation;
 
-		auto DrawDeadDebug = [&]()
+		// The reset flag is deferred to the command buffer, so the reason is passed in directly
+		auto FlagForReset = [&](const FName& Reason)
 		{
+			CommandBuffer.Emplace<FResetGenomeComponent>(Entity, FResetGenomeComponent{ Reason });
+
 			if (TrainerContext->TrainerConfig->bDebugInfo)
 			{
 				FColor Color = FColor::White;
 				float Duration = 3.0f;
-				if (Registry.all_of<FResetGenomeComponent>(Entity))
-				{
-					FName Reason = Registry.get<FResetGenomeComponent>(Entity).ReasonForReset;
-					if (Reason == UVehicleLibrary::ReasonTooFarFromSpline) Color = FColor::Red;
-					else if (Reason == UVehicleLibrary::ReasonTooSlow) Color = FColor::Blue;
-					else if (Reason == UVehicleLibrary::ReasonNoProgress) Color = FColor::Yellow;
-					else if (Reason == UVehicleLibrary::ReasonIncorrectProgress) Color = FColor::White; // Use white for incorrect progress
-					else if (Reason == UVehicleLibrary::ReasonBackwardStart) Color = FColor::Orange; // Backward start reset
-				}
+				if (Reason == UVehicleLibrary::ReasonTooFarFromSpline) Color = FColor::Red;
+				else if (Reason == UVehicleLibrary::ReasonTooSlow) Color = FColor::Blue;
+				else if (Reason == UVehicleLibrary::ReasonNoProgress) Color = FColor::Yellow;
+				else if (Reason == UVehicleLibrary::ReasonIncorrectProgress) Color = FColor::White; // Use white for incorrect progress
+				else if (Reason == UVehicleLibrary::ReasonBackwardStart) Color = FColor::Orange; // Backward start reset
 
 				DrawDebugPoint(GetContext()->GetWorld(), PawnLocation, 20.0f, Color, false, Duration, 0);
 
@@ -98,13 +121,11 @@ void UVehicleResetFlagSystem::Update_Implementation(float DeltaTime)
 		};
 
 		// 1. Check distance from spline
-		FVector ClosestPoint = Spline->FindLocationClosestToWorldLocation(PawnLocation, ESplineCoordinateSpace::World);
-		float DistanceFromSpline = FVector::Dist(PawnLocation, ClosestPoint);
+		float DistanceFromSpline = Projection.DistanceToSpline;
 
 		if (DistanceFromSpline > MaxDistThreshold)
 		{
-			Registry.emplace<FResetGenomeComponent>(Entity, FResetGenomeComponent{ UVehicleLibrary::ReasonTooFarFromSpline });
-			DrawDeadDebug();
+			FlagForReset(UVehicleLibrary::ReasonTooFarFromSpline);
 			continue;
 		}
 
@@ -115,8 +136,7 @@ void UVehicleResetFlagSystem::Update_Implementation(float DeltaTime)
 			float AverageVelocity = TrainingData.DistanceTraveled / Age;
 			if (AverageVelocity < MinAverageVelocity)
 			{
-				Registry.emplace<FResetGenomeComponent>(Entity, FResetGenomeComponent{ UVehicleLibrary::ReasonTooSlow });
-				DrawDeadDebug();
+				FlagForReset(UVehicleLibrary::ReasonTooSlow);
 				continue;
 			}
 		}
@@ -124,8 +144,10 @@ void UVehicleResetFlagSystem::Update_Implementation(float DeltaTime)
 		// 3. Check for progress timeout
 		if (TrainingData.TimeSinceLastProgress > NoProgressTimeout)
 		{
-			Registry.emplace<FResetGenomeComponent>(Entity, FResetGenomeComponent{ UVehicleLibrary::ReasonNoProgress });
-			DrawDeadDebug();
+			FlagForReset(UVehicleLibrary::ReasonNoProgress);
 		}
 	}
+
+	// Apply all reset flags in one sorted batch
+	CommandBuffer.Playback(Registry);
 }
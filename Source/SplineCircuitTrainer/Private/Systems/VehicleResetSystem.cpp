@@ -4,12 +4,22 @@
 #include "VehicleComponent.h"
 #include "Components/TrainingDataComponent.h"
 #include "Components/GenomeComponents.h"
+#include "GAStepGate.h"
+#include "Lineage/SolutionIdAllocator.h"
 #include "VehicleTrainerContext.h"
 #include "VehicleTrainerConfig.h"
-#include "Components/SplineComponent.h"
 #include "VehicleLibrary.h"
+#include "VehicleSpawnPoint.h"
 #include "Components/NetworkComponent.h"
+#include "Components/NNIOComponents.h"
+#include "Components/VehicleDecisionComponent.h"
+#include "Components/SplineProjectionComponent.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "Physics/PhysicsInterfaceCore.h"
+#include "Engine/World.h"
 
 UVehicleResetSystem::UVehicleResetSystem()
 {
@@ -24,79 +34,184 @@ UVehicleResetSystem::UVehicleResetSystem()
 
 void UVehicleResetSystem::Update_Implementation(float DeltaTime)
 {
-	AVehicleTrainerContext* TrainerContext = GetTypedContext<AVehicleTrainerContext>();
-	if (!TrainerContext || !TrainerContext->TrainerConfig)
+	// Vehicles flagged between steps are reset once the step has bred them
+	if (!FGAStepGate::IsPopulationStep(GetRegistry()))
 	{
 		return;
 	}
 
-	USplineComponent* Spline = TrainerContext->GetCircuitSpline();
-	if (!Spline)
+	ResetEntities.Reset();
+	auto View = GetView<FVehicleComponent, FResetGenomeComponent, FTrainingDataComponent, FUniqueSolutionComponent>();
+	for (auto Entity : View)
+	{
+		ResetEntities.Add(Entity);
+	}
+	ResetVehicles(ResetEntities);
+}
+
+void UVehicleResetSystem::ResetVehicles(TConstArrayView<entt::entity> Entities)
+{
+	if (Entities.Num() == 0)
 	{
 		return;
 	}
 
-	auto View = GetView<FVehicleComponent, FResetGenomeComponent, FTrainingDataComponent, FUniqueSolutionComponent>();
+	AVehicleTrainerContext* TrainerContext = GetTypedContext<AVehicleTrainerContext>();
+	if (!TrainerContext || !TrainerContext->TrainerConfig)
+	{
+		return;
+	}
 
 	const UVehicleTrainerConfig* Config = TrainerContext->TrainerConfig;
-	TArray<FNeuralNetworkLayerDescriptor> LayerDescriptors = Config->GetNNLayerDescriptors();
+	entt::registry& Registry = GetRegistry();
+	FVehicleSpawnPoint& SpawnPoint = FVehicleSpawnPoint::Get(Registry);
+	if (!SpawnPoint.EnsureBuilt(TrainerContext->GetCircuitSpline(), Config->SpawnParametricDistance, Config->SpawnVerticalOffset))
+	{
+		return;
+	}
 
-	for (auto Entity : View)
+	const float Now = GetContext()->GetWorld()->GetTimeSeconds();
+	int32 NumRerandomized = 0;
+	ResetPawns.Reset();
+
+	for (const entt::entity Entity : Entities)
 	{
-		const FVehicleComponent& VehicleComp = View.get<FVehicleComponent>(Entity);
-		FResetGenomeComponent& ResetComp = View.get<FResetGenomeComponent>(Entity);
-		FTrainingDataComponent& TrainingData = View.get<FTrainingDataComponent>(Entity);
-		FUniqueSolutionComponent& UniqueComp = View.get<FUniqueSolutionComponent>(Entity);
+		if (!Registry.all_of<FVehicleComponent, FResetGenomeComponent, FTrainingDataComponent, FUniqueSolutionComponent>(Entity))
+		{
+			continue;
+		}
+
+		const FVehicleComponent& VehicleComp = Registry.get<FVehicleComponent>(Entity);
+		const FResetGenomeComponent& ResetComp = Registry.get<FResetGenomeComponent>(Entity);
+		FTrainingDataComponent& TrainingData = Registry.get<FTrainingDataComponent>(Entity);
+		FUniqueSolutionComponent& UniqueComp = Registry.get<FUniqueSolutionComponent>(Entity);
+
+		if (!VehicleComp.VehiclePawn)
+		{
+			continue;
+		}
+
+		// Moved back to the start together with the other resets below
+		ResetPawns.Add(VehicleComp.VehiclePawn);
+
+		// Reset training data
+		SpawnPoint.InitTrainingData(TrainingData, Now);
+
+		// Also reset segment pass count array (InitTrainingData doesn't touch this)
+		TrainingData.SegmentPassCount.Init(0, TrainingData.SegmentPassCount.Num());
 
-		if (VehicleComp.VehiclePawn)
+		// Reset fitness score
+		if (Registry.all_of<FFitnessComponent>(Entity))
 		{
-			FVector ResetLocation;
-			FRotator ResetRotation;
-			
-			UVehicleLibrary::GetVehicleSpawnTransform(Spline, TrainerContext->TrainerConfig->SpawnParametricDistance, TrainerContext->TrainerConfig->SpawnVerticalOffset, ResetLocation, ResetRotation);
-			UVehicleLibrary::ResetPawnPhysicalState(VehicleComp.VehiclePawn, ResetLocation, ResetRotation);
-			
-			// Reset training data
-			UVehicleLibrary::SetTrainingData(TrainingData, Spline, ResetLocation, GetContext()->GetWorld()->GetTimeSeconds());
-
-			// Also reset segment pass count array (SetTrainingData doesn't touch this)
-			TrainingData.SegmentPassCount.Init(0, TrainingData.SegmentPassCount.Num());
-
-			// Reset fitness score
-			if (FFitnessComponent* FitComp = GetRegistry().try_get<FFitnessComponent>(Entity))
+			Registry.patch<FFitnessComponent>(Entity, [](FFitnessComponent& FitComp)
 			{
-				for (float& F : FitComp->Fitness)
+				for (float& F : FitComp.Fitness)
 				{
 					F = 0.0f;
 				}
-			}
+			});
+		}
 
-			// If this is a backward-start reset, completely re-randomize the NN weights
-			// so the next evaluation starts with a fresh genome instead of a proven-bad one
-			if (ResetComp.ReasonForReset == UVehicleLibrary::ReasonBackwardStart)
+		// If this is a backward-start reset, completely re-randomize the NN weights
+		// so the next evaluation starts with a fresh genome instead of a proven-bad one
+		if (ResetComp.ReasonForReset == UVehicleLibrary::ReasonBackwardStart)
+		{
+			if (FNeuralNetworkFloat* NetComp = Registry.try_get<FNeuralNetworkFloat>(Entity))
 			{
-				if (FNeuralNetworkFloat* NetComp = GetRegistry().try_get<FNeuralNetworkFloat>(Entity))
+				const int32 RandomSeed = FMath::RandRange(1, 2147483647);
+				if (NetComp->Network.GetDataView().Num() > 0)
+				{
+					// Same layout: new weights in the existing buffer, so the genome view stays valid
+					NetComp->Network.InitializeWeights(RandomSeed);
+				}
+				else
 				{
-					const int32 RandomSeed = FMath::RandRange(1, 2147483647);
-					NetComp->Initialize(LayerDescriptors, RandomSeed);
+					NetComp->Initialize(Config->GetNNLayerDescriptors(), RandomSeed);
 
 					// Update the genome view to point to the reinitialized network data
-					if (FGenomeFloatViewComponent* GenomeView = GetRegistry().try_get<FGenomeFloatViewComponent>(Entity))
+					if (FGenomeFloatViewComponent* GenomeView = Registry.try_get<FGenomeFloatViewComponent>(Entity))
 					{
 						GenomeView->Values = NetComp->Network.GetDataView();
 					}
-
-					UE_LOG(LogTemp, Log, TEXT("[VehicleResetSystem] Backward-start detected: re-randomized NN weights for entity %d"), static_cast<int32>(Entity));
 				}
+				++NumRerandomized;
 			}
+		}
+
+		// Assign a new unique ID so that any elite entity still referencing the old ID
+		// via SourceId will no longer match this entity. This prevents elites from being
+		// updated with fitness data from a completely new "life" of the pooled vehicle.
+		UniqueComp.Id = FSolutionIdAllocator::Get(Registry).Allocate();
+
+		// Remove eligibility tag
+		Registry.remove<FEligibleForBreedingTagComponent>(Entity);
 
-			// Assign a new unique ID so that any elite entity still referencing the old ID
-			// via SourceId will no longer match this entity. This prevents elites from being
-			// updated with fitness data from a completely new "life" of the pooled vehicle.
-			UniqueComp.Id = FUniqueSolutionComponent::GenerateNewId();
+		// Held outputs belong to the previous life: decide on the next network firing
+		Registry.remove<FVehicleDecisionComponent, FNNHoldOutputTag>(Entity);
 
-			// Remove eligibility tag
-			GetRegistry().remove<FEligibleForBreedingTagComponent>(Entity);
+		// The cached projection is from before the teleport; the next one warm-starts from the spawn distance
+		if (FSplineProjectionComponent* Projection = Registry.try_get<FSplineProjectionComponent>(Entity))
+		{
+			Projection->bValid = false;
 		}
 	}
+
+	TeleportToSpawn(SpawnPoint.Location, SpawnPoint.Rotation);
+
+	if (NumRerandomized > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[VehicleResetSystem] Backward-start detected: re-randomized NN weights for %d vehicles"), NumRerandomized);
+	}
+}
+
+void UVehicleResetSystem::TeleportToSpawn(const FVector& Location, const FRotator& Rotation)
+{
+	if (ResetPawns.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetContext()->GetWorld();
+	FPhysScene* PhysScene = World ? World->GetPhysicsScene() : nullptr;
+	ResetBodies.Reset();
+
+	for (APawn* Pawn : ResetPawns)
+	{
+		UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Pawn->GetRootComponent());
+		FBodyInstance* BodyInstance = Root ? Root->GetBodyInstance() : nullptr;
+		const USkeletalMeshComponent* SkeletalRoot = Cast<USkeletalMeshComponent>(Root);
+		const bool bSingleSimulatedBody = PhysScene && BodyInstance && BodyInstance->IsInstanceSimulatingPhysics()
+			&& BodyInstance->GetPhysicsActorHandle() && (!SkeletalRoot || SkeletalRoot->Bodies.Num() <= 1);
+		if (!bSingleSimulatedBody)
+		{
+			// Kinematic and movement-component pawns (and ragdolls) take the regular teleport
+			UVehicleLibrary::ResetPawnPhysicalState(Pawn, Location, Rotation);
+			continue;
+		}
+
+		// Move the components only; the body is teleported in the batch below
+		Root->SetWorldLocationAndRotationNoPhysics(Location, Rotation);
+		if (UPawnMovementComponent* Movement = Pawn->GetMovementComponent())
+		{
+			Movement->StopMovementImmediately();
+		}
+		ResetBodies.Add(BodyInstance->GetPhysicsActorHandle());
+	}
+
+	if (ResetBodies.Num() == 0)
+	{
+		return;
+	}
+
+	// One scene write lock for every teleport and velocity reset instead of a lock per setter and vehicle
+	const FTransform SpawnTransform(Rotation, Location);
+	FPhysicsCommand::ExecuteWrite(PhysScene, [this, &SpawnTransform]()
+	{
+		for (const FPhysicsActorHandle& Body : ResetBodies)
+		{
+			FPhysicsInterface::SetGlobalPose_AssumesLocked(Body, SpawnTransform);
+			FPhysicsInterface::SetLinearVelocity_AssumesLocked(Body, FVector::ZeroVector);
+			FPhysicsInterface::SetAngularVelocity_AssumesLocked(Body, FVector::ZeroVector);
+		}
+	});
 }
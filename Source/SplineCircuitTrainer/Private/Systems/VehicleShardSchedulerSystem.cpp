@@ -0,0 +1,122 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/VehicleShardSchedulerSystem.h"
+#include "VehicleComponent.h"
+#include "Components/NNIOComponents.h"
+#include "Components/GenomeComponents.h"
+#include "GAStepGate.h"
+
+namespace
+{
+	template <typename TSkipTag>
+	void TagInactiveShards(entt::registry& Registry, int32 NumShards, int32 ActiveShard, EVehicleShardPartition Partition)
+	{
+		if (NumShards <= 1)
+		{
+			Registry.clear<TSkipTag>();
+			return;
+		}
+
+		auto View = Registry.view<FVehicleComponent>();
+		for (const entt::entity Entity : View)
+		{
+			int32 Key = static_cast<int32>(entt::to_entity(Entity));
+			if (Partition == EVehicleShardPartition::Population)
+			{
+				if (const FFitnessComponent* Fitness = Registry.try_get<FFitnessComponent>(Entity))
+				{
+					Key = FMath::Max(Fitness->BuiltForFitnessIndex, 0);
+				}
+			}
+
+			const bool bSkip = (Key % NumShards) != ActiveShard;
+			if (bSkip != Registry.all_of<TSkipTag>(Entity))
+			{
+				if (bSkip)
+				{
+					Registry.emplace<TSkipTag>(Entity);
+				}
+				else
+				{
+					Registry.remove<TSkipTag>(Entity);
+				}
+			}
+		}
+	}
+}
+
+FVehicleShardSchedule& FVehicleShardSchedule::Get(entt::registry& Registry)
+{
+	if (FVehicleShardSchedule* Existing = Registry.ctx().find<FVehicleShardSchedule>())
+	{
+		return *Existing;
+	}
+	return Registry.ctx().emplace<FVehicleShardSchedule>();
+}
+
+float FVehicleShardSchedule::GetVehicleDeltaTime(entt::registry& Registry, EVehicleShardChannel Channel, float ChainDeltaTime)
+{
+	const FVehicleShardSchedule* Schedule = Registry.ctx().find<FVehicleShardSchedule>();
+	if (!Schedule)
+	{
+		return ChainDeltaTime;
+	}
+	const FChannel& State = Schedule->Channels[static_cast<int32>(Channel)];
+	return State.NumShards > 1 ? State.Elapsed[State.ActiveShard] : ChainDeltaTime;
+}
+
+bool FVehicleShardSchedule::IsRotationComplete(const entt::registry& Registry, EVehicleShardChannel Channel)
+{
+	const FVehicleShardSchedule* Schedule = Registry.ctx().find<FVehicleShardSchedule>();
+	if (!Schedule)
+	{
+		return true;
+	}
+	const FChannel& State = Schedule->Channels[static_cast<int32>(Channel)];
+	return State.NumShards <= 1 || State.ActiveShard == 0;
+}
+
+UVehicleShardSchedulerSystem::UVehicleShardSchedulerSystem()
+{
+	RegisterComponent<FVehicleComponent>();
+}
+
+void UVehicleShardSchedulerSystem::Update_Implementation(float DeltaTime)
+{
+	entt::registry& Registry = GetRegistry();
+	FVehicleShardSchedule::FChannel& State = FVehicleShardSchedule::Get(Registry).Channels[static_cast<int32>(Channel)];
+
+	const int32 Shards = FMath::Max(NumShards, 1);
+	if (State.NumShards != Shards || State.Elapsed.Num() != Shards)
+	{
+		State.NumShards = Shards;
+		State.ActiveShard = Shards - 1;
+		State.Elapsed.Init(0.0f, Shards);
+	}
+
+	// The shard leaving keeps counting from zero; the new one reports everything since it last ran
+	State.Elapsed[State.ActiveShard] = 0.0f;
+	for (float& Elapsed : State.Elapsed)
+	{
+		Elapsed += DeltaTime;
+	}
+	State.ActiveShard = (State.ActiveShard + 1) % Shards;
+
+	if (Channel == EVehicleShardChannel::GA)
+	{
+		TagInactiveShards<FGASkipEvaluationTag>(Registry, Shards, State.ActiveShard, Partition);
+
+		// Population-level GA systems run once per rotation and integrate the time since the previous one
+		FGAStepGate& Gate = FGAStepGate::Get(Registry);
+		if (Gate.bPopulationStep)
+		{
+			Gate.StepDeltaTime = 0.0f;
+		}
+		Gate.StepDeltaTime += DeltaTime;
+		Gate.bPopulationStep = FVehicleShardSchedule::IsRotationComplete(Registry, Channel);
+	}
+	else
+	{
+		TagInactiveShards<FNNSkipEvaluationTag>(Registry, Shards, State.ActiveShard, Partition);
+	}
+}
@@ -0,0 +1,55 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "Systems/VehicleSplineProjectionSystem.h"
+#include "VehicleComponent.h"
+#include "VehicleLibrary.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "SplineTrackIndex.h"
+#include "Components/SplineProjectionComponent.h"
+#include "Components/TrainingDataComponent.h"
+#include "Components/NNIOComponents.h"
+#include "GameFramework/Pawn.h"
+
+UVehicleSplineProjectionSystem::UVehicleSplineProjectionSystem()
+{
+	RegisterComponent<FVehicleComponent>();
+	RegisterComponent<FSplineProjectionComponent>();
+}
+
+void UVehicleSplineProjectionSystem::Update_Implementation(float DeltaTime)
+{
+	AVehicleTrainerContext* TrainerContext = GetTypedContext<AVehicleTrainerContext>();
+	if (!TrainerContext || !TrainerContext->TrainerConfig)
+	{
+		return;
+	}
+
+	entt::registry& Registry = GetRegistry();
+	FSplineTrackIndex& Track = FSplineTrackIndex::Get(Registry);
+	if (!Track.EnsureBuilt(TrainerContext->GetCircuitSpline(), TrainerContext->TrainerConfig->TrackSampleSpacing))
+	{
+		return;
+	}
+
+	// Vehicles outside this chain's active shard keep their previous projection; the network chain also skips
+	// vehicles whose inputs are computed on the physics thread (FNNExternalEvaluationTag)
+	const bool bGAChannel = ShardChannel == EVehicleShardChannel::GA;
+	auto IsOutsideActiveShard = [bGAChannel](const entt::registry& InRegistry, entt::entity Entity)
+	{
+		return bGAChannel ? InRegistry.all_of<FGASkipEvaluationTag>(Entity) : InRegistry.any_of<FNNSkipEvaluationTag, FNNExternalEvaluationTag>(Entity);
+	};
+
+	auto View = Registry.view<FVehicleComponent>();
+	for (const entt::entity Entity : View)
+	{
+		const APawn* Pawn = View.get<FVehicleComponent>(Entity).VehiclePawn;
+		if (!Pawn || IsOutsideActiveShard(Registry, Entity))
+		{
+			continue;
+		}
+
+		FSplineProjectionComponent& Projection = Registry.get_or_emplace<FSplineProjectionComponent>(Entity);
+		UVehicleLibrary::ProjectOnTrack(Track, Pawn->GetActorLocation(), Registry.try_get<FTrainingDataComponent>(Entity), Projection);
+	}
+}
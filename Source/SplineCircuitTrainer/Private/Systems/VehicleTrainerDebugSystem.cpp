@@ -3,6 +3,7 @@
 #include "Systems/VehicleTrainerDebugSystem.h"
 #include "Components/GenomeComponents.h"
 #include "Components/EliteComponents.h"
+#include "GAStepGate.h"
 #include "VehicleTrainerContext.h"
 #include "VehicleTrainerConfig.h"
 #include "SlateIM.h"
@@ -32,7 +33,7 @@ void UVehicleTrainerDebugSystem::Update_Implementation(float DeltaTime)
 	}
 
 	auto DebugView = GetView<FGeneticAlgorithmDebugComponent>();
-	if (DebugView.begin() == DebugView.end())
+	if (DebugView.begin() == DebugView.end() || !FGAStepGate::IsPopulationStep(GetRegistry()))
 	{
 		return;
 	}
@@ -50,14 +51,14 @@ void UVehicleTrainerDebugSystem::Update_Implementation(float DeltaTime)
 	CachedEliteCount = DebugComp.EliteCount;
 	CachedEliteFitness = DebugComp.EliteFitness;
 	CachedBreedingPairsFitness = DebugComp.BreedingPairsFitness;
-	CachedAllSolutionsFitness = DebugComp.AllSolutionsFitness;
+	CachedAllSolutionsStats = DebugComp.AllSolutionsStats;
 	CachedResetCount = DebugComp.ResetCount;
 
 	// Compute per-population elite fitness directly from elite entities
 	// (more reliable than relying on PopulationTotalEliteFitness map)
 	// Throttled to once per second to avoid log spam
 	{
-		EliteFitnessLogTimer += DeltaTime;
+		EliteFitnessLogTimer += FGAStepGate::GetStepDeltaTime(GetRegistry(), DeltaTime);
 		if (EliteFitnessLogTimer < EliteFitnessLogInterval)
 		{
 			// Still update cached data every tick, but skip logging
@@ -141,11 +142,7 @@ void UVehicleTrainerDebugSystem::Update_Implementation(float DeltaTime)
 
 				// Update historical data
 				FGeneticAlgorithmDebugComponent& MutableDebugComp = const_cast<FGeneticAlgorithmDebugComponent&>(DebugComp);
-				MutableDebugComp.HistoricalTotalEliteFitness.Add(OverallTotal);
-				if (MutableDebugComp.HistoricalTotalEliteFitness.Num() > MutableDebugComp.MaxHistoryLength)
-				{
-					MutableDebugComp.HistoricalTotalEliteFitness.RemoveAt(0);
-				}
+				MutableDebugComp.RecordEliteFitnessSample(OverallTotal);
 
 				// Also update the debug component's map so other consumers get the data
 				MutableDebugComp.PopulationTotalEliteFitness = PerPopEliteFitness;
@@ -0,0 +1,164 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "TrainerCheckpoint.h"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+#include "Lineage/SolutionIdAllocator.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 CheckpointMagic = 0x534D4C43; // 'SMLC'
+	constexpr uint32 CheckpointVersion = 1;
+}
+
+void FTrainerCheckpoint::Capture(entt::registry& Registry, double InSimTime)
+{
+	SimTime = InSimTime;
+	Elites.Reset();
+	auto EliteView = Registry.view<FEliteTagComponent, FFitnessComponent, FEliteOwnedFloatGenome>();
+	for (const entt::entity Entity : EliteView)
+	{
+		const FFitnessComponent& Fit = EliteView.get<FFitnessComponent>(Entity);
+		if (!Fit.Fitness.IsValidIndex(Fit.BuiltForFitnessIndex))
+		{
+			continue;
+		}
+		const FUniqueSolutionComponent* Unique = Registry.try_get<FUniqueSolutionComponent>(Entity);
+		FTrainerCheckpointElite& Elite = Elites.AddDefaulted_GetRef();
+		Elite.Population = Fit.BuiltForFitnessIndex;
+		Elite.Fitness = Fit.Fitness[Fit.BuiltForFitnessIndex];
+		Elite.SolutionId = Unique ? Unique->Id : 0;
+		Elite.Genome = EliteView.get<FEliteOwnedFloatGenome>(Entity).Values;
+	}
+}
+
+bool FTrainerCheckpoint::Save(const FString& Filename) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Ar(Bytes);
+	uint32 Magic = CheckpointMagic;
+	uint32 Version = CheckpointVersion;
+	double Time = SimTime;
+	int32 Num = Elites.Num();
+	Ar << Magic << Version << Time << Num;
+	for (const FTrainerCheckpointElite& Elite : Elites)
+	{
+		int32 Population = Elite.Population;
+		float Fitness = Elite.Fitness;
+		int64 Id = Elite.SolutionId;
+		Ar << Population << Fitness << Id;
+		const_cast<TArray<float>&>(Elite.Genome).BulkSerialize(Ar);
+	}
+
+	const FString TempFile = Filename + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempFile) || !IFileManager::Get().Move(*Filename, *TempFile, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TrainerCheckpoint: failed to write '%s'."), *Filename);
+		return false;
+	}
+	return true;
+}
+
+bool FTrainerCheckpoint::Load(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TrainerCheckpoint: cannot read '%s'."), *Filename);
+		return false;
+	}
+
+	FMemoryReader Ar(Bytes);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 Num = 0;
+	Ar << Magic << Version << SimTime << Num;
+	if (Magic != CheckpointMagic || Version != CheckpointVersion || Num < 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TrainerCheckpoint: '%s' is not a version %u checkpoint."), *Filename, CheckpointVersion);
+		return false;
+	}
+
+	Elites.SetNum(Num);
+	for (FTrainerCheckpointElite& Elite : Elites)
+	{
+		Ar << Elite.Population << Elite.Fitness << Elite.SolutionId;
+		Elite.Genome.BulkSerialize(Ar);
+	}
+	if (Ar.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TrainerCheckpoint: '%s' is truncated."), *Filename);
+		Elites.Reset();
+		return false;
+	}
+	return true;
+}
+
+int32 FTrainerCheckpoint::Restore(entt::registry& Registry, int32 NumPopulations, int32 EliteCount, bool bHigherIsBetter, int32 GenomeFloatCount) const
+{
+	TArray<const FTrainerCheckpointElite*> Sorted;
+	int32 Mismatched = 0;
+	int32 MismatchedLength = 0;
+	for (const FTrainerCheckpointElite& Elite : Elites)
+	{
+		if (Elite.Population < 0 || Elite.Population >= NumPopulations || Elite.Genome.Num() == 0)
+		{
+			continue;
+		}
+		// A genome of another length would be read past its end (or left partly unused) by the network
+		if (Elite.Genome.Num() != GenomeFloatCount)
+		{
+			++Mismatched;
+			MismatchedLength = Elite.Genome.Num();
+			continue;
+		}
+		Sorted.Add(&Elite);
+	}
+	if (Mismatched > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TrainerCheckpoint: skipped %d elites with %d genome floats; the current network needs %d."),
+			Mismatched, MismatchedLength, GenomeFloatCount);
+	}
+	Sorted.Sort([bHigherIsBetter](const FTrainerCheckpointElite& A, const FTrainerCheckpointElite& B)
+	{
+		return bHigherIsBetter ? A.Fitness > B.Fitness : A.Fitness < B.Fitness;
+	});
+
+	TArray<int32> PerPopulation;
+	PerPopulation.SetNumZeroed(NumPopulations);
+	int32 Created = 0;
+	for (const FTrainerCheckpointElite* Elite : Sorted)
+	{
+		if (PerPopulation[Elite->Population] >= EliteCount)
+		{
+			continue;
+		}
+		++PerPopulation[Elite->Population];
+
+		// Same layout the elite selection and staleness systems create
+		const entt::entity NewElite = Registry.create();
+		Registry.emplace<FEliteTagComponent>(NewElite);
+
+		FUniqueSolutionComponent& Unique = Registry.emplace<FUniqueSolutionComponent>(NewElite);
+		Unique.Id = FSolutionIdAllocator::Get(Registry).Allocate();
+		Unique.SourceId = Elite->SolutionId;
+
+		FFitnessComponent Fit{};
+		Fit.BuiltForFitnessIndex = Elite->Population;
+		Fit.Fitness.SetNumZeroed(NumPopulations);
+		Fit.Fitness[Elite->Population] = Elite->Fitness;
+		Registry.emplace<FFitnessComponent>(NewElite, MoveTemp(Fit));
+
+		FEliteOwnedFloatGenome& Owned = Registry.emplace<FEliteOwnedFloatGenome>(NewElite);
+		Owned.Values = Elite->Genome;
+
+		FGenomeFloatViewComponent& View = Registry.emplace<FGenomeFloatViewComponent>(NewElite);
+		View.Values = TArrayView<float>(Owned.Values.GetData(), Owned.Values.Num());
+		++Created;
+	}
+	return Created;
+}
@@ -0,0 +1,152 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "VehicleAsyncControl.h"
+#include "VehicleNNInterface.h"
+#include "VehicleTrainerConfig.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+
+uint32 FVehicleAsyncControlShared::HashConfig(const UVehicleTrainerConfig& Config)
+{
+	// The schema hash only covers the number of future distances; the input context reads their values
+	uint32 Hash = FVehicleInputSchema::HashConfig(Config);
+	for (const float Distance : Config.FutureDotProductDistances)
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(Distance));
+	}
+	Hash = HashCombineFast(Hash, GetTypeHash(Config.CurvatureLookaheadDistance));
+	Hash = HashCombineFast(Hash, GetTypeHash(Config.AsyncControlHz));
+	Hash = HashCombineFast(Hash, GetTypeHash(Config.RecurrentInputCount));
+	Hash = HashCombineFast(Hash, GetTypeHash(Config.GetTotalOutputCount()));
+	return HashCombineFast(Hash, GetTypeHash(Config.VehicleOutputCount));
+}
+
+void FVehicleAsyncControlShared::WriteAgentInputs(const FVehicleAsyncBodyState& Body, const FVehicleTelemetry& Telemetry, float& InOutDistance, bool& bInOutHasDistance, float* OutInputs) const
+{
+	FVehicleInputState State;
+	State.Location = Body.Location;
+	const FRotator Rotator = Body.Rotation.Rotator();
+	State.Forward = Body.Rotation.GetForwardVector();
+	State.Pitch = FMath::DegreesToRadians(Rotator.Pitch);
+	State.Roll = FMath::DegreesToRadians(Rotator.Roll);
+	State.Velocity = Body.Velocity;
+	State.AngularVelocity = FMath::RadiansToDegrees(Body.AngularVelocity);
+	State.Telemetry = Telemetry;
+
+	const FSplineTrackProjection Projection = bInOutHasDistance
+		? Track.ProjectNear(State.Location, InOutDistance)
+		: Track.Project(State.Location);
+	State.ClosestPoint = Projection.Location;
+	State.Tangent = Projection.Tangent;
+	State.Distance = Projection.Distance;
+	InOutDistance = Projection.Distance;
+	bInOutHasDistance = true;
+
+	Schema.WriteInputs(State, InputContext, OutInputs);
+}
+
+FName FVehicleAsyncControlCallback::GetFNameForStatId() const
+{
+	static const FName StatName(TEXT("FVehicleAsyncControlCallback"));
+	return StatName;
+}
+
+bool FVehicleAsyncControlCallback::IsAlive(const FVehicleAsyncAgentInput& Agent)
+{
+	return Agent.Alive && Agent.Alive->load(std::memory_order_acquire);
+}
+
+void FVehicleAsyncControlCallback::AdoptInput(const FVehicleAsyncControlInput& Input)
+{
+	if (Shared != Input.Shared)
+	{
+		Shared = Input.Shared;
+		InputScratch.Reset();
+	}
+
+	// Vehicle order is stable between inputs, so the previous entry at the same index is usually the same vehicle
+	Swap(PreviousAgents, Agents);
+	Agents.Reset();
+	for (int32 i = 0; i < Input.Agents.Num(); ++i)
+	{
+		if (!IsAlive(Input.Agents[i]))
+		{
+			continue;
+		}
+		FAgent& Agent = Agents.AddDefaulted_GetRef();
+		Agent.Input = Input.Agents[i];
+		if (PreviousAgents.IsValidIndex(i) && PreviousAgents[i].Input.Entity == Agent.Input.Entity && PreviousAgents[i].Input.Network == Agent.Input.Network)
+		{
+			Agent.Distance = PreviousAgents[i].Distance;
+			Agent.bHasDistance = PreviousAgents[i].bHasDistance;
+		}
+	}
+	PreviousAgents.Reset();
+}
+
+void FVehicleAsyncControlCallback::OnPreSimulate_Internal()
+{
+	if (const FVehicleAsyncControlInput* Input = GetConsumerInput_Internal())
+	{
+		AdoptInput(*Input);
+	}
+	if (!Shared || Agents.Num() == 0)
+	{
+		return;
+	}
+
+	// Fixed-rate control in simulated time; a long step does not queue up extra decisions
+	TimeToNextDecision -= GetDeltaTime_Internal();
+	if (TimeToNextDecision > 0.0f)
+	{
+		return;
+	}
+	TimeToNextDecision = FMath::Max(TimeToNextDecision + Shared->ControlPeriod, 0.0f);
+
+	const FVehicleAsyncControlShared& Data = *Shared;
+	const int32 InputCount = Data.Schema.Num() + Data.RecurrentInputCount;
+	if (InputScratch.Num() != InputCount)
+	{
+		// Recurrent inputs are never written and stay zero, as on the game-thread path
+		InputScratch.Init(0.0f, InputCount);
+	}
+
+	FVehicleAsyncControlOutput& Output = GetProducerOutputData_Internal();
+	Output.Reset();
+	Output.OutputStride = Data.NetworkOutputCount;
+
+	for (FAgent& Agent : Agents)
+	{
+		// The list is only replaced at the next network firing; a pawn destroyed since then must not be touched
+		if (!IsAlive(Agent.Input))
+		{
+			continue;
+		}
+
+		Chaos::FRigidBodyHandle_Internal* Body = Agent.Input.Proxy ? Agent.Input.Proxy->GetPhysicsThreadAPI() : nullptr;
+		FVehicleControlNetwork* Network = Agent.Input.Network.Get();
+		if (!Body || !Network || Network->GetInputSize() != InputCount)
+		{
+			continue;
+		}
+
+		// Rigid body state of this step
+		FVehicleAsyncBodyState BodyState;
+		BodyState.Location = Body->X();
+		BodyState.Rotation = Body->R();
+		BodyState.Velocity = Body->V();
+		BodyState.AngularVelocity = FVector(Body->W());
+		Data.WriteAgentInputs(BodyState, Agent.Input.Telemetry, Agent.Distance, Agent.bHasDistance, InputScratch.GetData());
+		if (!Network->FeedforwardArray(InputScratch, OutputScratch))
+		{
+			continue;
+		}
+		OutputScratch.SetNumZeroed(Data.NetworkOutputCount);
+
+		const TArrayView<const float> ControlOutputs(OutputScratch.GetData(), FMath::Min(Data.ControlOutputCount, OutputScratch.Num()));
+		const bool bApplied = Agent.Input.Control && Agent.Input.Control->ApplyNNOutputs_Internal(ControlOutputs);
+
+		Output.Entities.Add(Agent.Input.Entity);
+		Output.Outputs.Append(OutputScratch);
+		Output.AppliedInternal.Add(bApplied ? 1 : 0);
+	}
+}
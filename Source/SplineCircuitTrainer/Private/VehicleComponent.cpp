@@ -0,0 +1,20 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "VehicleComponent.h"
+#include "VehicleNNInterface.h"
+#include "GameFramework/Pawn.h"
+
+FVehicleComponent::FVehicleComponent(APawn* InPawn)
+	: VehiclePawn(InPawn)
+{
+}
+
+IVehicleNNInterface* FVehicleComponent::GetNNInterface()
+{
+	if (NNInterfacePawn != VehiclePawn)
+	{
+		NNInterfacePawn = VehiclePawn;
+		NNInterface = Cast<IVehicleNNInterface>(VehiclePawn);
+	}
+	return NNInterface;
+}
@@ -0,0 +1,341 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "VehicleInputSchema.h"
+#include "VehicleTrainerConfig.h"
+#include "SplineTrackIndex.h"
+#include "Components/SplineComponent.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	/** Default normalization of a source: raw value scale and clamp range */
+	void GetDefaultNormalization(EVehicleInputSource Source, const UVehicleTrainerConfig& Config, float& OutScale, float& OutMin, float& OutMax)
+	{
+		OutScale = 1.0f;
+		OutMin = -1.0f;
+		OutMax = 1.0f;
+		switch (Source)
+		{
+		case EVehicleInputSource::SignedDistance:		OutScale = 1.0f / Config.MaxDistanceNormalization; break;
+		case EVehicleInputSource::HeightAboveSpline:	OutScale = 1.0f / Config.MaxHeightDifferenceCM; break;
+		case EVehicleInputSource::ForwardVelocity:		OutScale = 1.0f / Config.MaxForwardVelocity; break;
+		case EVehicleInputSource::LateralVelocity:		OutScale = 1.0f / Config.MaxVelocityNormalization; break;
+		case EVehicleInputSource::VerticalVelocity:		OutScale = 1.0f / Config.MaxVerticalVelocity; break;
+		case EVehicleInputSource::AngularVelocity:		OutScale = 1.0f / Config.MaxAngularVelocityDegPerSec; break;
+		case EVehicleInputSource::Pitch:
+		case EVehicleInputSource::Roll:					OutScale = 1.0f / Config.MaxPitchRollRadians; break;
+		case EVehicleInputSource::VelocityMagnitude:	OutScale = 1.0f / Config.MaxVelocityNormalization; OutMin = 0.0f; break;
+		case EVehicleInputSource::CurvatureAhead:
+		case EVehicleInputSource::SplineProgress:
+		case EVehicleInputSource::WheelsOnGround:
+		case EVehicleInputSource::WheelContacts:
+		case EVehicleInputSource::WheelCompressions:
+		case EVehicleInputSource::EngineRPM:
+		case EVehicleInputSource::Gear:					OutMin = 0.0f; break;
+		default: break;
+		}
+	}
+}
+
+TArray<FVehicleInputFeature> FVehicleInputSchema::MakeDefaultFeatures()
+{
+	TArray<FVehicleInputFeature> Features;
+	for (int32 Source = 0; Source < static_cast<int32>(EVehicleInputSource::Count); ++Source)
+	{
+		Features.Add(FVehicleInputFeature(static_cast<EVehicleInputSource>(Source)));
+	}
+	return Features;
+}
+
+int32 FVehicleInputSchema::GetSourceWidth(EVehicleInputSource Source, const UVehicleTrainerConfig& Config)
+{
+	switch (Source)
+	{
+	case EVehicleInputSource::FutureOrientations:	return Config.FutureDotProductDistances.Num();
+	case EVehicleInputSource::AngularVelocity:		return 3;
+	case EVehicleInputSource::WheelContacts:
+	case EVehicleInputSource::WheelCompressions:	return FVehicleTelemetry::MaxWheels;
+	case EVehicleInputSource::Count:				return 0;
+	default:										return 1;
+	}
+}
+
+uint32 FVehicleInputSchema::HashConfig(const UVehicleTrainerConfig& Config)
+{
+	uint32 Hash = GetTypeHash(Config.InputFeatures.Num());
+	for (const FVehicleInputFeature& Feature : Config.InputFeatures)
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(static_cast<uint8>(Feature.Source)));
+		Hash = HashCombineFast(Hash, GetTypeHash(Feature.bEnabled));
+		Hash = HashCombineFast(Hash, GetTypeHash(Feature.bOverrideNormalization));
+		Hash = HashCombineFast(Hash, GetTypeHash(Feature.Scale));
+		Hash = HashCombineFast(Hash, GetTypeHash(Feature.ClampMin));
+		Hash = HashCombineFast(Hash, GetTypeHash(Feature.ClampMax));
+	}
+	// Default normalizations and source widths
+	for (const float Value : { Config.MaxDistanceNormalization, Config.MaxHeightDifferenceCM, Config.MaxForwardVelocity,
+		Config.MaxVelocityNormalization, Config.MaxVerticalVelocity, Config.MaxAngularVelocityDegPerSec, Config.MaxPitchRollRadians })
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(Value));
+	}
+	return HashCombineFast(Hash, GetTypeHash(Config.FutureDotProductDistances.Num()));
+}
+
+int32 FVehicleInputSchema::CountInputs(const UVehicleTrainerConfig& Config)
+{
+	bool bSeen[static_cast<int32>(EVehicleInputSource::Count)] = {};
+	int32 Count = 0;
+	for (const FVehicleInputFeature& Feature : Config.InputFeatures)
+	{
+		const int32 SourceIdx = static_cast<int32>(Feature.Source);
+		if (!Feature.bEnabled || SourceIdx < 0 || SourceIdx >= static_cast<int32>(EVehicleInputSource::Count) || bSeen[SourceIdx])
+		{
+			continue;
+		}
+		bSeen[SourceIdx] = true;
+		Count += GetSourceWidth(Feature.Source, Config);
+	}
+	return Count;
+}
+
+bool FVehicleInputSchema::ValidateFeatures(const UVehicleTrainerConfig& Config)
+{
+	bool bSeen[static_cast<int32>(EVehicleInputSource::Count)] = {};
+	bool bValid = true;
+	for (const FVehicleInputFeature& Feature : Config.InputFeatures)
+	{
+		const int32 SourceIdx = static_cast<int32>(Feature.Source);
+		if (!Feature.bEnabled || SourceIdx < 0 || SourceIdx >= static_cast<int32>(EVehicleInputSource::Count))
+		{
+			continue;
+		}
+		if (bSeen[SourceIdx])
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FVehicleInputSchema: input source %d is listed more than once; keeping the first entry"), SourceIdx);
+			bValid = false;
+		}
+		bSeen[SourceIdx] = true;
+	}
+	return bValid;
+}
+
+void FVehicleInputSchema::Compile(const UVehicleTrainerConfig& Config)
+{
+	CompiledHash = HashConfig(Config);
+	for (int32& Offset : Offsets)
+	{
+		Offset = INDEX_NONE;
+	}
+	Scales.Reset();
+	ClampMins.Reset();
+	ClampMaxs.Reset();
+
+	for (const FVehicleInputFeature& Feature : Config.InputFeatures)
+	{
+		const int32 SourceIdx = static_cast<int32>(Feature.Source);
+		if (!Feature.bEnabled || SourceIdx < 0 || SourceIdx >= static_cast<int32>(EVehicleInputSource::Count))
+		{
+			continue;
+		}
+		if (Offsets[SourceIdx] != INDEX_NONE)
+		{
+			continue; // duplicate; reported by ValidateFeatures when the list is edited
+		}
+
+		float Scale, Min, Max;
+		GetDefaultNormalization(Feature.Source, Config, Scale, Min, Max);
+		if (Feature.bOverrideNormalization)
+		{
+			Scale = Feature.Scale;
+			Min = Feature.ClampMin;
+			Max = Feature.ClampMax;
+		}
+
+		Offsets[SourceIdx] = Scales.Num();
+		const int32 Width = GetSourceWidth(Feature.Source, Config);
+		for (int32 i = 0; i < Width; ++i)
+		{
+			Scales.Add(Scale);
+			ClampMins.Add(Min);
+			ClampMaxs.Add(Max);
+		}
+	}
+}
+
+void FVehicleInputSchema::Normalize(float* Values) const
+{
+	const int32 Count = Scales.Num();
+	const float* RESTRICT Scale = Scales.GetData();
+	const float* RESTRICT Min = ClampMins.GetData();
+	const float* RESTRICT Max = ClampMaxs.GetData();
+
+	int32 i = 0;
+	for (; i + 4 <= Count; i += 4)
+	{
+		const VectorRegister4Float Scaled = VectorMultiply(VectorLoad(Values + i), VectorLoad(Scale + i));
+		VectorStore(VectorMin(VectorMax(Scaled, VectorLoad(Min + i)), VectorLoad(Max + i)), Values + i);
+	}
+	for (; i < Count; ++i)
+	{
+		Values[i] = FMath::Clamp(Values[i] * Scale[i], Min[i], Max[i]);
+	}
+}
+
+void FVehicleInputContext::Init(const UVehicleTrainerConfig& Config, const FSplineTrackIndex& InTrack, const USplineComponent& Spline)
+{
+	Track = &InTrack;
+	FutureDistances = &Config.FutureDotProductDistances;
+	SplineLength = InTrack.GetLength();
+	InvSplineLength = SplineLength > 0.0f ? 1.0f / SplineLength : 0.0f;
+	LookaheadDistance = Config.CurvatureLookaheadDistance;
+
+	// Spline up vector (default up vector from spline component)
+	const FVector DefaultUp = Spline.GetDefaultUpVector(ESplineCoordinateSpace::World);
+	SplineUpVector = DefaultUp != FVector::ZeroVector ? DefaultUp : FVector::UpVector;
+}
+
+void FVehicleInputSchema::WriteInputs(const FVehicleInputState& State, const FVehicleInputContext& Context, float* Values) const
+{
+	const FSplineTrackIndex& Track = *Context.Track;
+	const FVector& SplineUpVector = Context.SplineUpVector;
+
+	const FVector& ActorForward = State.Forward;
+	const FVector& ActorVelocity = State.Velocity;
+	const FVector& SplineTangent = State.Tangent;
+	const float CurrentSplineDistance = State.Distance;
+	const FVehicleTelemetry& VehicleTelemetry = State.Telemetry;
+
+	// Vector from spline to actor
+	const FVector ToActorVector = State.Location - State.ClosestPoint;
+
+	// Spline right vector (perpendicular to tangent in horizontal plane)
+	const FVector SplineRightVector = FVector::CrossProduct(SplineTangent, SplineUpVector).GetSafeNormal();
+
+	// --- Raw features at their schema offsets; Normalize() scales and clamps them below ---
+	int32 Offset;
+
+	// Signed distance to spline
+	if ((Offset = GetOffset(EVehicleInputSource::SignedDistance)) != INDEX_NONE)
+	{
+		Values[Offset] = FVector::DotProduct(ToActorVector, SplineRightVector);
+	}
+
+	// Current orientation - Z cross product
+	if ((Offset = GetOffset(EVehicleInputSource::CurrentOrientation)) != INDEX_NONE)
+	{
+		Values[Offset] = FVector::DotProduct(FVector::CrossProduct(SplineTangent, ActorForward), SplineUpVector);
+	}
+
+	// Future orientations (distance-based lookahead in the baked feature table)
+	if ((Offset = GetOffset(EVehicleInputSource::FutureOrientations)) != INDEX_NONE)
+	{
+		for (const float FutureDistance : *Context.FutureDistances)
+		{
+			const FVector FutureTangent = FVector(Track.SampleFeatures(CurrentSplineDistance + FutureDistance).Tangent);
+			Values[Offset++] = FVector::DotProduct(FVector::CrossProduct(FutureTangent, ActorForward), SplineUpVector);
+		}
+	}
+
+	// Height above/below spline
+	if ((Offset = GetOffset(EVehicleInputSource::HeightAboveSpline)) != INDEX_NONE)
+	{
+		Values[Offset] = FVector::DotProduct(ToActorVector, SplineUpVector);
+	}
+
+	// Spline curvature ahead and its direction (use distance-based lookahead, not input key + distance)
+	const int32 CurvatureOffset = GetOffset(EVehicleInputSource::CurvatureAhead);
+	const int32 CurvatureDirectionOffset = GetOffset(EVehicleInputSource::CurvatureDirection);
+	if (CurvatureOffset != INDEX_NONE || CurvatureDirectionOffset != INDEX_NONE)
+	{
+		const float CurvatureLookaheadDistance = FMath::Clamp(CurrentSplineDistance + Context.LookaheadDistance, 0.0f, Context.SplineLength);
+		const FVector CurvatureTangent = FVector(Track.SampleFeatures(CurvatureLookaheadDistance).Tangent);
+		if (CurvatureOffset != INDEX_NONE)
+		{
+			Values[CurvatureOffset] = 1.0f - FMath::Clamp(FVector::DotProduct(SplineTangent, CurvatureTangent), 0.0f, 1.0f);
+		}
+		if (CurvatureDirectionOffset != INDEX_NONE)
+		{
+			Values[CurvatureDirectionOffset] = FVector::DotProduct(FVector::CrossProduct(SplineTangent, CurvatureTangent), SplineUpVector);
+		}
+	}
+
+	// Spline progress (normalized 0-1 along circuit)
+	if ((Offset = GetOffset(EVehicleInputSource::SplineProgress)) != INDEX_NONE)
+	{
+		Values[Offset] = CurrentSplineDistance * Context.InvSplineLength;
+	}
+
+	// Forward velocity along spline tangent
+	if ((Offset = GetOffset(EVehicleInputSource::ForwardVelocity)) != INDEX_NONE)
+	{
+		Values[Offset] = FVector::DotProduct(ActorVelocity, SplineTangent);
+	}
+
+	// Velocity magnitude
+	if ((Offset = GetOffset(EVehicleInputSource::VelocityMagnitude)) != INDEX_NONE)
+	{
+		Values[Offset] = ActorVelocity.Size();
+	}
+
+	// Pitch and roll angles (radians)
+	if ((Offset = GetOffset(EVehicleInputSource::Pitch)) != INDEX_NONE)
+	{
+		Values[Offset] = State.Pitch;
+	}
+	if ((Offset = GetOffset(EVehicleInputSource::Roll)) != INDEX_NONE)
+	{
+		Values[Offset] = State.Roll;
+	}
+
+	// Lateral velocity (perpendicular to spline)
+	if ((Offset = GetOffset(EVehicleInputSource::LateralVelocity)) != INDEX_NONE)
+	{
+		Values[Offset] = FVector::DotProduct(ActorVelocity, SplineRightVector);
+	}
+
+	// Vertical velocity
+	if ((Offset = GetOffset(EVehicleInputSource::VerticalVelocity)) != INDEX_NONE)
+	{
+		Values[Offset] = FVector::DotProduct(ActorVelocity, SplineUpVector);
+	}
+
+	// Angular velocity (pitch/yaw/roll rates, deg/s)
+	if ((Offset = GetOffset(EVehicleInputSource::AngularVelocity)) != INDEX_NONE)
+	{
+		const FVector& AngularVelocity = State.AngularVelocity;
+		Values[Offset] = AngularVelocity.X;
+		Values[Offset + 1] = AngularVelocity.Y;
+		Values[Offset + 2] = AngularVelocity.Z;
+	}
+
+	// Wheels on ground ratio
+	if ((Offset = GetOffset(EVehicleInputSource::WheelsOnGround)) != INDEX_NONE)
+	{
+		Values[Offset] = VehicleTelemetry.WheelsOnGroundRatio;
+	}
+
+	// Per-wheel contact states
+	if ((Offset = GetOffset(EVehicleInputSource::WheelContacts)) != INDEX_NONE)
+	{
+		FMemory::Memcpy(Values + Offset, VehicleTelemetry.WheelContact, sizeof(VehicleTelemetry.WheelContact));
+	}
+
+	// Per-wheel suspension compression
+	if ((Offset = GetOffset(EVehicleInputSource::WheelCompressions)) != INDEX_NONE)
+	{
+		FMemory::Memcpy(Values + Offset, VehicleTelemetry.WheelCompression, sizeof(VehicleTelemetry.WheelCompression));
+	}
+
+	// Normalized engine RPM and current gear
+	if ((Offset = GetOffset(EVehicleInputSource::EngineRPM)) != INDEX_NONE)
+	{
+		Values[Offset] = VehicleTelemetry.NormalizedRPM;
+	}
+	if ((Offset = GetOffset(EVehicleInputSource::Gear)) != INDEX_NONE)
+	{
+		Values[Offset] = VehicleTelemetry.NormalizedGear;
+	}
+
+	// Scale and clamp every schema input in one SIMD pass (recurrent inputs after them are untouched)
+	Normalize(Values);
+}
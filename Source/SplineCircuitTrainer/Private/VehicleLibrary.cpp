@@ -3,6 +3,8 @@
 #include "VehicleLibrary.h"
 #include "Components/SplineComponent.h"
 #include "Components/TrainingDataComponent.h"
+#include "Components/SplineProjectionComponent.h"
+#include "SplineTrackIndex.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PawnMovementComponent.h"
 
@@ -66,3 +68,43 @@ void UVehicleLibrary::SetTrainingData(FTrainingDataComponent& OutTrainingData, c
 		OutTrainingData.LastSplineSegment = 0;
 	}
 }
+
+void UVehicleLibrary::ProjectOnTrack(const FSplineTrackIndex& Track, const FVector& VehicleLocation, const FTrainingDataComponent* TrainingData, FSplineProjectionComponent& InOutProjection)
+{
+	const FSplineTrackProjection Projection = InOutProjection.bValid
+		? Track.ProjectNear(VehicleLocation, InOutProjection.Distance)
+		: TrainingData
+		? Track.ProjectNear(VehicleLocation, TrainingData->LastSplineDistance)
+		: Track.Project(VehicleLocation);
+
+	InOutProjection.VehicleLocation = VehicleLocation;
+	InOutProjection.InputKey = Projection.InputKey;
+	InOutProjection.Distance = Projection.Distance;
+	InOutProjection.ClosestPoint = Projection.Location;
+	InOutProjection.Tangent = Projection.Tangent;
+	InOutProjection.Right = Projection.Right;
+	InOutProjection.Up = Projection.Up;
+	InOutProjection.SignedLateralOffset = FVector::DotProduct(VehicleLocation - Projection.Location, Projection.Right);
+	InOutProjection.DistanceToSpline = FMath::Sqrt(Projection.DistanceSquared);
+	InOutProjection.Segment = FMath::FloorToInt(Projection.InputKey);
+	InOutProjection.FrameNumber = GFrameCounter;
+	InOutProjection.bValid = true;
+}
+
+const FSplineProjectionComponent& UVehicleLibrary::GetFrameProjection(entt::registry& Registry, entt::entity Entity, const FSplineTrackIndex& Track, const APawn* Pawn, FSplineProjectionComponent& Scratch)
+{
+	if (const FSplineProjectionComponent* Current = Registry.try_get<FSplineProjectionComponent>(Entity))
+	{
+		if (Current->bValid && Current->FrameNumber == GFrameCounter)
+		{
+			return *Current;
+		}
+		Scratch = *Current;
+	}
+	else
+	{
+		Scratch = FSplineProjectionComponent();
+	}
+	ProjectOnTrack(Track, Pawn->GetActorLocation(), Registry.try_get<FTrainingDataComponent>(Entity), Scratch);
+	return Scratch;
+}
@@ -0,0 +1,58 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "VehicleSpawnPoint.h"
+#include "VehicleLibrary.h"
+#include "SplineTrackIndex.h"
+#include "Components/SplineComponent.h"
+#include "Components/TrainingDataComponent.h"
+
+FVehicleSpawnPoint& FVehicleSpawnPoint::Get(entt::registry& Registry)
+{
+	if (FVehicleSpawnPoint* Existing = Registry.ctx().find<FVehicleSpawnPoint>())
+	{
+		return *Existing;
+	}
+	return Registry.ctx().emplace<FVehicleSpawnPoint>();
+}
+
+bool FVehicleSpawnPoint::EnsureBuilt(const USplineComponent* Spline, float SpawnDistance, float VerticalOffset)
+{
+	if (!Spline)
+	{
+		return false;
+	}
+
+	const uint32 Hash = FSplineTrackIndex::HashSpline(*Spline);
+	const bool bUpToDate = SourceSpline.Get() == Spline
+		&& SourceHash == Hash
+		&& SourceSpawnDistance == SpawnDistance
+		&& SourceVerticalOffset == VerticalOffset;
+	if (bUpToDate)
+	{
+		return true;
+	}
+
+	UVehicleLibrary::GetVehicleSpawnTransform(Spline, SpawnDistance, VerticalOffset, Location, Rotation);
+	SplineDistance = Spline->GetDistanceAlongSplineAtLocation(Location, ESplineCoordinateSpace::World);
+	SplineSegment = FMath::FloorToInt(Spline->FindInputKeyClosestToWorldLocation(Location));
+	const int32 NumPoints = Spline->GetNumberOfSplinePoints();
+	NumSegments = NumPoints > 1 ? (Spline->IsClosedLoop() ? NumPoints : NumPoints - 1) : 0;
+
+	SourceSpline = Spline;
+	SourceHash = Hash;
+	SourceSpawnDistance = SpawnDistance;
+	SourceVerticalOffset = VerticalOffset;
+	return true;
+}
+
+void FVehicleSpawnPoint::InitTrainingData(FTrainingDataComponent& OutTrainingData, float CreationTime) const
+{
+	OutTrainingData.DistanceTraveled = 0.0f;
+	OutTrainingData.MaxDistanceTraveled = 0.0f;
+	OutTrainingData.TimeSinceLastProgress = 0.0f;
+	OutTrainingData.CreationTime = CreationTime;
+	OutTrainingData.LapsCompleted = 0;
+	OutTrainingData.NormalizedDistanceInSegment = 0.0f;
+	OutTrainingData.LastSplineDistance = SplineDistance;
+	OutTrainingData.LastSplineSegment = SplineSegment;
+}
@@ -32,40 +32,39 @@ TArray<FNeuralNetworkLayerDescriptor> UVehicleTrainerConfig::GetNNLayerDescripto
 	return Descriptors;
 }
 
+int32 UVehicleTrainerConfig::GetGenomeFloatCount() const
+{
+	// Same layout as TNeuralNetwork::Initialize: per layer, InputSize * OutputSize weights then OutputSize biases
+	const TArray<FNeuralNetworkLayerDescriptor> Descriptors = GetNNLayerDescriptors();
+	int32 Count = 0;
+	for (int32 i = 1; i < Descriptors.Num(); ++i)
+	{
+		Count += (Descriptors[i - 1].NeuronCount + 1) * Descriptors[i].NeuronCount;
+	}
+	return Count;
+}
+
 int32 UVehicleTrainerConfig::GetTotalInputCount() const
 {
-	// Base inputs: 28
-	//  1: Signed distance to spline
-	//  1: Current orientation (Z cross product)
-	//  N: Future orientations (FutureDotProductDistances.Num())
-	//  1: Velocity magnitude
-	// Physics / Kinematic inputs (13):
-	//  1: Pitch angle
-	//  1: Roll angle
-	//  1: Wheels on ground ratio
-	//  1: Height above/below spline
-	//  1: Pitch angular velocity
-	//  1: Yaw angular velocity
-	//  1: Roll angular velocity
-	//  1: Forward velocity component (along spline)
-	//  1: Lateral velocity component (perpendicular to spline)
-	//  1: Vertical velocity component
-	//  1: Spline curvature ahead
-	//  1: Spline curvature direction (signed)
-	//  1: Spline progress (normalized 0-1)
-	// Engine inputs (2):
-	//  1: Normalized engine RPM
-	//  1: Normalized current gear
-	// Per-wheel inputs (4 wheels):
-	//  4: Wheel contact state
-	//  4: Wheel suspension compression
-	// RecurrentInputCount: Recurrent feedback
-	// NOTE: Steering/throttle/brake excluded — recurrent neurons already feed
+	// Enabled InputFeatures (28 with the default list: see FVehicleInputSchema::MakeDefaultFeatures) + recurrent feedback.
+	// NOTE: Steering/throttle/brake are not features — recurrent neurons already feed
 	//       the NN's previous output back as input, so the network knows what
 	//       it commanded last frame.
-	// Total base: 1 + 1 + FutureDotProductDistances.Num() + 1 + 13 + 4 + 4 + 2 = 28
-	return 1 + 1 + FutureDotProductDistances.Num() + 1 + 13 + 4 + 4 + 2 + RecurrentInputCount;
+	return FVehicleInputSchema::CountInputs(*this) + RecurrentInputCount;
+}
+
+#if WITH_EDITOR
+void UVehicleTrainerConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Duplicates are checked here once per edit instead of on every schema compile
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UVehicleTrainerConfig, InputFeatures))
+	{
+		FVehicleInputSchema::ValidateFeatures(*this);
+	}
 }
+#endif
 
 int32 UVehicleTrainerConfig::GetTotalOutputCount() const
 {
@@ -8,6 +8,11 @@
 #include "Systems/VehicleEntityFactory.h"
 #include "Systems/VehicleNNOutputSystem.h"
 #include "Systems/VehicleNNInputSystem.h"
+#include "Systems/KinematicVehicleSystem.h"
+#include "Systems/VehicleSplineProjectionSystem.h"
+#include "Systems/VehicleShardSchedulerSystem.h"
+#include "Systems/VehicleDecisionHoldSystem.h"
+#include "Systems/VehicleAsyncControlSystem.h"
 #include "Systems/VehicleProgressSystem.h"
 #include "Systems/VehicleResetFlagSystem.h"
 #include "Systems/VehicleFitnessSystem.h"
@@ -16,12 +21,16 @@
 #include "Systems/TournamentSelectionSystem.h"
 #include "Systems/BreedFloatGenomesSystem.h"
 #include "Systems/MutationFloatGenomeSystem.h"
+#include "Systems/IslandGASystem.h"
 #include "Systems/VehicleResetSystem.h"
+#include "Systems/VehicleReactiveGASystem.h"
 #include "Systems/GAStalenessSystem.h"
 #include "Systems/GACleanupSystem.h"
+#include "Systems/FarmEliteExchangeSystem.h"
 #include "Systems/GADebugDataSystem.h"
 #include "Systems/VehicleTrainerDebugSystem.h"
 #include "Components/GenomeComponents.h"
+#include "Farm/TrainingFarm.h"
 
 #include "Blueprint/UserWidget.h"
 #include "UI/VehicleTrainerDebugWidget.h"
@@ -45,30 +54,51 @@ AVehicleTrainerContext::AVehicleTrainerContext()
 	
 	auto& EvaluateEvent = EcsChainEvents.ChainEvents.FindOrAdd(EvaluateNetworkEvent);
 	
+	EvaluateEvent.Elements.Add(CreateDefaultSubobject<UVehicleShardSchedulerSystem>("NetworkShardSys"));
+	EvaluateEvent.Elements.Add(CreateDefaultSubobject<UVehicleAsyncControlSystem>("AsyncControlSys"));
+	EvaluateEvent.Elements.Add(CreateDefaultSubobject<UKinematicVehicleSystem>("KinematicSys"));
+	EvaluateEvent.Elements.Add(CreateDefaultSubobject<UVehicleSplineProjectionSystem>("ProjectionSys"));
+	// Reactive replacement only (bReactiveReplacement); ConfigureGAPipeline removes these otherwise
+	UVehicleProgressSystem* ReactiveProgressSys = CreateDefaultSubobject<UVehicleProgressSystem>("ReactiveProgressSys");
+	ReactiveProgressSys->ShardChannel = EVehicleShardChannel::Network;
+	EvaluateEvent.Elements.Add(ReactiveProgressSys);
+	UVehicleResetFlagSystem* ReactiveResetFlagSys = CreateDefaultSubobject<UVehicleResetFlagSystem>("ReactiveResetFlagSys");
+	ReactiveResetFlagSys->ShardChannel = EVehicleShardChannel::Network;
+	EvaluateEvent.Elements.Add(ReactiveResetFlagSys);
+	EvaluateEvent.Elements.Add(CreateDefaultSubobject<UVehicleReactiveGASystem>("ReactiveGASys"));
+	EvaluateEvent.Elements.Add(CreateDefaultSubobject<UVehicleDecisionHoldSystem>("DecisionHoldSys"));
 	EvaluateEvent.Elements.Add(CreateDefaultSubobject<UVehicleNNInputSystem>("NNInputSys"));
 	EvaluateEvent.Elements.Add(CreateDefaultSubobject<USimpleMLNNFloatFeedforwardSystem>("FeedForwardSys"));
 	EvaluateEvent.Elements.Add(CreateDefaultSubobject<UVehicleNNOutputSystem>("NNOutputSys"));
 	EvaluateEvent.bIsUpdateSystems = true;
-	EvaluateEvent.UpdateFreqSec = 0.1f;
+	EvaluateEvent.UpdateFreqSec = NetworkDecisionPeriodSec;
 	
 	auto& GAEvent = EcsChainEvents.ChainEvents.FindOrAdd(GAEvaluationEvent);
 	
+	UVehicleShardSchedulerSystem* GAShardSys = CreateDefaultSubobject<UVehicleShardSchedulerSystem>("GAShardSys");
+	GAShardSys->Channel = EVehicleShardChannel::GA;
+	GAEvent.Elements.Add(GAShardSys);
+	UVehicleSplineProjectionSystem* GAProjectionSys = CreateDefaultSubobject<UVehicleSplineProjectionSystem>("GAProjectionSys");
+	GAProjectionSys->ShardChannel = EVehicleShardChannel::GA;
+	GAEvent.Elements.Add(GAProjectionSys);
 	GAEvent.Elements.Add(CreateDefaultSubobject<UVehicleProgressSystem>("ProgressSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UVehicleResetFlagSystem>("ResetFlagSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UVehicleFitnessEligibilitySystem>("FitnessEligibilitySys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UVehicleFitnessSystem>("FitnessSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UGAStalenessSystem>("StalenessSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UVehicleEliteSelectionSystem>("EliteSys"));
+	GAEvent.Elements.Add(CreateDefaultSubobject<UIslandGASystem>("IslandSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UTournamentSelectionSystem>("SelectionSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UBreedFloatGenomesSystem>("BreedSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UMutationFloatGenomeSystem>("MutationSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UVehicleResetSystem>("ResetSys"));
+	GAEvent.Elements.Add(CreateDefaultSubobject<UFarmEliteExchangeSystem>("FarmExchangeSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UGACleanupSystem>("CleanupSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UGADebugDataSystem>("GADebugDataSys"));
 	GAEvent.Elements.Add(CreateDefaultSubobject<UVehicleTrainerDebugSystem>("TrainerDebugSys"));
 	
 	GAEvent.bIsUpdateSystems = true;
-	GAEvent.UpdateFreqSec = 0.5f;
+	GAEvent.UpdateFreqSec = GADecisionPeriodSec;
 
 	InitializeSystemsFromConfig();
 }
@@ -92,6 +122,12 @@ void AVehicleTrainerContext::InitializeSystemsFromConfig()
 		return;
 	}
 
+	UBreedFloatGenomesSystem* BreedSystem = nullptr;
+	UMutationFloatGenomeSystem* MutationSystem = nullptr;
+	UIslandGASystem* IslandSystem = nullptr;
+	UVehicleResetSystem* ResetSystem = nullptr;
+	UVehicleReactiveGASystem* ReactiveSystem = nullptr;
+
 	// Iterate through systems in NewGenerationEvent and EvaluateNetworkEvent to initialize parameters
 	TArray<FName> EventNames = { EvaluateNetworkEvent, GAEvaluationEvent, FEcsChainEventNames::BeginPlay };
 	for (const FName& EventName : EventNames)
@@ -107,6 +143,10 @@ void AVehicleTrainerContext::InitializeSystemsFromConfig()
 			}
 			else if (UTournamentSelectionSystem* SelectionSys = Cast<UTournamentSelectionSystem>(Element.GetInterface()))
 			{
+				SelectionSys->SelectionMode = TrainerConfig->SelectionMode;
+				SelectionSys->LinearRankPressure = TrainerConfig->LinearRankPressure;
+				SelectionSys->ExponentialRankBase = TrainerConfig->ExponentialRankBase;
+				SelectionSys->ProportionalWeightFloor = TrainerConfig->ProportionalWeightFloor;
 				SelectionSys->TournamentSize = TrainerConfig->TournamentSize;
 				SelectionSys->SelectionPressure = TrainerConfig->SelectionPressure;
 				SelectionSys->bHigherIsBetter = TrainerConfig->bHigherIsBetter;
@@ -122,6 +162,51 @@ void AVehicleTrainerContext::InitializeSystemsFromConfig()
 				BreedSys->ClampMin = TrainerConfig->BreedingClampMin;
 				BreedSys->ClampMax = TrainerConfig->BreedingClampMax;
 				BreedSys->RandomSeed = RandomSeed;
+				BreedSys->bRecordLineage = TrainerConfig->bRecordLineage;
+				BreedSystem = BreedSys;
+			}
+			else if (UIslandGASystem* IslandSys = Cast<UIslandGASystem>(Element.GetInterface()))
+			{
+				IslandSys->TournamentSize = TrainerConfig->TournamentSize;
+				IslandSys->SelectionPressure = TrainerConfig->SelectionPressure;
+				IslandSys->bHigherIsBetter = TrainerConfig->bHigherIsBetter;
+				IslandSys->bElitesAlwaysWin = TrainerConfig->bElitesAlwaysWin;
+				IslandSys->MigrationInterval = TrainerConfig->IslandMigrationInterval;
+				IslandSys->MigrantsPerIsland = TrainerConfig->IslandMigrantsPerIsland;
+				IslandSys->ContextSeed = RandomSeed;
+				IslandSystem = IslandSys;
+			}
+			else if (UVehicleReactiveGASystem* ReactiveSys = Cast<UVehicleReactiveGASystem>(Element.GetInterface()))
+			{
+				ReactiveSys->ContextSeed = RandomSeed;
+				ReactiveSystem = ReactiveSys;
+			}
+			else if (UVehicleResetSystem* ResetSys = Cast<UVehicleResetSystem>(Element.GetInterface()))
+			{
+				ResetSystem = ResetSys;
+			}
+			else if (UFarmEliteExchangeSystem* FarmSys = Cast<UFarmEliteExchangeSystem>(Element.GetInterface()))
+			{
+				FarmSys->ExchangeInterval = TrainerConfig->FarmExchangeInterval;
+				FarmSys->ElitesPerPopulation = TrainerConfig->FarmElitesPerPopulation;
+				FarmSys->MaxMigrantsPerExchange = TrainerConfig->FarmMaxMigrantsPerExchange;
+				FarmSys->bHigherIsBetter = TrainerConfig->bHigherIsBetter;
+			}
+			else if (UVehicleShardSchedulerSystem* ShardSys = Cast<UVehicleShardSchedulerSystem>(Element.GetInterface()))
+			{
+				ShardSys->NumShards = ShardSys->Channel == EVehicleShardChannel::GA ? TrainerConfig->GAEvaluationShards : TrainerConfig->NetworkEvaluationShards;
+				ShardSys->Partition = TrainerConfig->ShardPartition;
+			}
+			else if (UKinematicVehicleSystem* KinematicSys = Cast<UKinematicVehicleSystem>(Element.GetInterface()))
+			{
+				KinematicSys->Params = TrainerConfig->KinematicVehicleParams;
+			}
+			else if (UGACleanupSystem* CleanupSys = Cast<UGACleanupSystem>(Element.GetInterface()))
+			{
+				CleanupSys->LineageSpillFile = TrainerConfig->LineageSpillFile.IsEmpty()
+					? FString()
+					: FString::Printf(TEXT("%s_%d.lineage"), *TrainerConfig->LineageSpillFile, ContextIndex);
+				CleanupSys->LineageMaxResidentRecords = TrainerConfig->LineageMaxResidentRecords;
 			}
 			else if (UMutationFloatGenomeSystem* MutationSys = Cast<UMutationFloatGenomeSystem>(Element.GetInterface()))
 			{
@@ -131,6 +216,7 @@ void AVehicleTrainerContext::InitializeSystemsFromConfig()
 				MutationSys->RandomResetMin = TrainerConfig->RandomResetMin;
 				MutationSys->RandomResetMax = TrainerConfig->RandomResetMax;
 				MutationSys->ContextSeed = RandomSeed;
+				MutationSystem = MutationSys;
 			}
  			else if (USimpleMLNNFloatInitSystem* InitSys = Cast<USimpleMLNNFloatInitSystem>(Element.GetInterface()))
 				{
@@ -147,11 +233,102 @@ void AVehicleTrainerContext::InitializeSystemsFromConfig()
 			}
 		}
 	}
+
+	// Sharded chains fire once per shard so every vehicle keeps its decision period
+	if (FChainEventData* EvaluateData = EcsChainEvents.ChainEvents.Find(EvaluateNetworkEvent))
+	{
+		EvaluateData->UpdateFreqSec = NetworkDecisionPeriodSec / FMath::Max(TrainerConfig->NetworkEvaluationShards, 1);
+	}
+	if (FChainEventData* GAData = EcsChainEvents.ChainEvents.Find(GAEvaluationEvent))
+	{
+		GAData->UpdateFreqSec = GADecisionPeriodSec / FMath::Max(TrainerConfig->GAEvaluationShards, 1);
+	}
+
+	// The island system borrows the serial breeder/mutator settings and kernels
+	if (IslandSystem)
+	{
+		IslandSystem->Breeder = BreedSystem;
+		IslandSystem->Mutator = MutationSystem;
+	}
+
+	// The reactive system borrows the same kernels and the GA chain's reset pass
+	if (ReactiveSystem)
+	{
+		ReactiveSystem->Breeder = BreedSystem;
+		ReactiveSystem->Mutator = MutationSystem;
+		ReactiveSystem->Resetter = ResetSystem;
+	}
+}
+
+void AVehicleTrainerContext::ConfigureGAPipeline()
+{
+	FChainEventData* GAEventData = EcsChainEvents.ChainEvents.Find(GAEvaluationEvent);
+	if (!GAEventData || !TrainerConfig)
+	{
+		return;
+	}
+
+	const bool bIslands = TrainerConfig->bUseIslandModel;
+	for (int32 i = GAEventData->Elements.Num() - 1; i >= 0; --i)
+	{
+		auto& Element = GAEventData->Elements[i];
+		const bool bSerialStep = Cast<UTournamentSelectionSystem>(Element.GetInterface())
+			|| Cast<UBreedFloatGenomesSystem>(Element.GetInterface())
+			|| Cast<UMutationFloatGenomeSystem>(Element.GetInterface());
+		const bool bIslandStep = Cast<UIslandGASystem>(Element.GetInterface()) != nullptr;
+		if (bIslands ? bSerialStep : bIslandStep)
+		{
+			GAEventData->Elements.RemoveAt(i);
+		}
+	}
+
+	// Reset checks run in exactly one chain: per network firing with reactive replacement, per GA step otherwise
+	const bool bReactive = TrainerConfig->bReactiveReplacement;
+	auto IsResetCheckStep = [](const auto& Element, EVehicleShardChannel Channel)
+	{
+		if (const UVehicleProgressSystem* ProgressSys = Cast<UVehicleProgressSystem>(Element.GetInterface()))
+		{
+			return ProgressSys->ShardChannel == Channel;
+		}
+		if (const UVehicleResetFlagSystem* ResetFlagSys = Cast<UVehicleResetFlagSystem>(Element.GetInterface()))
+		{
+			return ResetFlagSys->ShardChannel == Channel;
+		}
+		return false;
+	};
+	if (bReactive)
+	{
+		for (int32 i = GAEventData->Elements.Num() - 1; i >= 0; --i)
+		{
+			auto& Element = GAEventData->Elements[i];
+			// The GA-channel projection only fed the reset checks
+			const UVehicleSplineProjectionSystem* ProjectionSys = Cast<UVehicleSplineProjectionSystem>(Element.GetInterface());
+			if (IsResetCheckStep(Element, EVehicleShardChannel::GA) || (ProjectionSys && ProjectionSys->ShardChannel == EVehicleShardChannel::GA))
+			{
+				GAEventData->Elements.RemoveAt(i);
+			}
+		}
+	}
+	else if (FChainEventData* EvaluateData = EcsChainEvents.ChainEvents.Find(EvaluateNetworkEvent))
+	{
+		for (int32 i = EvaluateData->Elements.Num() - 1; i >= 0; --i)
+		{
+			auto& Element = EvaluateData->Elements[i];
+			if (IsResetCheckStep(Element, EVehicleShardChannel::Network) || Cast<UVehicleReactiveGASystem>(Element.GetInterface()))
+			{
+				EvaluateData->Elements.RemoveAt(i);
+			}
+		}
+	}
 }
 
 void AVehicleTrainerContext::BeginPlay()
 {
+	// Attach to the farm before anything allocates solution ids: attaching sets this process's id origin
+	FTrainingFarmWorker::Get();
+
 	InitializeSystemsFromConfig();
+	ConfigureGAPipeline();
 	Super::BeginPlay();
 
 	// Pre-warm nuke cooldown so no population can be nuked immediately on startup
@@ -0,0 +1,45 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "VehicleTrainingCommandlet.generated.h"
+
+class AVehicleTrainerContext;
+
+/**
+ * UVehicleTrainingCommandlet
+ * Headless trainer: loads a map, steps its world with a fixed timestep as fast as the CPU allows
+ * (no rendering, no UI) and lets every AVehicleTrainerContext in it train on simulated time.
+ *
+ * Usage:
+ *   <Editor> <Project> -run=VehicleTraining -Map=/Game/Maps/Circuit [-Config=/Game/Trainer/Config.Config]
+ *     [-FixedStep=0.0166] [-MaxSimSeconds=N] [-MaxWallSeconds=N] [-TargetFitness=F]
+ *     [-Checkpoint=Name] [-CheckpointInterval=600] [-Resume=Name]
+ *
+ * - Config overrides the TrainerConfig of every context; debug drawing is switched off.
+ * - Contexts without a ContextIndex get their order in the level.
+ * - Stops at the first budget reached; a checkpoint per context (Saved/Training/<Name>_<ContextIndex>.ckpt)
+ *   is written every CheckpointInterval simulated seconds and at exit. Resume restores elites from one.
+ */
+UCLASS()
+class SPLINECIRCUITTRAINER_API UVehicleTrainingCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UVehicleTrainingCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	UWorld* LoadWorld(const FString& MapName) const;
+	void UnloadWorld(UWorld* World) const;
+
+	/** Best elite fitness over all contexts; false while no context has a scored elite. */
+	bool GetBestFitness(TConstArrayView<AVehicleTrainerContext*> Contexts, float& OutBest) const;
+
+	void WriteCheckpoints(TConstArrayView<AVehicleTrainerContext*> Contexts, const FString& Name, double SimTime) const;
+	FString CheckpointPath(const FString& Name, const AVehicleTrainerContext* Context) const;
+};
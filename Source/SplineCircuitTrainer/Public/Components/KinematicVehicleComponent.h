@@ -0,0 +1,23 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "KinematicVehicleComponent.generated.h"
+
+/**
+ * FKinematicVehicleComponent
+ * Links a vehicle entity to its row in the registry's FKinematicVehicleBatch.
+ * Slot is INDEX_NONE for pawns that were checked and are not kinematic (full physics vehicles).
+ */
+USTRUCT(BlueprintType)
+struct SPLINECIRCUITTRAINER_API FKinematicVehicleComponent
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
+	int32 Slot = INDEX_NONE;
+
+	/** Location the system last wrote to the pawn; any other location means the pawn was teleported. */
+	FVector LastWrittenLocation = FVector::ZeroVector;
+};
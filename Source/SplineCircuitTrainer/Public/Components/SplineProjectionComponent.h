@@ -0,0 +1,60 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SplineProjectionComponent.generated.h"
+
+/**
+ * FSplineProjectionComponent
+ * The vehicle's location and its projection on the circuit spline, written once per tick by
+ * UVehicleSplineProjectionSystem and read by the input, progress and reset-flag systems.
+ * Vectors are world space; Right and Up are the spline's own frame at the closest point.
+ */
+USTRUCT(BlueprintType)
+struct SPLINECIRCUITTRAINER_API FSplineProjectionComponent
+{
+	GENERATED_BODY()
+
+	/** Pawn location the projection was computed for. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	FVector VehicleLocation = FVector::ZeroVector;
+
+	/** Spline input key of the closest point (segment index + fraction). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	float InputKey = 0.0f;
+
+	/** Distance along the spline of the closest point. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	float Distance = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	FVector ClosestPoint = FVector::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	FVector Tangent = FVector::ForwardVector;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	FVector Right = FVector::RightVector;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	FVector Up = FVector::UpVector;
+
+	/** Offset from the spline along Right (positive = right of the spline). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	float SignedLateralOffset = 0.0f;
+
+	/** Straight-line distance from the vehicle to ClosestPoint. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	float DistanceToSpline = 0.0f;
+
+	/** Spline segment (floor of InputKey). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline Projection")
+	int32 Segment = 0;
+
+	/** GFrameCounter of the update; consumers recompute when it is not the current frame. */
+	uint64 FrameNumber = 0;
+
+	/** False until the first projection; a valid projection seeds the next one. */
+	bool bValid = false;
+};
@@ -0,0 +1,37 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VehicleDecisionComponent.generated.h"
+
+/**
+ * FVehicleDecisionComponent
+ * State of a vehicle's last network decision, kept by UVehicleDecisionHoldSystem: the time since the network last
+ * ran and the key inputs it saw then. Removed on reset so the next firing evaluates the new genome.
+ */
+USTRUCT(BlueprintType)
+struct SPLINECIRCUITTRAINER_API FVehicleDecisionComponent
+{
+	GENERATED_BODY()
+
+	/** Seconds since the network was last evaluated for this vehicle. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Decision")
+	float TimeSinceDecision = 0.0f;
+
+	/** Curvature ahead (1 - tangent dot over the lookahead distance) at the last decision. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Decision")
+	float Curvature = 0.0f;
+
+	/** Signed lateral offset from the spline (cm) at the last decision. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Decision")
+	float LateralOffset = 0.0f;
+
+	/** Speed (cm/s) at the last decision. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Decision")
+	float Speed = 0.0f;
+
+	/** Number of network evaluations skipped since the last decision. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Decision")
+	int32 HeldTicks = 0;
+};
@@ -0,0 +1,95 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// SplineCircuitTrainer module: local multi-process training farm
+// Why: One process saturates only part of a big Linux box (game thread bound GA + physics). The farm
+// runs N headless game processes, each with its own contexts, and lets them share their best elites
+// through an FSharedEliteRing instead of training in isolation.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Farm/SharedEliteRing.h"
+
+/** Settings the coordinator uses to launch workers; ring dimensions are forwarded on the worker command line. */
+struct FTrainingFarmSettings
+{
+	int32 NumWorkers = 4;
+
+	/** Map to open in each worker (empty = the project's default game map). */
+	FString MapName;
+
+	/** Shared memory name (empty = derived from the coordinator's process id). */
+	FString RingName;
+
+	int32 RingSlots = 1024;
+
+	/** Largest genome (floats) that can be exchanged; must cover the network size. */
+	int32 MaxGenomeFloats = 1 << 16;
+
+	/** Run workers as UVehicleTrainingCommandlet (fixed-step, max rate) instead of a -game session; needs MapName. */
+	bool bHeadlessCommandlet = true;
+
+	/** Appended verbatim to every worker command line (e.g. -MaxWallSeconds= for commandlet workers). */
+	FString ExtraArgs;
+
+	/** Seconds between aggregated progress log lines. */
+	float ProgressLogInterval = 10.0f;
+};
+
+/**
+ * Worker side: present in a process started with -TrainingFarmRing=<name> -TrainingFarmWorker=<index>.
+ * Owns the process-wide ring mapping and merges the progress of every context in this process
+ * into the worker's progress slot.
+ */
+class SPLINECIRCUITTRAINER_API FTrainingFarmWorker
+{
+public:
+	/** The worker for this process, or nullptr when not launched by a farm (or the ring cannot be opened). */
+	static FTrainingFarmWorker* Get();
+
+	int32 GetWorkerIndex() const { return WorkerIndex; }
+	FSharedEliteRing& GetRing() { return Ring; }
+
+	/** Stores the progress of one context (keyed by any stable pointer) and republishes the process total. */
+	void ReportContextProgress(const void* ContextKey, const FSharedFarmProgress& Progress);
+	void RemoveContext(const void* ContextKey);
+
+private:
+	void PublishProgress();
+
+	FSharedEliteRing Ring;
+	int32 WorkerIndex = INDEX_NONE;
+	double StartTime = 0.0;
+	TMap<const void*, FSharedFarmProgress> ContextProgress;
+};
+
+/**
+ * Coordinator side: creates the ring, launches worker processes of the current executable,
+ * watches them and logs aggregated progress. Console: SimpleML.Farm.Start [NumWorkers] [Map], .Status, .Stop
+ */
+class SPLINECIRCUITTRAINER_API FTrainingFarmCoordinator
+{
+public:
+	~FTrainingFarmCoordinator();
+
+	bool Start(const FTrainingFarmSettings& InSettings);
+	void Stop();
+
+	bool IsRunning() const { return Ring.IsValid(); }
+	int32 NumRunningWorkers() const;
+
+	/** Latest progress of every worker that has reported. */
+	void GetProgress(TArray<FSharedFarmProgress>& Out) const { Ring.ReadProgress(Out); }
+
+	/** Writes one aggregated progress line to the log. */
+	void LogProgress() const;
+
+private:
+	bool Tick(float DeltaTime);
+	FString BuildWorkerArgs(int32 WorkerIndex) const;
+
+	FTrainingFarmSettings Settings;
+	FSharedEliteRing Ring;
+	TArray<FProcHandle> Workers;
+	FTSTicker::FDelegateHandle TickHandle;
+	double NextLogTime = 0.0;
+};
@@ -0,0 +1,145 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// SplineCircuitTrainer module: cheap vehicle dynamics surrogate
+// Why: Chaos vehicles cost a full physics body, wheel raycasts and suspension solve per car, capping training
+// at a few hundred agents per machine. A planar dynamic bicycle model with saturating tires, an engine
+// torque curve and an automatic gearbox is enough to pre-train thousands of agents per core on the spline
+// before fine-tuning on full physics.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+#include "KinematicVehicleModel.generated.h"
+
+/** Vehicle constants for the surrogate, in SI units (m, kg, N, rad). */
+USTRUCT(BlueprintType)
+struct SPLINECIRCUITTRAINER_API FKinematicVehicleParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Chassis", meta=(ClampMin="1.0", Units="kg"))
+	float Mass = 1500.0f;
+
+	/** Yaw moment of inertia (kg m^2) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Chassis", meta=(ClampMin="1.0"))
+	float YawInertia = 2500.0f;
+
+	/** Center of mass to front axle (m) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Chassis", meta=(ClampMin="0.1"))
+	float FrontAxleDistance = 1.2f;
+
+	/** Center of mass to rear axle (m) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Chassis", meta=(ClampMin="0.1"))
+	float RearAxleDistance = 1.4f;
+
+	/** Linear tire cornering stiffness per axle (N/rad) before saturation */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Tires", meta=(ClampMin="0.0"))
+	float FrontCorneringStiffness = 80000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Tires", meta=(ClampMin="0.0"))
+	float RearCorneringStiffness = 90000.0f;
+
+	/** Friction coefficient; axle forces saturate at Friction * axle load */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Tires", meta=(ClampMin="0.0"))
+	float Friction = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Steering", meta=(ClampMin="0.0", Units="deg"))
+	float MaxSteerAngle = 35.0f;
+
+	/** First-order steering response (1/s); higher = faster wheels */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Steering", meta=(ClampMin="0.0"))
+	float SteerResponse = 8.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Engine", meta=(ClampMin="0.0"))
+	float MaxEngineTorque = 400.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Engine", meta=(ClampMin="0.0"))
+	float IdleRPM = 900.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Engine", meta=(ClampMin="1.0"))
+	float RedlineRPM = 7000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Transmission")
+	TArray<float> GearRatios = { 3.5f, 2.2f, 1.5f, 1.1f, 0.9f, 0.75f };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Transmission", meta=(ClampMin="0.1"))
+	float FinalDriveRatio = 3.7f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Transmission")
+	float UpshiftRPM = 6500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Transmission")
+	float DownshiftRPM = 2500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Transmission", meta=(ClampMin="0.01", Units="m"))
+	float WheelRadius = 0.33f;
+
+	/** Total brake force at full brake input (N) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Brakes", meta=(ClampMin="0.0"))
+	float BrakeForce = 12000.0f;
+
+	/** Aerodynamic drag: F = Drag * v^2 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Resistance", meta=(ClampMin="0.0"))
+	float Drag = 0.4f;
+
+	/** Rolling resistance: F = RollingResistance * v */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Resistance", meta=(ClampMin="0.0"))
+	float RollingResistance = 30.0f;
+
+	/** Below this speed (m/s) the tire model blends into the kinematic bicycle (slip angles are ill-defined at rest) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle|Tires", meta=(ClampMin="0.1"))
+	float LowSpeedBlend = 3.0f;
+};
+
+/**
+ * Struct-of-arrays state for every surrogate vehicle of a registry; use FKinematicVehicleBatch::Get(Registry).
+ * Entities refer to their row through FKinematicVehicleComponent::Slot. The registry's batch releases a row when its
+ * component is destroyed; released rows stay in the arrays at rest and are handed out again by Add.
+ *
+ * Step() advances all rows in one loop over contiguous float arrays (no per-vehicle objects, no branches
+ * apart from the gear table lookup), so the compiler can keep the whole batch in cache and vectorize
+ * the arithmetic. Positions are metres in the XY plane; Z is carried through unchanged (flat tracks).
+ */
+struct SPLINECIRCUITTRAINER_API FKinematicVehicleBatch
+{
+	/** Returns the registry's batch, creating an empty one on first use. */
+	static FKinematicVehicleBatch& Get(entt::registry& Registry);
+
+	/** Adds a vehicle at rest in a released row, or appends one; returns its slot. LocationCm is in Unreal units. */
+	int32 Add(const FVector& LocationCm, float YawRadians);
+
+	/** Parks the row at rest with zero controls and makes it available to Add. */
+	void Remove(int32 Slot);
+
+	/** Puts a vehicle back at rest at a new pose (after a teleport/reset). */
+	void ResetSlot(int32 Slot, const FVector& LocationCm, float YawRadians);
+
+	/** Rows in the arrays, including released ones */
+	int32 Num() const { return X.Num(); }
+
+	int32 NumFree() const { return FreeSlots.Num(); }
+
+	void Step(const FKinematicVehicleParams& Params, float DeltaTime);
+
+	FVector GetLocationCm(int32 Slot) const { return FVector(X[Slot], Y[Slot], Z[Slot]) * 100.0f; }
+
+	/** World-space velocity in cm/s. */
+	FVector GetVelocityCm(int32 Slot) const;
+
+	// Pose and body-frame motion (m, rad, m/s, rad/s)
+	TArray<float> X, Y, Z, Yaw;
+	TArray<float> ForwardSpeed, LateralSpeed, YawRate;
+
+	// Drivetrain / chassis
+	TArray<float> SteerAngle;
+	TArray<float> EngineRPM;
+	TArray<float> Gear; // 0-based forward gear, stored as float to keep the batch homogeneous
+	TArray<float> LongitudinalAccel, LateralAccel;
+
+	// Controls written before each step: steer [-1,1], throttle [-1,1] (negative brakes), brake [0,1]
+	TArray<float> SteerInput, ThrottleInput, BrakeInput;
+
+private:
+	void OnComponentDestroyed(entt::registry& Registry, entt::entity Entity);
+
+	TArray<int32> FreeSlots;
+};
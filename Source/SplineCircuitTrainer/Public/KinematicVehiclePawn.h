@@ -0,0 +1,73 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Pawn.h"
+#include "VehicleNNInterface.h"
+#include "KinematicVehiclePawn.generated.h"
+
+class UStaticMeshComponent;
+
+/**
+ * AKinematicVehiclePawn
+ * Vehicle pawn without physics: UKinematicVehicleSystem integrates it in the context's FKinematicVehicleBatch
+ * and writes pose, velocity and drivetrain telemetry back here, so the trainer's input, progress and reset
+ * systems treat it exactly like a Chaos vehicle. Set it as VehiclePawnClass to pre-train at surrogate speed.
+ *
+ * Outputs: [0] steering [-1,1], [1] throttle [-1,1] (negative brakes), optional [2] brake [0,1].
+ */
+UCLASS(Blueprintable)
+class SPLINECIRCUITTRAINER_API AKinematicVehiclePawn : public APawn, public IVehicleNNInterface
+{
+	GENERATED_BODY()
+
+public:
+	AKinematicVehiclePawn();
+
+	// Begin IVehicleNNInterface
+	virtual void ApplyNNOutputs(TArrayView<const float> Outputs) override;
+	virtual void FillTelemetry(FVehicleTelemetry& Out) const override;
+	virtual float GetWheelsOnGroundRatio() const override { return 1.0f; }
+	virtual void GetWheelContactStates(TArray<float>& OutStates) const override;
+	virtual void GetWheelSuspensionCompression(TArray<float>& OutCompression) const override;
+	virtual float GetNormalizedRPM() const override { return NormalizedRPM; }
+	virtual float GetNormalizedGear(int32 MaxGear) const override;
+	// End IVehicleNNInterface
+
+	virtual FVector GetVelocity() const override { return Velocity; }
+
+	/** Called by UKinematicVehicleSystem after each step with the slot's telemetry. */
+	void SetTelemetry(const FVector& InVelocity, float InNormalizedRPM, int32 InGear, int32 InNumGears, float LongitudinalAccel, float LateralAccel);
+
+	float GetSteerInput() const { return SteerInput; }
+	float GetThrottleInput() const { return ThrottleInput; }
+	float GetBrakeInput() const { return BrakeInput; }
+
+	/** Visual only; no collision and no simulation */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
+	TObjectPtr<UStaticMeshComponent> Body;
+
+	/** Suspension compression at rest; load transfer moves each wheel around it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float RestCompression = 0.5f;
+
+	/** Compression change per g of longitudinal or lateral acceleration */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle", meta=(ClampMin="0.0"))
+	float CompressionPerG = 0.25f;
+
+private:
+	/** Load-transfer suspension compression, FL, FR, RL, RR */
+	void ComputeSuspensionCompression(float OutCompression[4]) const;
+
+	float SteerInput = 0.0f;
+	float ThrottleInput = 0.0f;
+	float BrakeInput = 0.0f;
+
+	FVector Velocity = FVector::ZeroVector;
+	float NormalizedRPM = 0.0f;
+	int32 Gear = 0;
+	int32 NumGears = 1;
+	float LongitudinalG = 0.0f;
+	float LateralG = 0.0f;
+};
@@ -0,0 +1,155 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// SplineCircuitTrainer module: baked closest-point index of the circuit spline
+// Why: USplineComponent::FindInputKeyClosestToWorldLocation searches every segment of the spline iteratively, and
+// the input, progress and reset systems call it several times per car per tick. The circuit does not change while
+// training, so it is sampled once into a dense polyline bucketed in a uniform XY grid; a projection then tests the
+// few segments around the query point and refines the result on the real spline.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+
+class USplineComponent;
+
+/** Result of projecting a world location on the track. Vectors are world space and unit length. */
+struct FSplineTrackProjection
+{
+	/** Spline input key of the closest point (segment index + fraction) */
+	float InputKey = 0.0f;
+
+	/** Distance along the spline of the closest point, in [0, Length] */
+	float Distance = 0.0f;
+
+	FVector Location = FVector::ZeroVector;
+	FVector Tangent = FVector::ForwardVector;
+	FVector Up = FVector::UpVector;
+	FVector Right = FVector::RightVector;
+
+	/** Squared distance from the query location to Location */
+	float DistanceSquared = 0.0f;
+
+	/** Polyline segment the closest point lies on (sample index of its start) */
+	int32 Sample = 0;
+};
+
+/** One row of the arc-length feature table; 32 bytes so a lookup touches a single cache line pair. */
+struct FSplineTrackFeature
+{
+	FVector3f Tangent = FVector3f::ForwardVector;
+
+	/** Unsigned curvature (1/cm) */
+	float Curvature = 0.0f;
+
+	FVector3f Up = FVector3f::UpVector;
+
+	/** Turn direction about Up: +1 towards Right, -1 towards left, 0 straight */
+	float CurvatureSign = 0.0f;
+};
+
+/**
+ * Arc-length sampled copy of a circuit spline with a uniform grid over its polyline segments.
+ * Lives in the registry context; use FSplineTrackIndex::Get(Registry) and EnsureBuilt() before querying.
+ *
+ * Samples are a uniform step (at most SampleSpacing) apart along the spline, from its start to its end, and store
+ * position, input key, distance, tangent, up and right. Project() is O(1) for points near the track: it scans
+ * grid rings outward until no unvisited cell can hold a closer segment, then runs a few Gauss-Newton steps on
+ * the spline itself so keys and locations match the spline, not the chord.
+ */
+struct SPLINECIRCUITTRAINER_API FSplineTrackIndex
+{
+	/** Returns the registry's index, creating an empty one on first use. */
+	static FSplineTrackIndex& Get(entt::registry& Registry);
+
+	/**
+	 * (Re)builds the index when the spline, its geometry (HashSpline) or the spacing changed.
+	 * Returns false when there is nothing to query (no spline or zero length).
+	 */
+	bool EnsureBuilt(const USplineComponent* Spline, float SampleSpacing);
+
+	/**
+	 * Hash of the spline's world geometry: component transform, default up vector, loop flag and every point's
+	 * location, tangents, rotation, scale and type. Moving a point changes it even when the length does not.
+	 */
+	static uint32 HashSpline(const USplineComponent& Spline);
+
+	void Build(const USplineComponent* Spline, float SampleSpacing);
+
+	bool IsBuilt() const { return Positions.Num() >= 2; }
+
+	/** Closest point of the spline to Location. Requires IsBuilt(). */
+	FSplineTrackProjection Project(const FVector& Location) const;
+
+	/**
+	 * Temporally coherent projection: searches only the samples within WarmStartWindow of PreviousDistance
+	 * (the vehicle's distance at its last evaluation) and falls back to Project() when the local minimum sits on
+	 * the window border or is further than WarmStartMaxResidual from Location (teleport, reset, shortcut).
+	 */
+	FSplineTrackProjection ProjectNear(const FVector& Location, float PreviousDistance) const;
+
+	/**
+	 * Feature table lookup at a distance along the spline (clamped to [0, Length]): two rows and a lerp,
+	 * for lookahead and curvature inputs that would otherwise need a closest-point search per distance.
+	 */
+	FSplineTrackFeature SampleFeatures(float Distance) const;
+
+	/** Interpolated tangent at a distance along the spline (clamped to [0, Length]). */
+	FVector GetTangentAtDistance(float Distance) const;
+
+	float GetLength() const { return Length; }
+	bool IsClosedLoop() const { return bClosedLoop; }
+	int32 NumSamples() const { return Positions.Num(); }
+
+	/** Changes with every Build(); holders of data derived from the index compare it to notice a rebuild */
+	uint32 GetBuildStamp() const { return BuildStamp; }
+
+	/** Gauss-Newton steps on the spline after the polyline search (0 = chord result only) */
+	int32 RefineIterations = 2;
+
+	/** Half-width (cm along the track) of the ProjectNear() search window; cover the travel between two evaluations */
+	float WarmStartWindow = 1000.0f;
+
+	/** ProjectNear() falls back to a global search when the local result is further than this (cm) from the query */
+	float WarmStartMaxResidual = 1000.0f;
+
+	// Per-sample track data (SoA)
+	TArray<FVector> Positions;
+	TArray<float> InputKeys;
+	TArray<float> Distances;
+	TArray<FVector> Tangents;
+	TArray<FVector> Ups;
+	TArray<FVector> Rights;
+
+	/** Same rows as the samples, packed for SampleFeatures() */
+	TArray<FSplineTrackFeature> Features;
+
+private:
+	/** Key refinement on the spline and interpolation of the per-sample data for a polyline hit. */
+	FSplineTrackProjection Finish(const FVector& Location, int32 Segment, float T) const;
+
+	/** Closest point on polyline segment Segment -> Segment+1; returns the squared distance and the segment parameter. */
+	float ClosestOnSegment(int32 Segment, const FVector& Location, float& OutT) const;
+
+	TArray<float> SegmentInvLengthSquared;
+
+	// Uniform XY grid of polyline segments (CSR: CellStart[c]..CellStart[c+1] indexes CellSegments)
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+	float CellSize = 1.0f;
+	float InvCellSize = 1.0f;
+	int32 GridSizeX = 0;
+	int32 GridSizeY = 0;
+	TArray<int32> CellStart;
+	TArray<int32> CellSegments;
+
+	// Build signature
+	TWeakObjectPtr<const USplineComponent> SourceSpline;
+	const USplineComponent* Spline = nullptr;
+	int32 SourceNumPoints = 0;
+	uint32 SourceHash = 0;
+	uint32 BuildStamp = 0;
+	float Spacing = 0.0f;
+	float SampleStep = 1.0f;
+	float InvSampleStep = 1.0f;
+	float Length = 0.0f;
+	float LastInputKey = 0.0f;
+	bool bClosedLoop = false;
+};
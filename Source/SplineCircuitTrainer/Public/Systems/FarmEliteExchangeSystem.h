@@ -0,0 +1,77 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "Farm/SharedEliteRing.h"
+#include "FarmEliteExchangeSystem.generated.h"
+
+/**
+ * UFarmEliteExchangeSystem
+ * Connects this context to the training farm ring when the process was launched as a farm worker;
+ * otherwise it does nothing.
+ *
+ * Every ExchangeInterval seconds:
+ * 1. Publishes the best ElitesPerPopulation elites of every population that were not published yet.
+ * 2. Reads elites published by other processes; a migrant that beats the worst elite of its population
+ *    overwrites that elite's owned genome and fitness (new local id, SourceId = the remote id).
+ * 3. Reports best/mean elite fitness and births to the farm progress table.
+ *
+ * Runs after breeding so injected elites become parents from the next GA step on.
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew)
+class SPLINECIRCUITTRAINER_API UFarmEliteExchangeSystem : public UEcsSystem
+{
+	GENERATED_BODY()
+
+public:
+	UFarmEliteExchangeSystem();
+
+	/** Seconds (world time) between exchanges */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Farm", meta=(ClampMin="0.0"))
+	float ExchangeInterval = 5.0f;
+
+	/** Best elites per population offered to other processes per exchange */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Farm", meta=(ClampMin="0"))
+	int32 ElitesPerPopulation = 1;
+
+	/** Upper bound on migrants read per exchange */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Farm", meta=(ClampMin="0"))
+	int32 MaxMigrantsPerExchange = 16;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Farm")
+	bool bHigherIsBetter = true;
+
+	virtual void Update_Implementation(float DeltaTime) override;
+	virtual void BeginDestroy() override;
+
+private:
+	struct FEliteRef
+	{
+		entt::entity Entity = entt::null;
+		int32 Population = INDEX_NONE;
+		float Fitness = 0.0f;
+	};
+
+	bool IsBetter(float A, float B) const { return bHigherIsBetter ? A > B : A < B; }
+
+	/** Remembers Id as published; returns false if it already was. Forgets the oldest id beyond MaxPublishedIds. */
+	bool MarkPublished(int64 Id);
+
+	static constexpr int32 MaxPublishedIds = 4096;
+
+	// Reusable caches to avoid per-tick allocations
+	TArray<FEliteRef> Elites;
+	TArray<FSharedEliteRecord> Incoming;
+
+	// Bounded FIFO of published (or injected) ids: the set answers lookups, the ring remembers insertion order
+	TSet<int64> PublishedIds;
+	TArray<int64> PublishedOrder;
+	int32 PublishedHead = 0;
+
+	uint64 ReadCursor = 0;
+	bool bCursorInitialized = false;
+	double NextExchangeTime = 0.0;
+	FSharedFarmProgress Progress;
+};
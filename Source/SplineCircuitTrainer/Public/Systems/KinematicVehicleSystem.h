@@ -0,0 +1,50 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "KinematicVehicleModel.h"
+#include "KinematicVehicleSystem.generated.h"
+
+class AKinematicVehiclePawn;
+
+/**
+ * UKinematicVehicleSystem
+ * Drives every AKinematicVehiclePawn of the context through the shared FKinematicVehicleBatch.
+ *
+ * 1. Gives new vehicle entities a FKinematicVehicleComponent (Slot = INDEX_NONE for physics pawns).
+ * 2. Gathers controls from the pawns; a pawn found away from where it was last written was reset, so its slot restarts at rest.
+ * 3. Integrates the whole batch with fixed substeps covering the world time since the last update.
+ * 4. Scatters pose, velocity and telemetry back to the pawns.
+ *
+ * Runs first in the network evaluation chain so the input system reads the freshly stepped state.
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew)
+class SPLINECIRCUITTRAINER_API UKinematicVehicleSystem : public UEcsSystem
+{
+	GENERATED_BODY()
+
+public:
+	UKinematicVehicleSystem();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle")
+	FKinematicVehicleParams Params;
+
+	/** Integration step (seconds); the model stays stable well beyond the rate the chain runs at */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle", meta=(ClampMin="0.001"))
+	float FixedStep = 1.0f / 120.0f;
+
+	/** Caps the catch-up after a hitch; remaining time is dropped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Kinematic Vehicle", meta=(ClampMin="1"))
+	int32 MaxSubsteps = 32;
+
+	virtual void Update_Implementation(float DeltaTime) override;
+
+private:
+	// Reusable caches to avoid per-tick allocations
+	TArray<TPair<AKinematicVehiclePawn*, int32>> Active;
+
+	double LastWorldTime = -1.0;
+	double Accumulator = 0.0;
+};
@@ -0,0 +1,73 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "VehicleAsyncControl.h"
+#include "VehicleAsyncControlSystem.generated.h"
+
+namespace Chaos
+{
+	class FPBDRigidsSolver;
+}
+
+/**
+ * UVehicleAsyncControlSystem
+ * Game-thread side of async physics control (UVehicleTrainerConfig::bAsyncPhysicsControl), in EvaluateNetworks.
+ *
+ * Registers an FVehicleAsyncControlCallback on the world's physics solver and, on every update:
+ * 1. Copies the latest physics-thread outputs into FNNOutFloatComp; outputs the vehicle did not take on the physics
+ *    thread are applied here with ApplyNNOutputs.
+ * 2. Pushes the vehicle list for the next physics steps: body proxy, telemetry and a copy of the network, refreshed
+ *    when the vehicle's solution id changes (reset). Destroying the pawn or the entity clears the vehicle's Alive flag,
+ *    so the physics thread stops using the pushed pointers before the next list arrives.
+ * Vehicles with a simulating physics body are tagged FNNExternalEvaluationTag so the game-thread projection, input,
+ * feedforward and output systems skip them; the others (e.g. kinematic surrogates) stay on the chain.
+ * GA bookkeeping is unchanged and stays on the game thread.
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew)
+class SPLINECIRCUITTRAINER_API UVehicleAsyncControlSystem : public UEcsSystem
+{
+	GENERATED_BODY()
+
+public:
+	UVehicleAsyncControlSystem();
+
+	virtual void Update_Implementation(float DeltaTime) override;
+	virtual void Deinitialize_Implementation() override;
+
+	/** True while the physics callback is registered */
+	bool IsCallbackRegistered() const { return Callback != nullptr; }
+
+	/** Data handed to the physics thread with the next input, or nullptr before the first refresh */
+	const FVehicleAsyncControlShared* GetShared() const { return Shared.Get(); }
+
+	/**
+	 * Copies one physics-thread output batch into FNNOutFloatComp and applies the first ControlOutputCount values
+	 * with ApplyNNOutputs for the vehicles whose ApplyNNOutputs_Internal declined them.
+	 */
+	void ApplyOutputs(const FVehicleAsyncControlOutput& Output, int32 ControlOutputCount);
+
+private:
+	/** Registers the callback on the current world's solver (again if the solver changed). */
+	bool EnsureCallback();
+
+	void ReleaseCallback();
+
+	/** Stops physics-thread control of the destroyed pawn's vehicle. */
+	UFUNCTION()
+	void HandlePawnDestroyed(AActor* DestroyedActor);
+
+	/** Rebuilds the shared physics-thread data when a config value it reads or the track changed. */
+	void RefreshShared(const UVehicleTrainerConfig& Config, const FSplineTrackIndex& Track, const USplineComponent& Spline);
+
+	FVehicleAsyncControlCallback* Callback = nullptr;
+	Chaos::FPBDRigidsSolver* CallbackSolver = nullptr;
+	bool bHasLoggedSyncPhysics = false;
+	bool bDestroySignalConnected = false;
+
+	TSharedPtr<FVehicleAsyncControlShared, ESPMode::ThreadSafe> Shared;
+	uint32 SharedConfigHash = 0;
+	uint32 SharedTrackStamp = 0;
+};
@@ -0,0 +1,28 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "VehicleDecisionHoldSystem.generated.h"
+
+/**
+ * UVehicleDecisionHoldSystem
+ * Adaptive decision rate (action repeat), between the projection and input systems of EvaluateNetworks.
+ *
+ * A vehicle re-evaluates its network when DecisionHoldMaxSec has passed since its last decision, or earlier when
+ * curvature ahead, lateral offset or speed moved past their thresholds since then. Otherwise it is tagged
+ * FNNHoldOutputTag: the input and feedforward systems skip it and UVehicleNNOutputSystem keeps applying the
+ * outputs of the last evaluation. Straights are held, corners are not.
+ * Disabled (tags cleared) when UVehicleTrainerConfig::DecisionHoldMaxSec is 0.
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew)
+class SPLINECIRCUITTRAINER_API UVehicleDecisionHoldSystem : public UEcsSystem
+{
+	GENERATED_BODY()
+
+public:
+	UVehicleDecisionHoldSystem();
+
+	virtual void Update_Implementation(float DeltaTime) override;
+};
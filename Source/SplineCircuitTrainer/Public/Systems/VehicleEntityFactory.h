@@ -4,11 +4,19 @@
 
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
+#include "entt/entt.hpp"
 #include "VehicleEntityFactory.generated.h"
 
+class APawn;
+class UVehicleTrainerConfig;
+
 /**
  * UVehicleEntityFactory
- * System that spawns pawns and creates ECS entities for them.
+ * System that creates the vehicle pool and spawns a pawn for each entity.
+ * Every entity is created at Initialize with its network and genome view (networks are built on worker threads).
+ * Pawns are spawned at most SpawnBudgetPerFrame per frame; an entity joins the simulation and the GA
+ * (FVehicleComponent, NN buffers, FTrainingDataComponent, FFitnessComponent, FUniqueSolutionComponent) when its pawn
+ * exists, so training starts with the first batch and the feedforward never evaluates a pawnless entity. Pawns are never destroyed: resets reuse them.
  */
 UCLASS(BlueprintType, Blueprintable, EditInlineNew)
 class SPLINECIRCUITTRAINER_API UVehicleEntityFactory : public UEcsSystem
@@ -22,4 +30,27 @@ public:
 	int32 ContextIndex = -1;
 
 	virtual void Initialize_Implementation(AEcsContext* InContext) override;
+	virtual void Deinitialize_Implementation() override;
+
+	/** Spawns the next batch of pending pawns; rescheduled for the next tick while any remain. */
+	void SpawnPendingVehicles();
+
+	/** Number of entities still waiting for their pawn */
+	int32 GetNumPendingVehicles() const { return PendingVehicles.Num() - NextPendingVehicle; }
+
+private:
+	struct FPendingVehicle
+	{
+		entt::entity Entity = entt::null;
+		int32 Population = 0;
+		int32 Index = 0;
+	};
+
+	/** Spawns the pawn of one pooled entity and adds the components that make it a live vehicle. */
+	bool SpawnVehicle(const FPendingVehicle& Pending, const UVehicleTrainerConfig& Config);
+
+	TArray<FPendingVehicle> PendingVehicles;
+	int32 NextPendingVehicle = 0;
+
+	FTimerHandle SpawnTimerHandle;
 };
@@ -4,8 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
+#include "EcsCommandBuffer.h"
 #include "VehicleFitnessEligibilitySystem.generated.h"
 
+class FPopulationIndex;
+class UVehicleTrainerConfig;
+struct FTrainingDataComponent;
+struct FFitnessComponent;
+
 /**
  * UVehicleFitnessEligibilitySystem
  * Manages adding FFitnessComponent to entities based on their Age.
@@ -21,4 +27,14 @@ public:
 	UVehicleFitnessEligibilitySystem();
 
 	virtual void Update_Implementation(float DeltaTime) override;
+
+	/**
+	 * Age and fitness criteria of a breeding parent: at least MinBreedAge old and at least HighestFitnessFactor
+	 * of its population's best fitness. Reset reasons that block breeding are checked separately.
+	 */
+	static bool MeetsBreedThreshold(const UVehicleTrainerConfig& Config, const FPopulationIndex& Index, const FTrainingDataComponent& Data, const FFitnessComponent& FitComp, float CurrentTime);
+
+private:
+	// Eligibility tags recorded during Update and inserted in one batch at its end
+	FEcsCommandBuffer CommandBuffer;
 };
@@ -5,11 +5,21 @@
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
 #include "VehicleTrainerConfig.h"
+#include "VehicleNNInterface.h"
+#include "VehicleInputSchema.h"
 #include "VehicleNNInputSystem.generated.h"
 
 /**
  * UVehicleNNInputSystem
  * System that generates input values for the neural network of each vehicle in the population.
+ *
+ * Runs in two phases:
+ * 1) Snapshot (game thread): one pass over the vehicles copies transform, linear/angular velocity, the shared
+ *    spline projection and one IVehicleNNInterface::FillTelemetry call into an FVehicleInputState per vehicle. All
+ *    UObject and interface calls happen here.
+ * 2) Features (ParallelFor over chunks of InputChunkSize vehicles): FVehicleInputSchema::WriteInputs computes the
+ *    enabled features of each state from the snapshot and the baked track features only, writes them at their schema
+ *    offsets in the vehicle's FNNInFLoatComp buffer and normalizes the row.
  */
 UCLASS()
 class SPLINECIRCUITTRAINER_API UVehicleNNInputSystem : public UEcsSystem
@@ -23,4 +33,14 @@ public:
 
 private:
 	bool bHasLoggedInputMismatch = false;
+
+	/** Compiled UVehicleTrainerConfig::InputFeatures, recompiled when the config's schema hash changes */
+	FVehicleInputSchema Schema;
+
+	/** Vehicles per ParallelFor task; smaller populations run on the game thread */
+	static constexpr int32 InputChunkSize = 64;
+
+	// Reusable caches to avoid per-tick allocations
+	TArray<float*> InputBuffers;
+	TArray<FVehicleInputState> States;
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
+#include "VehicleShardSchedule.h"
 #include "VehicleProgressSystem.generated.h"
 
 /**
@@ -19,5 +20,9 @@ class SPLINECIRCUITTRAINER_API UVehicleProgressSystem : public UEcsSystem
 public:
 	UVehicleProgressSystem();
 
+	/** Chain this instance runs in: GA by default, Network for reactive replacement (bReactiveReplacement) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scheduling")
+	EVehicleShardChannel ShardChannel = EVehicleShardChannel::GA;
+
 	virtual void Update_Implementation(float DeltaTime) override;
 };
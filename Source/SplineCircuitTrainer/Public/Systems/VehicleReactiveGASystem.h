@@ -0,0 +1,94 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "Math/RandomStream.h"
+#include "entt/entt.hpp"
+#include "VehicleReactiveGASystem.generated.h"
+
+class FPopulationIndex;
+class UBreedFloatGenomesSystem;
+class UMutationFloatGenomeSystem;
+class UVehicleResetSystem;
+class UVehicleTrainerConfig;
+
+/**
+ * UVehicleReactiveGASystem
+ * Steady-state replacement for bReactiveReplacement: runs in the network chain right after the reset checks and
+ * replaces every newly flagged vehicle at once instead of waiting for the next GA step.
+ *
+ * Per flagged, non-elite vehicle:
+ * 1) If its fitness would enter its population's elite set, it stays flagged for the batch GA step so elite
+ *    selection can snapshot it first. The same happens when the population has no parents yet.
+ * 2) Two tournaments over the population's elites and the live vehicles that meet the breeding threshold
+ *    (UVehicleFitnessEligibilitySystem::MeetsBreedThreshold, read from the population index).
+ * 3) Breeder->BreedGenome and Mutator->MutateGenome write the child into the vehicle's genome view.
+ *    Backward-start resets skip this; the reset system re-randomizes them.
+ * 4) Resetter->ResetVehicles sends all replaced vehicles back to the start in one pass; lineage is recorded
+ *    and the reset flags are removed.
+ *
+ * Breeder, Mutator and Resetter are the GA chain's systems, wired by the trainer context; only their kernels are used.
+ */
+UCLASS()
+class SPLINECIRCUITTRAINER_API UVehicleReactiveGASystem : public UEcsSystem
+{
+	GENERATED_BODY()
+
+public:
+	UVehicleReactiveGASystem();
+
+	// Breeding settings/kernel (SBX parameters, lineage recording)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Reactive")
+	TObjectPtr<UBreedFloatGenomesSystem> Breeder;
+
+	// Mutation settings/kernel
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Reactive")
+	TObjectPtr<UMutationFloatGenomeSystem> Mutator;
+
+	// Sends replaced vehicles back to the start
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Reactive")
+	TObjectPtr<UVehicleResetSystem> Resetter;
+
+	/** Base seed from the context to avoid identical behavior in multi-context setups (0 = engine RNG) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeneticAlgorithm|Reactive")
+	int32 ContextSeed = 0;
+
+	virtual void Update_Implementation(float DeltaTime) override;
+
+private:
+	struct FCandidate
+	{
+		entt::entity Entity = entt::null;
+		float Fitness = 0.0f;
+		bool bIsElite = false;
+		TConstArrayView<float> Genome;
+	};
+
+	struct FChild
+	{
+		entt::entity Entity = entt::null;
+		entt::entity ParentA = entt::null;
+		entt::entity ParentB = entt::null;
+		int32 Population = INDEX_NONE;
+	};
+
+	/** True when Fitness would take a slot in Pop's elite set at the next elite selection. */
+	bool WouldEnterElites(const UVehicleTrainerConfig& Config, const FPopulationIndex& Index, entt::entity Entity, int32 Pop, float Fitness);
+
+	/** Fills Candidates with Pop's elites and the unflagged vehicles that meet the breeding threshold. */
+	void GatherCandidates(const UVehicleTrainerConfig& Config, const FPopulationIndex& Index, int32 Pop, float CurrentTime);
+
+	int32 RunTournament(const UVehicleTrainerConfig& Config);
+	bool IsBetter(const UVehicleTrainerConfig& Config, const FCandidate& A, const FCandidate& B) const;
+
+	FRandomStream Rng;
+	bool bRngSeeded = false;
+
+	// Reusable caches to avoid per-tick allocations
+	TArray<FCandidate> Candidates;
+	TArray<FChild> Children;
+	TArray<entt::entity> Replaced;
+	int32 CandidatePopulation = INDEX_NONE;
+};
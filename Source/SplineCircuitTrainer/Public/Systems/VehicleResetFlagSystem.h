@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
+#include "VehicleShardSchedule.h"
+#include "EcsCommandBuffer.h"
 #include "VehicleResetFlagSystem.generated.h"
 
 /**
@@ -19,5 +21,16 @@ class SPLINECIRCUITTRAINER_API UVehicleResetFlagSystem : public UEcsSystem
 public:
 	UVehicleResetFlagSystem();
 
+	/** Chain this instance runs in: GA by default, Network for reactive replacement (bReactiveReplacement) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scheduling")
+	EVehicleShardChannel ShardChannel = EVehicleShardChannel::GA;
+
 	virtual void Update_Implementation(float DeltaTime) override;
+
+private:
+	// Reusable cache to avoid per-tick allocations (debug drawing only)
+	TSet<int64> EliteSourceIds;
+
+	// Structural changes recorded during Update and applied at its end
+	FEcsCommandBuffer CommandBuffer;
 };
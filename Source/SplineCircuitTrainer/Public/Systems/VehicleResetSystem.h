@@ -4,11 +4,17 @@
 
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
+#include "PhysicsInterfaceDeclaresCore.h"
+#include "entt/entt.hpp"
 #include "VehicleResetSystem.generated.h"
 
+class APawn;
+
 /**
  * UVehicleResetSystem
  * Resets the physical state of entities flagged with FResetGenomeComponent.
+ * All vehicles reset in one update start at the cached FVehicleSpawnPoint. Their simulated bodies are teleported
+ * and stopped in one pass under a single physics scene write lock.
  */
 UCLASS()
 class SPLINECIRCUITTRAINER_API UVehicleResetSystem : public UEcsSystem
@@ -19,4 +25,19 @@ public:
 	UVehicleResetSystem();
 
 	virtual void Update_Implementation(float DeltaTime) override;
+
+	/**
+	 * Resets the given flagged vehicles (the reset flag itself is left to the caller).
+	 * Update passes every flagged vehicle; UVehicleReactiveGASystem passes the ones it just replaced.
+	 */
+	void ResetVehicles(TConstArrayView<entt::entity> Entities);
+
+private:
+	/** Moves ResetPawns to the spawn transform and zeroes their velocities. */
+	void TeleportToSpawn(const FVector& Location, const FRotator& Rotation);
+
+	// Reusable caches to avoid per-tick allocations
+	TArray<entt::entity> ResetEntities;
+	TArray<APawn*> ResetPawns;
+	TArray<FPhysicsActorHandle> ResetBodies;
 };
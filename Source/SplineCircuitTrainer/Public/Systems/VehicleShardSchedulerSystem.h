@@ -0,0 +1,39 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "VehicleShardSchedule.h"
+#include "VehicleShardSchedulerSystem.generated.h"
+
+/**
+ * UVehicleShardSchedulerSystem
+ * Head of a chain that evaluates one shard of the vehicles per firing (see FVehicleShardSchedule).
+ *
+ * Each update advances the channel's active shard and tags every vehicle outside it (FNNSkipEvaluationTag for the
+ * network channel, FGASkipEvaluationTag for the GA channel); the per-vehicle systems of that chain exclude the tag
+ * from their views. Only vehicles whose membership changed are touched, about 2N/K per update.
+ * The GA channel also writes FGAStepGate, so the population-level GA systems behind it run once per rotation.
+ * With NumShards = 1 the tags are cleared and the chain behaves as before.
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew)
+class SPLINECIRCUITTRAINER_API UVehicleShardSchedulerSystem : public UEcsSystem
+{
+	GENERATED_BODY()
+
+public:
+	UVehicleShardSchedulerSystem();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scheduling")
+	EVehicleShardChannel Channel = EVehicleShardChannel::Network;
+
+	/** Shards the vehicles are split into; the owning chain should fire NumShards times per decision period */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scheduling", meta=(ClampMin="1"))
+	int32 NumShards = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scheduling")
+	EVehicleShardPartition Partition = EVehicleShardPartition::EntityIndex;
+
+	virtual void Update_Implementation(float DeltaTime) override;
+};
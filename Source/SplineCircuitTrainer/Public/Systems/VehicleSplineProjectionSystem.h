@@ -0,0 +1,30 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EcsSystem.h"
+#include "VehicleShardSchedule.h"
+#include "VehicleSplineProjectionSystem.generated.h"
+
+/**
+ * UVehicleSplineProjectionSystem
+ * Reads every vehicle's location once and projects it on the circuit's FSplineTrackIndex, writing
+ * FSplineProjectionComponent. Placed at the head of both chains so the input, progress and reset-flag
+ * systems share one projection per vehicle per tick instead of each querying the spline.
+ * Vehicles outside the active shard of ShardChannel are skipped (see UVehicleShardSchedulerSystem).
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew)
+class SPLINECIRCUITTRAINER_API UVehicleSplineProjectionSystem : public UEcsSystem
+{
+	GENERATED_BODY()
+
+public:
+	UVehicleSplineProjectionSystem();
+
+	/** Chain this instance runs in; selects which shard tag it honours */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scheduling")
+	EVehicleShardChannel ShardChannel = EVehicleShardChannel::Network;
+
+	virtual void Update_Implementation(float DeltaTime) override;
+};
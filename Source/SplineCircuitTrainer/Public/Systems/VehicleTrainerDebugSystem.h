@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "EcsSystem.h"
+#include "Components/GenomeComponents.h"
 #include "VehicleTrainerDebugSystem.generated.h"
 
 /**
@@ -35,6 +36,6 @@ private:
 	int32 CachedEliteCount = 0;
 	TArray<float> CachedEliteFitness;
 	TArray<float> CachedBreedingPairsFitness;
-	TArray<float> CachedAllSolutionsFitness;
+	FFitnessDistributionSummary CachedAllSolutionsStats;
 	int32 CachedResetCount = 0;
 };
@@ -0,0 +1,40 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// SplineCircuitTrainer module: elite checkpoints for long unattended runs
+// Why: Headless overnight runs must survive crashes and be resumable; the elites are the whole
+// state worth keeping (the population is re-bred from them within a few GA steps).
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+
+/** One elite genome with the fitness it had when the checkpoint was taken. */
+struct FTrainerCheckpointElite
+{
+	int32 Population = INDEX_NONE;
+	float Fitness = 0.0f;
+	int64 SolutionId = 0;
+	TArray<float> Genome;
+};
+
+/**
+ * Snapshot of a context's elites (FEliteTagComponent + FEliteOwnedFloatGenome) in a small binary file.
+ * Save writes to a temporary file and renames it, so a crash mid-write keeps the previous checkpoint.
+ */
+struct SPLINECIRCUITTRAINER_API FTrainerCheckpoint
+{
+	double SimTime = 0.0;
+	TArray<FTrainerCheckpointElite> Elites;
+
+	/** Copies every elite with an owned genome out of Registry. */
+	void Capture(entt::registry& Registry, double InSimTime);
+
+	bool Save(const FString& Filename) const;
+	bool Load(const FString& Filename);
+
+	/**
+	 * Creates elite entities from the checkpoint (at most EliteCount per population, best first).
+	 * Elites whose genome is not GenomeFloatCount long (e.g. saved with another network layout) are skipped.
+	 * Restored elites get new ids with SourceId set to the checkpointed id. Returns the number created.
+	 */
+	int32 Restore(entt::registry& Registry, int32 NumPopulations, int32 EliteCount, bool bHigherIsBetter, int32 GenomeFloatCount) const;
+};
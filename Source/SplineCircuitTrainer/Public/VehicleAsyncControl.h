@@ -0,0 +1,181 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// SplineCircuitTrainer module: network inference inside the Chaos physics step
+// Why: the EvaluateNetworks chain runs on the context's timer, so control updates jitter with the game frame rate and
+// are decoupled from the physics step. In async physics control mode the input features, feedforward and (when the
+// vehicle supports it) output application run in a Chaos pre-simulate callback at a fixed rate of simulated time,
+// reading rigid body state directly. The game thread only refreshes networks and telemetry and copies results back.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Chaos/SimCallbackInput.h"
+#include "NeuralNetwork.h"
+#include "Neurons/Neuron.h"
+#include "SplineTrackIndex.h"
+#include "VehicleInputSchema.h"
+#include "entt/entt.hpp"
+#include <atomic>
+
+namespace Chaos
+{
+	class FSingleParticlePhysicsProxy;
+}
+class IVehicleNNInterface;
+class UVehicleTrainerConfig;
+
+using FVehicleControlNetwork = TNeuralNetwork<float, FNeuron>;
+
+/** Rigid body state of one vehicle as read on the physics thread. */
+struct FVehicleAsyncBodyState
+{
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Velocity = FVector::ZeroVector;
+
+	/** Radians per second, as stored on the particle */
+	FVector AngularVelocity = FVector::ZeroVector;
+};
+
+/**
+ * Everything the physics thread reads besides the vehicles. Built on the game thread when the config or the track
+ * changes and never modified afterwards; the track is a copy without spline refinement, so no UObject is touched.
+ */
+struct SPLINECIRCUITTRAINER_API FVehicleAsyncControlShared
+{
+	FVehicleAsyncControlShared() = default;
+	UE_NONCOPYABLE(FVehicleAsyncControlShared);
+
+	/** Hash of every config value the shared data is built from; a different hash means it must be rebuilt. */
+	static uint32 HashConfig(const UVehicleTrainerConfig& Config);
+
+	/**
+	 * Builds one vehicle's input state from its rigid body, projects it on Track and writes the schema inputs to
+	 * OutInputs (Schema.Num() values; recurrent inputs are left untouched). The projection searches near
+	 * InOutDistance when bInOutHasDistance is set; both are updated with the new track distance.
+	 */
+	void WriteAgentInputs(const FVehicleAsyncBodyState& Body, const FVehicleTelemetry& Telemetry, float& InOutDistance, bool& bInOutHasDistance, float* OutInputs) const;
+
+	FSplineTrackIndex Track;
+	FVehicleInputSchema Schema;
+	TArray<float> FutureDistances;
+
+	/** Points at Track and FutureDistances above */
+	FVehicleInputContext InputContext;
+
+	int32 RecurrentInputCount = 0;
+
+	/** Network outputs per vehicle (control outputs + recurrent outputs) */
+	int32 NetworkOutputCount = 0;
+
+	/** Outputs passed to the vehicle */
+	int32 ControlOutputCount = 0;
+
+	/** Simulated seconds between two decisions */
+	float ControlPeriod = 1.0f / 30.0f;
+};
+
+/**
+ * One vehicle handed to the physics thread. Proxy and Control are raw pointers into game-thread objects: they are
+ * only dereferenced while Alive is set, which the game thread clears when the pawn or the entity goes away.
+ */
+struct FVehicleAsyncAgentInput
+{
+	entt::entity Entity = entt::null;
+	Chaos::FSingleParticlePhysicsProxy* Proxy = nullptr;
+
+	/** Shared with the vehicle's FVehicleAsyncControlComponent */
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> Alive;
+
+	/** Receives ApplyNNOutputs_Internal; outputs it declines are applied on the game thread */
+	IVehicleNNInterface* Control = nullptr;
+
+	/** Physics-thread copy of the vehicle's network, replaced (never modified) when the vehicle starts a new life */
+	TSharedPtr<FVehicleControlNetwork, ESPMode::ThreadSafe> Network;
+
+	/** Wheel/engine state from the game thread: not part of the rigid body */
+	FVehicleTelemetry Telemetry;
+};
+
+/** Game thread -> physics thread: the current vehicle list. Each input replaces the previous one. */
+struct FVehicleAsyncControlInput : public Chaos::FSimCallbackInput
+{
+	TSharedPtr<const FVehicleAsyncControlShared, ESPMode::ThreadSafe> Shared;
+	TArray<FVehicleAsyncAgentInput> Agents;
+
+	void Reset()
+	{
+		Shared.Reset();
+		Agents.Reset();
+	}
+};
+
+/** Physics thread -> game thread: the outputs of one decision step. */
+struct FVehicleAsyncControlOutput : public Chaos::FSimCallbackOutput
+{
+	TArray<entt::entity> Entities;
+
+	/** NetworkOutputCount values per entry of Entities */
+	TArray<float> Outputs;
+
+	/** Per entry: 1 when the vehicle took the outputs on the physics thread */
+	TArray<uint8> AppliedInternal;
+
+	int32 OutputStride = 0;
+
+	void Reset()
+	{
+		Entities.Reset();
+		Outputs.Reset();
+		AppliedInternal.Reset();
+		OutputStride = 0;
+	}
+};
+
+/**
+ * Chaos pre-simulate callback of async physics control. Every ControlPeriod of simulated time it reads each agent's
+ * rigid body (position, rotation, linear and angular velocity), projects it on the track copy and writes the inputs
+ * with FVehicleAsyncControlShared::WriteAgentInputs, runs the network and offers the outputs to ApplyNNOutputs_Internal.
+ * Registered by UVehicleAsyncControlSystem.
+ */
+class SPLINECIRCUITTRAINER_API FVehicleAsyncControlCallback : public Chaos::TSimCallbackObject<FVehicleAsyncControlInput, FVehicleAsyncControlOutput>
+{
+public:
+	virtual FName GetFNameForStatId() const override;
+
+private:
+	virtual void OnPreSimulate_Internal() override;
+
+	/** Adopts a new vehicle list, keeping each vehicle's last track distance as the projection warm start. */
+	void AdoptInput(const FVehicleAsyncControlInput& Input);
+
+	static bool IsAlive(const FVehicleAsyncAgentInput& Agent);
+
+	struct FAgent
+	{
+		FVehicleAsyncAgentInput Input;
+		float Distance = 0.0f;
+		bool bHasDistance = false;
+	};
+
+	// Physics-thread state
+	TSharedPtr<const FVehicleAsyncControlShared, ESPMode::ThreadSafe> Shared;
+	TArray<FAgent> Agents;
+	float TimeToNextDecision = 0.0f;
+
+	// Reusable caches to avoid per-tick allocations
+	TArray<FAgent> PreviousAgents;
+	TArray<float> InputScratch;
+	TArray<float> OutputScratch;
+};
+
+/** Game-thread state of an async-controlled vehicle (UVehicleAsyncControlSystem). */
+struct FVehicleAsyncControlComponent
+{
+	TSharedPtr<FVehicleControlNetwork, ESPMode::ThreadSafe> Network;
+
+	/** FUniqueSolutionComponent::Id the network was copied for; a reset assigns a new id */
+	int64 SolutionId = INDEX_NONE;
+
+	/** Cleared when this component is destroyed (entity destroyed or pawn destroyed); agents already queued to the physics thread then skip the vehicle */
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> Alive;
+};
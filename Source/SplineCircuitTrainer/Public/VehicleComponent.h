@@ -6,16 +6,28 @@
 #include "VehicleComponent.generated.h"
 
 class APawn;
+class IVehicleNNInterface;
 
 /**
  * FVehicleComponent
- * Holds a reference to the pawn associated with an ECS entity.
+ * Holds a reference to the pawn associated with an ECS entity, and its IVehicleNNInterface resolved once
+ * (at spawn, or on first use after VehiclePawn changes) instead of a Cast every tick.
  */
 USTRUCT(BlueprintType)
 struct SPLINECIRCUITTRAINER_API FVehicleComponent
 {
 	GENERATED_BODY()
 
+	FVehicleComponent() = default;
+	FVehicleComponent(APawn* InPawn);
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle")
 	TObjectPtr<APawn> VehiclePawn;
+
+	/** VehiclePawn's NN interface, or nullptr when the pawn does not implement it natively. */
+	IVehicleNNInterface* GetNNInterface();
+
+private:
+	IVehicleNNInterface* NNInterface = nullptr;
+	const APawn* NNInterfacePawn = nullptr;
 };
@@ -0,0 +1,163 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// SplineCircuitTrainer module: declarative layout of the vehicle NN inputs
+// Why: the input layout used to be hand-indexed in UVehicleNNInputSystem and counted again in
+// UVehicleTrainerConfig::GetTotalInputCount, so changing the feature set meant editing both in lockstep.
+// The config now lists the features; FVehicleInputSchema compiles that list once into offsets and per-input
+// scale/clamp tables, which both the input system and the network size read.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VehicleNNInterface.h"
+#include "VehicleInputSchema.generated.h"
+
+class UVehicleTrainerConfig;
+class USplineComponent;
+struct FSplineTrackIndex;
+
+/** What a vehicle input feature measures. Multi-value sources write several consecutive inputs. */
+UENUM(BlueprintType)
+enum class EVehicleInputSource : uint8
+{
+	SignedDistance UMETA(DisplayName = "Signed Distance To Spline"),
+	CurrentOrientation UMETA(DisplayName = "Current Orientation"),
+	FutureOrientations UMETA(DisplayName = "Future Orientations (one per FutureDotProductDistances)"),
+	HeightAboveSpline UMETA(DisplayName = "Height Above Spline"),
+	CurvatureAhead UMETA(DisplayName = "Curvature Ahead"),
+	CurvatureDirection UMETA(DisplayName = "Curvature Direction"),
+	SplineProgress UMETA(DisplayName = "Spline Progress"),
+	ForwardVelocity UMETA(DisplayName = "Forward Velocity Along Spline"),
+	VelocityMagnitude UMETA(DisplayName = "Velocity Magnitude"),
+	Pitch UMETA(DisplayName = "Pitch"),
+	Roll UMETA(DisplayName = "Roll"),
+	LateralVelocity UMETA(DisplayName = "Lateral Velocity"),
+	VerticalVelocity UMETA(DisplayName = "Vertical Velocity"),
+	AngularVelocity UMETA(DisplayName = "Angular Velocity (pitch, yaw, roll rates)"),
+	WheelsOnGround UMETA(DisplayName = "Wheels On Ground Ratio"),
+	WheelContacts UMETA(DisplayName = "Wheel Contacts (per wheel)"),
+	WheelCompressions UMETA(DisplayName = "Wheel Suspension Compression (per wheel)"),
+	EngineRPM UMETA(DisplayName = "Engine RPM"),
+	Gear UMETA(DisplayName = "Gear"),
+	Count UMETA(Hidden)
+};
+
+/** One entry of UVehicleTrainerConfig::InputFeatures. */
+USTRUCT(BlueprintType)
+struct SPLINECIRCUITTRAINER_API FVehicleInputFeature
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Feature")
+	EVehicleInputSource Source = EVehicleInputSource::SignedDistance;
+
+	/** Disabled features take no input slot and are not computed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Feature")
+	bool bEnabled = true;
+
+	/** Use Scale/ClampMin/ClampMax instead of the source's default normalization (the config's Max* values) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Feature")
+	bool bOverrideNormalization = false;
+
+	/** Multiplier applied to the raw value (raw units: cm, cm/s, rad, deg/s, or already unitless) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Feature", meta = (EditCondition = "bOverrideNormalization"))
+	float Scale = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Feature", meta = (EditCondition = "bOverrideNormalization"))
+	float ClampMin = -1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input Feature", meta = (EditCondition = "bOverrideNormalization"))
+	float ClampMax = 1.0f;
+
+	FVehicleInputFeature() = default;
+	FVehicleInputFeature(EVehicleInputSource InSource) : Source(InSource) {}
+};
+
+/** State one vehicle's inputs are computed from: pawn snapshot, spline projection and telemetry. Vectors are world space. */
+struct FVehicleInputState
+{
+	FVector Location = FVector::ZeroVector;
+	FVector Forward = FVector::ForwardVector;
+	FVector Velocity = FVector::ZeroVector;
+
+	/** Pitch, yaw and roll rates (deg/s) */
+	FVector AngularVelocity = FVector::ZeroVector;
+
+	/** Radians */
+	float Pitch = 0.0f;
+	float Roll = 0.0f;
+
+	FVector ClosestPoint = FVector::ZeroVector;
+	FVector Tangent = FVector::ForwardVector;
+	float Distance = 0.0f;
+
+	FVehicleTelemetry Telemetry;
+};
+
+/** Read-only state shared by every vehicle of one input pass. Touches no UObject once built. */
+struct SPLINECIRCUITTRAINER_API FVehicleInputContext
+{
+	/** Fills the fields from the config, the built track index and the circuit spline. */
+	void Init(const UVehicleTrainerConfig& Config, const FSplineTrackIndex& InTrack, const USplineComponent& Spline);
+
+	const FSplineTrackIndex* Track = nullptr;
+	const TArray<float>* FutureDistances = nullptr;
+	FVector SplineUpVector = FVector::UpVector;
+	float SplineLength = 0.0f;
+	float InvSplineLength = 0.0f;
+	float LookaheadDistance = 0.0f;
+};
+
+/**
+ * Compiled form of the config's input feature list.
+ * Offsets[Source] is the first input index of an enabled source (INDEX_NONE when disabled or absent); Scales,
+ * ClampMins and ClampMaxs hold one entry per input. A source listed twice keeps its first entry
+ * (UVehicleTrainerConfig warns about duplicates when the list is edited).
+ *
+ * Producers write raw values at the offsets, then Normalize() applies scale and clamp to the whole
+ * row in one 4-wide SIMD pass.
+ */
+struct SPLINECIRCUITTRAINER_API FVehicleInputSchema
+{
+	FVehicleInputSchema() { FMemory::Memset(Offsets, 0xFF, sizeof(Offsets)); } // INDEX_NONE
+
+	/** The historical 28-input layout, in order */
+	static TArray<FVehicleInputFeature> MakeDefaultFeatures();
+
+	/** Inputs written by a source (future orientations and per-wheel sources are multi-valued). */
+	static int32 GetSourceWidth(EVehicleInputSource Source, const UVehicleTrainerConfig& Config);
+
+	/** Builds the offsets and tables and records the config's hash in CompiledHash. */
+	void Compile(const UVehicleTrainerConfig& Config);
+
+	/** Hash of every config value Compile reads; the schema is stale when it differs from CompiledHash. */
+	static uint32 HashConfig(const UVehicleTrainerConfig& Config);
+
+	/** Number of schema inputs the config compiles to, without building the tables. */
+	static int32 CountInputs(const UVehicleTrainerConfig& Config);
+
+	/** Warns about every source listed more than once (the schema keeps the first). Returns true when there are none. */
+	static bool ValidateFeatures(const UVehicleTrainerConfig& Config);
+
+	/** Number of schema inputs (recurrent inputs excluded) */
+	int32 Num() const { return Scales.Num(); }
+
+	bool Uses(EVehicleInputSource Source) const { return Offsets[static_cast<int32>(Source)] != INDEX_NONE; }
+
+	int32 GetOffset(EVehicleInputSource Source) const { return Offsets[static_cast<int32>(Source)]; }
+
+	/** In place: Values[i] = Clamp(Values[i] * Scales[i], ClampMins[i], ClampMaxs[i]) for the Num() schema inputs. */
+	void Normalize(float* Values) const;
+
+	/**
+	 * Writes the enabled features of State at their offsets and normalizes them: the Num() schema inputs of Values.
+	 * Pure math over State and the baked track features, safe off the game thread.
+	 */
+	void WriteInputs(const FVehicleInputState& State, const FVehicleInputContext& Context, float* Values) const;
+
+	int32 Offsets[static_cast<int32>(EVehicleInputSource::Count)];
+	TArray<float> Scales;
+	TArray<float> ClampMins;
+	TArray<float> ClampMaxs;
+
+	/** HashConfig of the config last compiled (0 before the first Compile) */
+	uint32 CompiledHash = 0;
+};
@@ -4,8 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "entt/entt.hpp"
 #include "VehicleLibrary.generated.h"
 
+struct FSplineTrackIndex;
+struct FSplineProjectionComponent;
+struct FTrainingDataComponent;
+
 /**
  * Utility library for vehicle-related functions.
  */
@@ -44,4 +49,16 @@ public:
 	 * Sets up training data for a vehicle.
 	 */
 	static void SetTrainingData(FTrainingDataComponent& OutTrainingData, const USplineComponent* Spline, const FVector& Location, float CreationTime);
+
+	/**
+	 * Projects a vehicle location on the baked track into InOutProjection, warm-started from its previous
+	 * projection (or the training data's last distance) and stamped with the current frame.
+	 */
+	static void ProjectOnTrack(const FSplineTrackIndex& Track, const FVector& VehicleLocation, const FTrainingDataComponent* TrainingData, FSplineProjectionComponent& InOutProjection);
+
+	/**
+	 * This frame's projection of a vehicle: the FSplineProjectionComponent written by UVehicleSplineProjectionSystem
+	 * when it is current, otherwise a fresh projection computed into Scratch (systems run on their own).
+	 */
+	static const FSplineProjectionComponent& GetFrameProjection(entt::registry& Registry, entt::entity Entity, const FSplineTrackIndex& Track, const APawn* Pawn, FSplineProjectionComponent& Scratch);
 };
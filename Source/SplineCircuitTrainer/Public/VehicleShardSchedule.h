@@ -0,0 +1,67 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// SplineCircuitTrainer module: staggered evaluation of vehicles across chain ticks
+// Why: both chains used to process every vehicle whenever they fired (networks every 0.1 s, GA every 0.5 s),
+// so the cost landed in a few frames and the rest idled. With K shards a chain fires K times as often and
+// each firing handles one shard: every vehicle keeps its decision period and the per-frame cost stays flat.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+#include "VehicleShardSchedule.generated.h"
+
+/** Which chain a shard schedule drives. */
+UENUM(BlueprintType)
+enum class EVehicleShardChannel : uint8
+{
+	/** EvaluateNetworks: projection, inputs, feedforward, outputs */
+	Network UMETA(DisplayName = "Network Evaluation"),
+	/** GAEvaluationEvent: projection, progress, reset flags, fitness */
+	GA UMETA(DisplayName = "GA Evaluation"),
+	Count UMETA(Hidden)
+};
+
+/** How vehicles are assigned to shards. */
+UENUM(BlueprintType)
+enum class EVehicleShardPartition : uint8
+{
+	/** Entity index modulo the shard count: shards are interleaved across populations */
+	EntityIndex UMETA(DisplayName = "Entity Index"),
+	/** Population (FFitnessComponent::BuiltForFitnessIndex) modulo the shard count: whole populations per shard */
+	Population UMETA(DisplayName = "Population")
+};
+
+/** Tag: vehicle is outside the GA chain's active shard this tick (network shards use FNNSkipEvaluationTag). */
+struct FGASkipEvaluationTag {};
+
+/**
+ * Per-channel shard state in the registry context; written by UVehicleShardSchedulerSystem at the head of each chain.
+ * Use FVehicleShardSchedule::Get(Registry).
+ */
+struct SPLINECIRCUITTRAINER_API FVehicleShardSchedule
+{
+	struct FChannel
+	{
+		int32 NumShards = 1;
+		int32 ActiveShard = 0;
+
+		/** Time since each shard was last active; the active shard's entry is its vehicles' DeltaTime */
+		TArray<float> Elapsed;
+	};
+
+	/** Returns the registry's schedule, creating an unsharded one on first use. */
+	static FVehicleShardSchedule& Get(entt::registry& Registry);
+
+	/**
+	 * Time since the active shard's vehicles were last processed on this channel, for per-vehicle integration
+	 * (the chain's own DeltaTime is 1/K of that). Returns ChainDeltaTime when the channel is not sharded.
+	 */
+	static float GetVehicleDeltaTime(entt::registry& Registry, EVehicleShardChannel Channel, float ChainDeltaTime);
+
+	/**
+	 * True on the firing whose active shard wrapped back to 0: every shard has been evaluated once since the previous
+	 * such firing, so population-level steps gated on it run once per decision period. Always true when unsharded.
+	 */
+	static bool IsRotationComplete(const entt::registry& Registry, EVehicleShardChannel Channel);
+
+	FChannel Channels[static_cast<int32>(EVehicleShardChannel::Count)];
+};
@@ -0,0 +1,50 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+// SplineCircuitTrainer module: cached start transform of the circuit
+// Why: every spawn and reset evaluated the spline for the same start transform and then searched it for the
+// closest key and distance of that point. The start only changes with the spline or the spawn settings, so it is
+// computed once and reused by the factory and the reset system.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "entt/entt.hpp"
+
+class USplineComponent;
+struct FTrainingDataComponent;
+
+/**
+ * Where vehicles start: the spawn transform at SpawnParametricDistance (raised by SpawnVerticalOffset) and its
+ * position on the spline. Lives in the registry context; use FVehicleSpawnPoint::Get(Registry) and EnsureBuilt().
+ */
+struct SPLINECIRCUITTRAINER_API FVehicleSpawnPoint
+{
+	/** Returns the registry's spawn point, creating an empty one on first use. */
+	static FVehicleSpawnPoint& Get(entt::registry& Registry);
+
+	/**
+	 * (Re)computes the spawn point when the spline, its geometry (FSplineTrackIndex::HashSpline) or the spawn settings
+	 * changed.
+	 * Returns false without a spline.
+	 */
+	bool EnsureBuilt(const USplineComponent* Spline, float SpawnDistance, float VerticalOffset);
+
+	/** Training data of a vehicle starting a new life here (UVehicleLibrary::SetTrainingData without spline queries). */
+	void InitTrainingData(FTrainingDataComponent& OutTrainingData, float CreationTime) const;
+
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** Distance along the spline of the point closest to Location */
+	float SplineDistance = 0.0f;
+
+	/** Spline segment of the point closest to Location */
+	int32 SplineSegment = 0;
+
+	/** Number of spline segments (N for a closed spline with N points, N-1 for an open one) */
+	int32 NumSegments = 0;
+
+private:
+	TWeakObjectPtr<const USplineComponent> SourceSpline;
+	uint32 SourceHash = 0;
+	float SourceSpawnDistance = 0.0f;
+	float SourceVerticalOffset = 0.0f;
+};
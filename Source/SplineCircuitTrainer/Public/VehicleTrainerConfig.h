@@ -5,6 +5,10 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "NeuralNetwork.h"
+#include "Systems/TournamentSelectionSystem.h"
+#include "KinematicVehicleModel.h"
+#include "VehicleInputSchema.h"
+#include "VehicleShardSchedule.h"
 #include "VehicleTrainerConfig.generated.h"
 
 USTRUCT(BlueprintType)
@@ -40,6 +44,70 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer")
 	float SpawnParametricDistance = 200.0f;
 
+	/** Pawns spawned per frame from BeginPlay on; vehicles join training as they spawn. 0 spawns every pawn in BeginPlay */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer", meta=(ClampMin="0"))
+	int32 SpawnBudgetPerFrame = 16;
+
+	/** Spawn an AAIController to possess each vehicle pawn; pawns driven only through IVehicleNNInterface do not need one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer")
+	bool bSpawnAIControllers = true;
+
+	/** Arc-length spacing (cm) of the baked track index used for all closest-point queries on the circuit spline */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer", meta=(ClampMin="1.0", Units="cm"))
+	float TrackSampleSpacing = 50.0f;
+
+	/** Surrogate dynamics used when VehiclePawnClass is an AKinematicVehiclePawn (ignored for physics pawns) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Kinematic Vehicle")
+	FKinematicVehicleParams KinematicVehicleParams;
+
+	/**
+	 * Shards the network evaluation chain is split into: it fires this many times per decision period (0.1 s) and
+	 * each firing evaluates one shard, flattening the frame-time spike of evaluating every car at once.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling", meta=(ClampMin="1"))
+	int32 NetworkEvaluationShards = 1;
+
+	/** Same for the GA chain (0.5 s period): progress, reset flags and fitness run for one shard per firing */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling", meta=(ClampMin="1"))
+	int32 GAEvaluationShards = 1;
+
+	/** How vehicles are assigned to shards (both chains) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling")
+	EVehicleShardPartition ShardPartition = EVehicleShardPartition::EntityIndex;
+
+	/**
+	 * Adaptive decision rate: a vehicle re-runs its network at most this often (seconds) and keeps applying its last
+	 * outputs in between, unless a key input below moves past its threshold first. 0 evaluates every firing.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling", meta=(ClampMin="0.0", Units = "s"))
+	float DecisionHoldMaxSec = 0.0f;
+
+	/** Change of curvature ahead (1 - tangent dot over CurvatureLookaheadDistance) that forces an early decision */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling", meta=(ClampMin="0.0"))
+	float DecisionHoldCurvatureThreshold = 0.02f;
+
+	/** Change of lateral offset from the spline (cm) that forces an early decision */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling", meta=(ClampMin="0.0"))
+	float DecisionHoldLateralOffsetCM = 50.0f;
+
+	/** Change of speed (cm/s) that forces an early decision */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling", meta=(ClampMin="0.0"))
+	float DecisionHoldSpeedCMS = 200.0f;
+
+	/**
+	 * Runs input features, feedforward and (where the vehicle implements ApplyNNOutputs_Internal) output application
+	 * for physics-simulated vehicles in a Chaos pre-simulate callback at AsyncControlHz of simulated time, instead of
+	 * on the EvaluateNetworks chain. Decisions follow simulated time with "Tick Physics Async" enabled in the project
+	 * settings, but the run is not deterministic: the vehicle list, network copies and wheel/engine telemetry are
+	 * pushed from the game thread on the network timer, so which physics step first sees them depends on frame timing.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling")
+	bool bAsyncPhysicsControl = false;
+
+	/** Control decisions per simulated second in async physics control mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer|Scheduling", meta=(ClampMin="1.0", EditCondition="bAsyncPhysicsControl"))
+	float AsyncControlHz = 30.0f;
+
 	//Number solutions in a population (ie solutions that can breed with each other)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer")
 	int32 Population = 10;
@@ -49,7 +117,14 @@ public:
 	int32 NumPopulations = 1;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Neural Network|Structure")
-	TArray<int32> HiddenLayerSizes = { 32, 24, 16 }; // Wider network for 28 base inputs + recurrent
+	TArray<int32> HiddenLayerSizes = { 32, 24, 16 }; // Wider network for the 28 default inputs + recurrent
+
+	/**
+	 * Network inputs, in input-layer order. Disabling or removing a feature shrinks the input layer and skips its
+	 * computation; by default each feature is normalized with the Max* values below (see FVehicleInputFeature).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Neural Network|Inputs")
+	TArray<FVehicleInputFeature> InputFeatures = FVehicleInputSchema::MakeDefaultFeatures();
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Neural Network|Inputs")
 	float MaxDistanceNormalization = 500.0f;
@@ -107,6 +182,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Selection")
 	int32 EliteCount = 2;
 
+	/** How parents are drawn: tournament, or rank/fitness-proportional sampling via per-population alias tables */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Selection")
+	EParentSelectionMode SelectionMode = EParentSelectionMode::Tournament;
+
+	/** LinearRank only: expected offspring of the best candidate (1.0 = uniform, 2.0 = worst never picked) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Selection", meta=(ClampMin="1.0", ClampMax="2.0"))
+	float LinearRankPressure = 1.5f;
+
+	/** ExponentialRank only: weight ratio between consecutive ranks (closer to 0 = greedier) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Selection", meta=(ClampMin="0.01", ClampMax="1.0"))
+	float ExponentialRankBase = 0.9f;
+
+	/** FitnessProportional only: weight added after shifting fitness by the population's worst, so the worst keeps a small chance */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Selection", meta=(ClampMin="0.0"))
+	float ProportionalWeightFloor = 0.01f;
+
 	/** Number of random candidates sampled per tournament when selecting parents for breeding */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Selection", meta=(ClampMin="2"))
 	int32 TournamentSize = 5;
@@ -127,6 +218,44 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Selection", meta=(ClampMin="0.0", ClampMax="1.0"))
 	float CrossGroupParentChance = 0.1f;
 
+	// ----- Island model -----
+
+	/** Run selection, breeding and mutation per population in parallel (island model) instead of serially. Cross-group parents then come only from migration. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Island")
+	bool bUseIslandModel = false;
+
+	/** GA steps between migrations from each population to the next one (0 = isolated islands) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Island", meta=(ClampMin="0"))
+	int32 IslandMigrationInterval = 5;
+
+	/** Best genomes each population sends per migration */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Island", meta=(ClampMin="0"))
+	int32 IslandMigrantsPerIsland = 1;
+
+	// ----- Reactive replacement -----
+
+	/**
+	 * Steady-state GA: reset checks run with the network chain and a flagged vehicle is immediately replaced by a
+	 * tournament-bred, mutated child and sent back to the start. Vehicles whose final fitness would enter the elite
+	 * set, or that have no parents to breed from yet, are left to the batch GA step.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Reactive")
+	bool bReactiveReplacement = false;
+
+	// ----- Training farm -----
+
+	/** Farm workers only: seconds between elite exchanges with the other worker processes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Farm", meta=(ClampMin="0.0"))
+	float FarmExchangeInterval = 5.0f;
+
+	/** Farm workers only: best elites per population published per exchange */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Farm", meta=(ClampMin="0"))
+	int32 FarmElitesPerPopulation = 1;
+
+	/** Farm workers only: maximum migrants read (and possibly injected as elites) per exchange */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Farm", meta=(ClampMin="0"))
+	int32 FarmMaxMigrantsPerExchange = 16;
+
 	// ----- Mutation -----
 
 	/** Per-gene multiplicative noise magnitude: each weight is perturbed by ± this percentage */
@@ -183,7 +312,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Reset Logic")
 	float NoProgressTimeout = 2.0f;
 
-	/** Minimum progress in centimeters required between evaluations to avoid reset */
+	/**
+	 * Minimum progress in centimeters required per GA period (0.5 s) to avoid reset. Evaluations at another rate
+	 * (reactive replacement runs the check on every network firing) scale it, so it acts as a minimum speed.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Reset Logic")
 	float MinimumProgressBetweenEvaluations = 10.0f;
 
@@ -219,6 +351,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Neural Network")
 	int32 GetTotalOutputCount() const;
 
+	/** Weights and biases of the network described by GetNNLayerDescriptors(), i.e. the float genome length */
+	UFUNCTION(BlueprintCallable, Category = "Neural Network")
+	int32 GetGenomeFloatCount() const;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
 	bool bDebugInfo = false;
 
@@ -228,6 +364,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
 	float DebugLogFrequency = 1.0f;
 
+	/** Record every birth (ids, parents, generation, birth fitness) in the lineage arena. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+	bool bRecordLineage = true;
+
+	/** Base name of the lineage spill file under Saved/ (suffixed per context). Empty keeps only the newest LineageMaxResidentRecords rows in memory. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+	FString LineageSpillFile;
+
+	/** Lineage rows kept in memory before spilling to LineageSpillFile (or discarding the oldest without one). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug", meta=(ClampMin="1"))
+	int32 LineageMaxResidentRecords = 1 << 20;
+
 	/** Global toggle for the nuke system. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Genetic Algorithm|Nuke")
 	bool bEnableNuke = true;
@@ -246,4 +394,8 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Genetic Algorithm")
 	TArray<FName> GetResetReasonOptions() const;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
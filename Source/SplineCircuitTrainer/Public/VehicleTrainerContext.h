@@ -21,6 +21,10 @@ class SPLINECIRCUITTRAINER_API AVehicleTrainerContext : public AEcsContext
 public:
 	AVehicleTrainerContext();
 
+	// Decision period of each vehicle per chain; a sharded chain fires NumShards times per period
+	static constexpr float NetworkDecisionPeriodSec = 0.1f;
+	static constexpr float GADecisionPeriodSec = 0.5f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trainer")
 	TObjectPtr<UVehicleTrainerConfig> TrainerConfig;
 
@@ -65,5 +69,8 @@ protected:
 private:
 	void OnEvaluateNetworks();
 
+	/** Keeps either the island GA system or the serial selection/breed/mutate systems in the GA chain, and runs the reset checks in the GA chain or (bReactiveReplacement) the network chain. */
+	void ConfigureGAPipeline();
+
 	FTimerHandle NetworkUpdateTimerHandle;
 };
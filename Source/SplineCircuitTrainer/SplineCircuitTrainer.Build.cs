@@ -23,7 +23,9 @@ public class SplineCircuitTrainer : ModuleRules
             "SlateIM",
             "Slate",
             "SlateCore",
-            "AppFramework"
+            "AppFramework",
+            "Chaos",
+            "PhysicsCore"
         });
 
         PrivateDependencyModuleNames.AddRange(new string[]
@@ -6,7 +6,7 @@
 #include "Engine/World.h"
 #include "Components/GenomeComponents.h"
 #include "Components/EliteComponents.h"
-#include "Components/BreedingPairComponent.h"
+#include "BreedingPlan.h"
 #include "Systems/GADebugDataSystem.h"
 
 TEST_CLASS(GeneticAlgorithm_Debug_Tests, "GeneticAlgorithm.Debug")
@@ -62,11 +62,7 @@ TEST_CLASS(GeneticAlgorithm_Debug_Tests, "GeneticAlgorithm.Debug")
 		FFitnessComponent FitB; FitB.Fitness.Add(60.0f);
 		Registry.emplace<FFitnessComponent>(ParentB, FitB);
 
-		auto PairEntity = Registry.create();
-		FBreedingPairComponent Pair;
-		Pair.ParentA = (uint32)ParentA;
-		Pair.ParentB = (uint32)ParentB;
-		Registry.emplace<FBreedingPairComponent>(PairEntity, Pair);
+		FBreedingPlan::Get(Registry).Add(entt::null, ParentA, ParentB);
 
 		// 4. Run system multiple times to check history
 		UGADebugDataSystem* DebugSystem = NewObject<UGADebugDataSystem>();
@@ -94,4 +90,43 @@ TEST_CLASS(GeneticAlgorithm_Debug_Tests, "GeneticAlgorithm.Debug")
 		DebugSystem->Update_Implementation(1.0f);
 		ASSERT_THAT(AreEqual(2, DebugComp.HistoricalTotalEliteFitness.Num(), "History Total should have 2 entries after another 1s"));
 	}
+
+	TEST_METHOD(Histogram_Adds_Up_To_Count_And_Stale_Populations_Are_Pruned)
+	{
+		auto& Registry = Context->GetRegistry();
+		const entt::entity DebugEntity = Registry.create();
+		FGeneticAlgorithmDebugComponent& Seeded = Registry.emplace<FGeneticAlgorithmDebugComponent>(DebugEntity);
+		Seeded.PopulationStats.Add(5);
+
+		// Uneven values, so per-bin rounding of CDF differences would not add up
+		constexpr int32 NumSolutions = 37;
+		for (int32 i = 0; i < NumSolutions; ++i)
+		{
+			FFitnessComponent Fit;
+			Fit.Fitness.Add(static_cast<float>((i * i) % 13) + 0.1f * i);
+			Fit.BuiltForFitnessIndex = 0;
+			Registry.emplace<FFitnessComponent>(Registry.create(), Fit);
+		}
+
+		UGADebugDataSystem* DebugSystem = NewObject<UGADebugDataSystem>();
+		DebugSystem->NumHistogramBins = 7;
+		DebugSystem->Initialize_Implementation(Context);
+		DebugSystem->Update_Implementation(0.1f);
+
+		const auto& DebugComp = Registry.get<FGeneticAlgorithmDebugComponent>(DebugEntity);
+		ASSERT_THAT(IsFalse(DebugComp.PopulationStats.Contains(5), "Populations the index does not know must not keep a summary"));
+		ASSERT_THAT(IsTrue(DebugComp.PopulationStats.Contains(0)));
+
+		for (const FFitnessDistributionSummary* Summary : { &DebugComp.PopulationStats[0], &DebugComp.AllSolutionsStats })
+		{
+			ASSERT_THAT(AreEqual(NumSolutions, Summary->Count));
+			int32 Binned = 0;
+			for (const int32 BinCount : Summary->Histogram)
+			{
+				ASSERT_THAT(IsTrue(BinCount >= 0));
+				Binned += BinCount;
+			}
+			ASSERT_THAT(AreEqual(Summary->Count, Binned, "Histogram bins should add up to Count"));
+		}
+	}
 };
@@ -0,0 +1,141 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "KinematicVehicleModel.h"
+#include "Components/KinematicVehicleComponent.h"
+
+TEST_CLASS(SplineCircuitTrainer_KinematicVehicle_Tests, "SplineCircuitTrainer.KinematicVehicle")
+{
+	static void Run(FKinematicVehicleBatch& Batch, const FKinematicVehicleParams& Params, float Seconds)
+	{
+		constexpr float Step = 1.0f / 120.0f;
+		for (float T = 0.0f; T < Seconds; T += Step)
+		{
+			Batch.Step(Params, Step);
+		}
+	}
+
+	TEST_METHOD(Throttle_Accelerates_Forward_And_Upshifts)
+	{
+		FKinematicVehicleParams Params;
+		FKinematicVehicleBatch Batch;
+		const int32 Slot = Batch.Add(FVector::ZeroVector, 0.0f);
+		Batch.ThrottleInput[Slot] = 1.0f;
+
+		Run(Batch, Params, 8.0f);
+
+		ASSERT_THAT(IsTrue(Batch.ForwardSpeed[Slot] > 15.0f, TEXT("Full throttle should reach highway speed within 8s")));
+		ASSERT_THAT(IsTrue(Batch.Gear[Slot] >= 1.0f, TEXT("Gearbox should have upshifted")));
+		ASSERT_THAT(IsTrue(Batch.GetLocationCm(Slot).X > 1000.0f));
+		ASSERT_THAT(IsNear(0.0f, Batch.GetLocationCm(Slot).Y, 1.0f));
+		ASSERT_THAT(IsTrue(Batch.EngineRPM[Slot] <= Params.RedlineRPM));
+	}
+
+	TEST_METHOD(Positive_Steering_Turns_Right)
+	{
+		FKinematicVehicleParams Params;
+		FKinematicVehicleBatch Batch;
+		const int32 Slot = Batch.Add(FVector::ZeroVector, 0.0f);
+		Batch.ThrottleInput[Slot] = 0.5f;
+		Batch.SteerInput[Slot] = 0.5f;
+
+		Run(Batch, Params, 3.0f);
+
+		ASSERT_THAT(IsTrue(Batch.Yaw[Slot] > 0.0f, TEXT("Yaw should increase towards +Y (Unreal right turn)")));
+		ASSERT_THAT(IsTrue(Batch.YawRate[Slot] > 0.0f));
+		ASSERT_THAT(IsTrue(Batch.GetLocationCm(Slot).Y > 0.0f));
+	}
+
+	TEST_METHOD(Brake_Stops_Without_Reversing)
+	{
+		FKinematicVehicleParams Params;
+		FKinematicVehicleBatch Batch;
+		const int32 Slot = Batch.Add(FVector::ZeroVector, 0.0f);
+		Batch.ThrottleInput[Slot] = 1.0f;
+		Run(Batch, Params, 4.0f);
+		const float CruiseSpeed = Batch.ForwardSpeed[Slot];
+
+		Batch.ThrottleInput[Slot] = -1.0f;
+		Run(Batch, Params, 1.0f);
+		ASSERT_THAT(IsTrue(Batch.ForwardSpeed[Slot] < CruiseSpeed));
+
+		Run(Batch, Params, 10.0f);
+		ASSERT_THAT(IsNear(0.0f, Batch.ForwardSpeed[Slot], 1e-3f));
+	}
+
+	TEST_METHOD(ResetSlot_Restarts_At_Rest_Independently)
+	{
+		FKinematicVehicleParams Params;
+		FKinematicVehicleBatch Batch;
+		const int32 A = Batch.Add(FVector::ZeroVector, 0.0f);
+		const int32 B = Batch.Add(FVector(0.0f, 1000.0f, 50.0f), 0.0f);
+		Batch.ThrottleInput[A] = 1.0f;
+		Batch.ThrottleInput[B] = 1.0f;
+		Run(Batch, Params, 2.0f);
+
+		Batch.ResetSlot(A, FVector(500.0f, 0.0f, 0.0f), UE_HALF_PI);
+
+		ASSERT_THAT(IsNear(0.0f, Batch.ForwardSpeed[A], 1e-6f));
+		ASSERT_THAT(IsNear(500.0f, Batch.GetLocationCm(A).X, 1e-2f));
+		ASSERT_THAT(IsTrue(Batch.ForwardSpeed[B] > 0.0f));
+		ASSERT_THAT(IsNear(50.0f, Batch.GetLocationCm(B).Z, 1e-2f));
+	}
+
+	TEST_METHOD(Gear_Is_Clamped_To_Shortened_Gear_Ratios)
+	{
+		FKinematicVehicleParams Params;
+		FKinematicVehicleBatch Batch;
+		const int32 Slot = Batch.Add(FVector::ZeroVector, 0.0f);
+		Batch.Gear[Slot] = 5.0f;
+
+		Params.GearRatios = { 3.0f, 1.5f };
+		Batch.Step(Params, 1.0f / 120.0f);
+
+		ASSERT_THAT(IsTrue(Batch.Gear[Slot] <= 1.0f, TEXT("The gear index must stay inside GearRatios")));
+	}
+
+	TEST_METHOD(Removed_Rows_Are_Reused_At_Rest)
+	{
+		FKinematicVehicleParams Params;
+		FKinematicVehicleBatch Batch;
+		const int32 A = Batch.Add(FVector::ZeroVector, 0.0f);
+		const int32 B = Batch.Add(FVector(0.0f, 1000.0f, 0.0f), 0.0f);
+		Batch.ThrottleInput[A] = 1.0f;
+		Run(Batch, Params, 2.0f);
+
+		Batch.Remove(A);
+		ASSERT_THAT(AreEqual(1, Batch.NumFree()));
+		ASSERT_THAT(IsNear(0.0f, Batch.ThrottleInput[A], 1e-6f, TEXT("A released row must not keep driving")));
+
+		const int32 C = Batch.Add(FVector(200.0f, 0.0f, 0.0f), 0.0f);
+		ASSERT_THAT(AreEqual(A, C, TEXT("Add should hand out the released row")));
+		ASSERT_THAT(AreEqual(2, Batch.Num(), TEXT("Reusing a row must not grow the batch")));
+		ASSERT_THAT(IsNear(0.0f, Batch.ForwardSpeed[C], 1e-6f));
+		ASSERT_THAT(IsNear(200.0f, Batch.GetLocationCm(C).X, 1e-2f));
+		ASSERT_THAT(IsNear(1000.0f, Batch.GetLocationCm(B).Y, 1e-2f));
+	}
+
+	TEST_METHOD(Destroying_An_Entity_Releases_Its_Row)
+	{
+		entt::registry Registry;
+		FKinematicVehicleBatch& Batch = FKinematicVehicleBatch::Get(Registry);
+
+		const entt::entity First = Registry.create();
+		Registry.emplace<FKinematicVehicleComponent>(First).Slot = Batch.Add(FVector::ZeroVector, 0.0f);
+		const entt::entity Physics = Registry.create();
+		Registry.emplace<FKinematicVehicleComponent>(Physics);
+
+		Registry.destroy(Physics);
+		ASSERT_THAT(AreEqual(0, Batch.NumFree(), TEXT("Entities without a row have nothing to release")));
+
+		const int32 Slot = Registry.get<FKinematicVehicleComponent>(First).Slot;
+		Registry.destroy(First);
+		ASSERT_THAT(AreEqual(1, Batch.NumFree()));
+
+		const entt::entity Second = Registry.create();
+		Registry.emplace<FKinematicVehicleComponent>(Second).Slot = Batch.Add(FVector::ZeroVector, 0.0f);
+		ASSERT_THAT(AreEqual(Slot, Registry.get<FKinematicVehicleComponent>(Second).Slot));
+		ASSERT_THAT(AreEqual(1, Batch.Num()));
+	}
+};
@@ -0,0 +1,160 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "Systems/NsgaSelectionSystem.h"
+#include "Components/GenomeComponents.h"
+#include "BreedingPlan.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "Engine/World.h"
+
+TEST_CLASS(SplineCircuitTrainer_NsgaSelectionSystem_Tests, "SplineCircuitTrainer.NsgaSelectionSystem")
+{
+	static constexpr int32 NumTargets = 400;
+
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AVehicleTrainerContext> Context;
+	TObjectPtr<UNsgaSelectionSystem> System;
+	TArray<TArray<float>> Genomes;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("NsgaSelectionTestWorld")));
+		Context = World->SpawnActor<AVehicleTrainerContext>();
+		Context->TrainerConfig = NewObject<UVehicleTrainerConfig>();
+
+		System = NewObject<UNsgaSelectionSystem>();
+		System->ObjectiveIndices = { 0, 1, 2 };
+		System->bHigherIsBetter = true;
+		System->RandomSeed = 11;
+		System->Initialize(Context);
+
+		// Genome views point into these buffers; no reallocation while the test runs
+		Genomes.Reset();
+		Genomes.Reserve(NumTargets + 8);
+	}
+
+	AFTER_EACH()
+	{
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	entt::entity CreateSolution(float A, float B, float C)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		const entt::entity Entity = Registry.create();
+
+		FFitnessComponent Fit;
+		Fit.Fitness = { A, B, C };
+		Fit.BuiltForFitnessIndex = 0;
+		Registry.emplace<FFitnessComponent>(Entity, Fit);
+
+		TArray<float>& Genome = Genomes.AddDefaulted_GetRef();
+		Genome.Init(A, 4);
+		Registry.emplace<FGenomeFloatViewComponent>(Entity).Values = Genome;
+		return Entity;
+	}
+
+	entt::entity CreateCandidate(float A, float B, float C)
+	{
+		const entt::entity Entity = CreateSolution(A, B, C);
+		Context->GetRegistry().emplace<FEligibleForBreedingTagComponent>(Entity);
+		return Entity;
+	}
+
+	int32 CandidateSlot(entt::entity Entity) const
+	{
+		return System->GetCandidates().IndexOfByKey(Entity);
+	}
+
+	TEST_METHOD(Ranks_Fronts_And_Crowds_Interior_Points)
+	{
+		// Front 0 spans the corners of the plane a + b + c = 10 plus one interior point
+		const entt::entity CornerA = CreateCandidate(10.0f, 0.0f, 0.0f);
+		const entt::entity CornerB = CreateCandidate(0.0f, 10.0f, 0.0f);
+		const entt::entity CornerC = CreateCandidate(0.0f, 0.0f, 10.0f);
+		const entt::entity Interior = CreateCandidate(4.0f, 3.0f, 3.0f);
+		const entt::entity Dominated = CreateCandidate(1.0f, 1.0f, 1.0f);
+		const entt::entity Worst = CreateCandidate(0.0f, 0.0f, 0.0f);
+		const entt::entity Target = CreateSolution(0.0f, 0.0f, 0.0f);
+		Context->GetRegistry().emplace<FResetGenomeComponent>(Target);
+
+		System->Update(0.0f);
+
+		ASSERT_THAT(AreEqual(6, System->GetCandidates().Num(), TEXT("Entities flagged for reset are not candidates")));
+		const TConstArrayView<int32> Ranks = System->GetRanks();
+		const TConstArrayView<float> Crowding = System->GetCrowding();
+		for (const entt::entity Entity : { CornerA, CornerB, CornerC, Interior })
+		{
+			ASSERT_THAT(AreEqual(0, Ranks[CandidateSlot(Entity)], TEXT("Mutually non-dominated points share the first front")));
+		}
+		ASSERT_THAT(AreEqual(1, Ranks[CandidateSlot(Dominated)]));
+		ASSERT_THAT(AreEqual(2, Ranks[CandidateSlot(Worst)]));
+
+		ASSERT_THAT(IsTrue(Crowding[CandidateSlot(CornerA)] >= TNumericLimits<float>::Max(), TEXT("Objective extremes are boundary points")));
+		ASSERT_THAT(IsTrue(Crowding[CandidateSlot(CornerB)] >= TNumericLimits<float>::Max()));
+		ASSERT_THAT(IsTrue(Crowding[CandidateSlot(CornerC)] >= TNumericLimits<float>::Max()));
+		// Interior point: neighbours span the full range in every objective
+		ASSERT_THAT(IsNear(3.0f, Crowding[CandidateSlot(Interior)], 1e-5f));
+
+		const FBreedingPlan& Plan = FBreedingPlan::Get(Context->GetRegistry());
+		ASSERT_THAT(AreEqual(1, Plan.Num(), TEXT("One plan entry per entity flagged for reset")));
+		ASSERT_THAT(AreEqual(Target, Plan.GetEntries()[0].Child));
+	}
+
+	TEST_METHOD(Tournament_Prefers_Lower_Fronts_Then_Sparser_Points)
+	{
+		const entt::entity CornerA = CreateCandidate(10.0f, 0.0f, 0.0f);
+		CreateCandidate(0.0f, 10.0f, 0.0f);
+		CreateCandidate(0.0f, 0.0f, 10.0f);
+		const entt::entity Interior = CreateCandidate(4.0f, 3.0f, 3.0f);
+		const entt::entity Dominated = CreateCandidate(1.0f, 1.0f, 1.0f);
+		const entt::entity Worst = CreateCandidate(0.0f, 0.0f, 0.0f);
+		for (int32 i = 0; i < NumTargets; ++i)
+		{
+			Context->GetRegistry().emplace<FResetGenomeComponent>(CreateSolution(0.0f, 0.0f, 0.0f));
+		}
+
+		System->Update(0.0f);
+
+		const FBreedingPlan& Plan = FBreedingPlan::Get(Context->GetRegistry());
+		ASSERT_THAT(AreEqual(NumTargets, Plan.Num()));
+
+		TMap<entt::entity, int32> Picks;
+		int32 FirstFrontPicks = 0;
+		for (const FBreedingPlanEntry& Entry : Plan.GetEntries())
+		{
+			for (const entt::entity Parent : { Entry.ParentA, Entry.ParentB })
+			{
+				ASSERT_THAT(IsTrue(CandidateSlot(Parent) != INDEX_NONE, TEXT("Parents come from the candidate pool")));
+				++Picks.FindOrAdd(Parent);
+				FirstFrontPicks += System->GetRanks()[CandidateSlot(Parent)] == 0 ? 1 : 0;
+			}
+		}
+
+		// Binary tournament: a front-0 parent unless both draws miss the first front (expected 1 - (2/6)^2)
+		ASSERT_THAT(IsTrue(FirstFrontPicks > NumTargets * 2 * 8 / 10, TEXT("The first front should win most tournaments")));
+		// Within front 0 the boundary corner beats the crowded interior point, which still beats the dominated ones
+		ASSERT_THAT(IsTrue(Picks.FindRef(CornerA) > Picks.FindRef(Interior)));
+		ASSERT_THAT(IsTrue(Picks.FindRef(Interior) > Picks.FindRef(Dominated)));
+		ASSERT_THAT(IsTrue(Picks.FindRef(Dominated) > Picks.FindRef(Worst)));
+	}
+
+	TEST_METHOD(Negative_Objective_Indices_Are_Rejected)
+	{
+		CreateCandidate(10.0f, 0.0f, 0.0f);
+		CreateCandidate(0.0f, 10.0f, 0.0f);
+		Context->GetRegistry().emplace<FResetGenomeComponent>(CreateSolution(0.0f, 0.0f, 0.0f));
+
+		System->ObjectiveIndices = { 0, -1 };
+		System->Update(0.0f);
+
+		ASSERT_THAT(AreEqual(0, System->GetCandidates().Num(), TEXT("A negative fitness slot must not be read")));
+		ASSERT_THAT(AreEqual(0, FBreedingPlan::Get(Context->GetRegistry()).Num(), TEXT("No parents are planned with invalid objectives")));
+	}
+};
@@ -0,0 +1,206 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "SplineTestActor.h"
+#include "SplineTrackIndex.h"
+#include "VehicleSpawnPoint.h"
+#include "Components/SplineComponent.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+
+TEST_CLASS(SplineCircuitTrainer_SplineTrackIndex_Tests, "SplineCircuitTrainer.SplineTrackIndex")
+{
+	TObjectPtr<UWorld> World;
+	TObjectPtr<ASplineTestActor> SplineActor;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("TrackIndexTestWorld")));
+		SplineActor = World->SpawnActor<ASplineTestActor>();
+		ASSERT_THAT(IsNotNull(SplineActor, "SplineActor should be successfully spawned"));
+	}
+
+	AFTER_EACH()
+	{
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	TEST_METHOD(Project_Matches_Spline_Closest_Point_On_Closed_Loop)
+	{
+		USplineComponent* Spline = SplineActor->SplineComponent;
+		Spline->ClearSplinePoints();
+		Spline->AddSplinePoint(FVector(5000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(0, 3000, 100), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(-5000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(0, -3000, -100), ESplineCoordinateSpace::World);
+		Spline->SetClosedLoop(true);
+		Spline->UpdateSpline();
+
+		FSplineTrackIndex Track;
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 50.0f)));
+
+		FRandomStream Random(1234);
+		for (int32 i = 0; i < 200; ++i)
+		{
+			const float Distance = Random.FRandRange(0.0f, Track.GetLength());
+			const FVector OnTrack = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+			const FVector Query = OnTrack + FVector(Random.FRandRange(-300.0f, 300.0f), Random.FRandRange(-300.0f, 300.0f), Random.FRandRange(-50.0f, 50.0f));
+
+			const FSplineTrackProjection Projection = Track.Project(Query);
+			const FVector Expected = Spline->FindLocationClosestToWorldLocation(Query, ESplineCoordinateSpace::World);
+
+			// Both are local minima searches; compare the achieved distance rather than the point
+			const float ExpectedDistance = FVector::Dist(Query, Expected);
+			ASSERT_THAT(IsTrue(FMath::Sqrt(Projection.DistanceSquared) <= ExpectedDistance + 1.0f, TEXT("Index should find a point at least as close as the spline search")));
+			ASSERT_THAT(IsNear(1.0f, static_cast<float>(Projection.Tangent.Size()), 1e-3f));
+			ASSERT_THAT(IsTrue(Projection.InputKey >= 0.0f && Projection.InputKey < 4.0f));
+			const FVector AtKey = Spline->GetLocationAtSplineInputKey(Projection.InputKey, ESplineCoordinateSpace::World);
+			ASSERT_THAT(IsTrue(FVector::Dist(AtKey, Projection.Location) < 1.0f, TEXT("Location should lie on the spline at the returned key")));
+			const float DistanceAtKey = Spline->GetDistanceAlongSplineAtSplineInputKey(Projection.InputKey);
+			ASSERT_THAT(IsTrue(FMath::Abs(DistanceAtKey - Projection.Distance) < 5.0f || FMath::Abs(DistanceAtKey - Projection.Distance) > Track.GetLength() - 5.0f));
+		}
+	}
+
+	TEST_METHOD(Project_Clamps_To_Open_Spline_Ends)
+	{
+		USplineComponent* Spline = SplineActor->SplineComponent;
+		Spline->ClearSplinePoints();
+		Spline->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(1000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->SetClosedLoop(false);
+		Spline->UpdateSpline();
+
+		FSplineTrackIndex Track;
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 50.0f)));
+
+		const FSplineTrackProjection Beyond = Track.Project(FVector(3000, 200, 0));
+		ASSERT_THAT(IsNear(1.0f, Beyond.InputKey, 1e-4f));
+		ASSERT_THAT(IsNear(1000.0f, Beyond.Distance, 1e-2f));
+
+		const FSplineTrackProjection Middle = Track.Project(FVector(400, -250, 0));
+		ASSERT_THAT(IsNear(400.0f, Middle.Distance, 0.5f));
+		ASSERT_THAT(IsNear(250.0f, FMath::Sqrt(Middle.DistanceSquared), 0.5f));
+	}
+
+	TEST_METHOD(ProjectNear_Matches_Global_Search_And_Recovers_From_Teleports)
+	{
+		USplineComponent* Spline = SplineActor->SplineComponent;
+		Spline->ClearSplinePoints();
+		Spline->AddSplinePoint(FVector(5000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(0, 3000, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(-5000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(0, -3000, 0), ESplineCoordinateSpace::World);
+		Spline->SetClosedLoop(true);
+		Spline->UpdateSpline();
+
+		FSplineTrackIndex Track;
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 50.0f)));
+
+		// Coherent motion: seed a few metres behind, including across the loop seam
+		for (const float Distance : { 10.0f, 3000.0f, 12000.0f, Track.GetLength() - 20.0f })
+		{
+			const FVector Query = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World) + FVector(0, 0, 80);
+			const FSplineTrackProjection Global = Track.Project(Query);
+			const FSplineTrackProjection Local = Track.ProjectNear(Query, FMath::Fmod(Distance - 300.0f + Track.GetLength(), Track.GetLength()));
+			ASSERT_THAT(IsNear(Global.InputKey, Local.InputKey, 1e-3f));
+			ASSERT_THAT(IsNear(Global.DistanceSquared, Local.DistanceSquared, 1.0f));
+		}
+
+		// Teleport: the seed is on the far side of the circuit
+		const FVector Query = Spline->GetLocationAtDistanceAlongSpline(100.0f, ESplineCoordinateSpace::World);
+		const FSplineTrackProjection Teleported = Track.ProjectNear(Query, Track.GetLength() * 0.5f);
+		ASSERT_THAT(IsTrue(Teleported.DistanceSquared < 1.0f, TEXT("Window miss should fall back to the global search")));
+	}
+
+	TEST_METHOD(SampleFeatures_Reports_Tangent_And_Curvature)
+	{
+		USplineComponent* Spline = SplineActor->SplineComponent;
+		constexpr float Radius = 2000.0f;
+		Spline->ClearSplinePoints();
+		Spline->AddSplinePoint(FVector(Radius, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(0, Radius, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(-Radius, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(0, -Radius, 0), ESplineCoordinateSpace::World);
+		Spline->SetClosedLoop(true);
+		Spline->UpdateSpline();
+
+		FSplineTrackIndex Track;
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 50.0f)));
+
+		for (const float Distance : { 0.0f, 1234.5f, 5000.0f, Track.GetLength() * 0.75f, Track.GetLength() })
+		{
+			const FSplineTrackFeature Feature = Track.SampleFeatures(Distance);
+			const FVector Expected = Spline->GetDirectionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+			ASSERT_THAT(IsTrue(FVector::DotProduct(FVector(Feature.Tangent), Expected) > 0.999f, TEXT("Tangent should match the spline")));
+			ASSERT_THAT(IsNear(1.0f / Radius, Feature.Curvature, 0.25f / Radius));
+			ASSERT_THAT(IsNear(1.0f, Feature.CurvatureSign, 1e-6f));
+		}
+
+		// Out-of-range distances clamp to the ends
+		ASSERT_THAT(IsTrue(FVector::DotProduct(FVector(Track.SampleFeatures(-100.0f).Tangent), FVector(Track.SampleFeatures(0.0f).Tangent)) > 0.9999f));
+	}
+
+	TEST_METHOD(EnsureBuilt_Rebuilds_When_Spline_Changes)
+	{
+		USplineComponent* Spline = SplineActor->SplineComponent;
+		Spline->ClearSplinePoints();
+		Spline->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(1000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->UpdateSpline();
+
+		FSplineTrackIndex Track;
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 100.0f)));
+		const int32 SamplesBefore = Track.NumSamples();
+
+		Spline->AddSplinePoint(FVector(2000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->UpdateSpline();
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 100.0f)));
+		ASSERT_THAT(IsTrue(Track.NumSamples() > SamplesBefore));
+		ASSERT_THAT(IsNear(2000.0f, Track.GetLength(), 1.0f));
+	}
+
+	TEST_METHOD(EnsureBuilt_Rebuilds_When_Points_Move_Without_Changing_The_Length)
+	{
+		USplineComponent* Spline = SplineActor->SplineComponent;
+		Spline->ClearSplinePoints();
+		Spline->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(1000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->UpdateSpline();
+
+		FSplineTrackIndex Track;
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 100.0f)));
+		const uint32 StampBefore = Track.GetBuildStamp();
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 100.0f)));
+		ASSERT_THAT(AreEqual(StampBefore, Track.GetBuildStamp(), "An unchanged spline should not be rebuilt"));
+
+		// Same point count, loop flag and length, shifted sideways
+		Spline->SetLocationAtSplinePoint(0, FVector(0, 500, 0), ESplineCoordinateSpace::World, false);
+		Spline->SetLocationAtSplinePoint(1, FVector(1000, 500, 0), ESplineCoordinateSpace::World, true);
+		ASSERT_THAT(IsTrue(Track.EnsureBuilt(Spline, 100.0f)));
+		ASSERT_THAT(AreNotEqual(StampBefore, Track.GetBuildStamp(), "Moved points should rebuild the index"));
+		ASSERT_THAT(IsNear(500.0f, Track.Project(FVector(500, 0, 0)).Location.Y, 1.0f));
+	}
+
+	TEST_METHOD(Spawn_Point_Follows_A_Moved_Spline)
+	{
+		USplineComponent* Spline = SplineActor->SplineComponent;
+		Spline->ClearSplinePoints();
+		Spline->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		Spline->AddSplinePoint(FVector(1000, 0, 0), ESplineCoordinateSpace::World);
+		Spline->UpdateSpline();
+
+		FVehicleSpawnPoint SpawnPoint;
+		ASSERT_THAT(IsTrue(SpawnPoint.EnsureBuilt(Spline, 200.0f, 0.0f)));
+		ASSERT_THAT(IsNear(0.0f, SpawnPoint.Location.Y, 1.0f));
+
+		// Moving the actor keeps every spline point and the length in local space
+		SplineActor->SetActorLocation(FVector(0, 700, 0));
+		ASSERT_THAT(IsTrue(SpawnPoint.EnsureBuilt(Spline, 200.0f, 0.0f)));
+		ASSERT_THAT(IsNear(700.0f, SpawnPoint.Location.Y, 1.0f, "The spawn transform should follow the spline"));
+	}
+};
@@ -0,0 +1,105 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "TrainerCheckpoint.h"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+TEST_CLASS(SplineCircuitTrainer_Checkpoint_Tests, "SplineCircuitTrainer.Checkpoint")
+{
+	FString Filename;
+
+	BEFORE_EACH()
+	{
+		Filename = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("TrainerCheckpointTest.ckpt");
+	}
+
+	AFTER_EACH()
+	{
+		IFileManager::Get().Delete(*Filename);
+	}
+
+	static entt::entity AddElite(entt::registry& Registry, int32 Population, float Fitness, int64 Id, const TArray<float>& Genome)
+	{
+		const entt::entity Entity = Registry.create();
+		Registry.emplace<FEliteTagComponent>(Entity);
+		Registry.emplace<FUniqueSolutionComponent>(Entity).Id = Id;
+		FFitnessComponent& Fit = Registry.emplace<FFitnessComponent>(Entity);
+		Fit.BuiltForFitnessIndex = Population;
+		Fit.Fitness.SetNumZeroed(2);
+		Fit.Fitness[Population] = Fitness;
+		Registry.emplace<FEliteOwnedFloatGenome>(Entity).Values = Genome;
+		return Entity;
+	}
+
+	TEST_METHOD(Save_Load_Restore_Round_Trips_Elites)
+	{
+		entt::registry Source;
+		AddElite(Source, 0, 3.0f, 11, { 1.0f, 2.0f });
+		AddElite(Source, 0, 5.0f, 12, { 3.0f, 4.0f });
+		AddElite(Source, 1, 7.0f, 13, { 5.0f, 6.0f });
+
+		FTrainerCheckpoint Saved;
+		Saved.Capture(Source, 123.0);
+		ASSERT_THAT(AreEqual(3, Saved.Elites.Num()));
+		ASSERT_THAT(IsTrue(Saved.Save(Filename)));
+
+		FTrainerCheckpoint Loaded;
+		ASSERT_THAT(IsTrue(Loaded.Load(Filename)));
+		ASSERT_THAT(IsNear(123.0f, static_cast<float>(Loaded.SimTime), 1e-3f));
+		ASSERT_THAT(AreEqual(3, Loaded.Elites.Num()));
+
+		// One elite per population: population 0 keeps its better elite
+		entt::registry Target;
+		ASSERT_THAT(AreEqual(2, Loaded.Restore(Target, 2, 1, true, 2)));
+
+		auto View = Target.view<FEliteTagComponent, FFitnessComponent, FUniqueSolutionComponent, FEliteOwnedFloatGenome, FGenomeFloatViewComponent>();
+		int32 Count = 0;
+		for (const entt::entity Entity : View)
+		{
+			const FFitnessComponent& Fit = View.get<FFitnessComponent>(Entity);
+			const FUniqueSolutionComponent& Unique = View.get<FUniqueSolutionComponent>(Entity);
+			const FEliteOwnedFloatGenome& Owned = View.get<FEliteOwnedFloatGenome>(Entity);
+			if (Fit.BuiltForFitnessIndex == 0)
+			{
+				ASSERT_THAT(IsNear(5.0f, Fit.Fitness[0], 1e-6f));
+				ASSERT_THAT(AreEqual(static_cast<int64>(12), Unique.SourceId));
+				ASSERT_THAT(IsNear(3.0f, Owned.Values[0], 1e-6f));
+			}
+			ASSERT_THAT(IsTrue(View.get<FGenomeFloatViewComponent>(Entity).Values.GetData() == Owned.Values.GetData(), TEXT("Genome view should point at the owned genome")));
+			++Count;
+		}
+		ASSERT_THAT(AreEqual(2, Count));
+	}
+
+	TEST_METHOD(Restore_Skips_Elites_Saved_For_Another_Network)
+	{
+		FTrainerCheckpoint Checkpoint;
+		Checkpoint.Elites.Add({ 0, 9.0f, 21, { 1.0f, 2.0f, 3.0f } });
+		Checkpoint.Elites.Add({ 0, 4.0f, 22, { 1.0f, 2.0f } });
+
+		// The better elite has the wrong genome length, so the other one takes the population's only slot
+		entt::registry Target;
+		ASSERT_THAT(AreEqual(1, Checkpoint.Restore(Target, 1, 1, true, 2)));
+		for (const entt::entity Entity : Target.view<FEliteTagComponent>())
+		{
+			ASSERT_THAT(AreEqual(static_cast<int64>(22), Target.get<FUniqueSolutionComponent>(Entity).SourceId));
+			ASSERT_THAT(AreEqual(2, Target.get<FEliteOwnedFloatGenome>(Entity).Values.Num()));
+		}
+
+		entt::registry Empty;
+		ASSERT_THAT(AreEqual(0, Checkpoint.Restore(Empty, 1, 1, true, 5), TEXT("Nothing matches a larger network")));
+	}
+
+	TEST_METHOD(Load_Rejects_Foreign_Files)
+	{
+		const TArray<uint8> Garbage = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		ASSERT_THAT(IsTrue(FFileHelper::SaveArrayToFile(Garbage, *Filename)));
+		FTrainerCheckpoint Loaded;
+		ASSERT_THAT(IsFalse(Loaded.Load(Filename)));
+	}
+};
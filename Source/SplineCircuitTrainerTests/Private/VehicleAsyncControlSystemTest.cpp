@@ -0,0 +1,219 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "SplineTestActor.h"
+#include "Systems/VehicleAsyncControlSystem.h"
+#include "Systems/VehicleNNInputSystem.h"
+#include "Components/NNIOComponents.h"
+#include "Components/NetworkComponent.h"
+#include "VehicleComponent.h"
+#include "TestVehiclePawn.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "Components/SplineComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+TEST_CLASS(SplineCircuitTrainer_VehicleAsyncControlSystem_Tests, "SplineCircuitTrainer.VehicleAsyncControlSystem")
+{
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AVehicleTrainerContext> Context;
+	TObjectPtr<ASplineTestActor> SplineActor;
+	TObjectPtr<UVehicleAsyncControlSystem> System;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("AsyncControlTestWorld")));
+		Context = World->SpawnActor<AVehicleTrainerContext>();
+		Context->TrainerConfig = NewObject<UVehicleTrainerConfig>();
+		Context->TrainerConfig->bAsyncPhysicsControl = true;
+
+		SplineActor = World->SpawnActor<ASplineTestActor>();
+		Context->CircuitActor = SplineActor;
+		SplineActor->SplineComponent->ClearSplinePoints();
+		SplineActor->SplineComponent->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->AddSplinePoint(FVector(10000, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->SetClosedLoop(false);
+		SplineActor->SplineComponent->UpdateSpline();
+
+		System = NewObject<UVehicleAsyncControlSystem>();
+		System->Initialize(Context);
+	}
+
+	AFTER_EACH()
+	{
+		if (System)
+		{
+			System->Deinitialize();
+		}
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	TEST_METHOD(Vehicles_Without_A_Simulated_Body_Stay_On_The_Chain)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		APawn* Pawn = World->SpawnActor<APawn>();
+
+		const entt::entity Entity = Registry.create();
+		Registry.emplace<FVehicleComponent>(Entity, Pawn);
+		Registry.emplace<FNeuralNetworkFloat>(Entity);
+		Registry.emplace<FNNOutFloatComp>(Entity);
+
+		// A stale tag from an earlier physics body must not keep the vehicle off the chain
+		Registry.emplace<FNNExternalEvaluationTag>(Entity);
+		System->Update(0.1f);
+
+		ASSERT_THAT(IsTrue(System->IsCallbackRegistered(), "The physics callback should be registered on the world's solver"));
+		ASSERT_THAT(IsFalse(Registry.all_of<FNNExternalEvaluationTag>(Entity), "A pawn without a physics body cannot be controlled from the physics thread"));
+	}
+
+	TEST_METHOD(Disabling_The_Mode_Releases_The_Callback_And_Clears_Tags)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(System->IsCallbackRegistered()));
+
+		const entt::entity Entity = Registry.create();
+		Registry.emplace<FNNExternalEvaluationTag>(Entity);
+
+		Context->TrainerConfig->bAsyncPhysicsControl = false;
+		System->Update(0.1f);
+
+		ASSERT_THAT(IsFalse(System->IsCallbackRegistered(), "Turning the mode off should unregister the callback"));
+		ASSERT_THAT(IsFalse(Registry.all_of<FNNExternalEvaluationTag>(Entity), "Every vehicle should be back on the chain"));
+	}
+
+	TEST_METHOD(Destroying_A_Vehicle_Clears_Its_Physics_Thread_Alive_Flag)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		System->Update(0.1f);
+
+		const entt::entity Entity = Registry.create();
+		FVehicleAsyncControlComponent& AsyncComp = Registry.emplace<FVehicleAsyncControlComponent>(Entity);
+		AsyncComp.Alive = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(true);
+
+		// An agent already pushed to the physics thread holds its own reference to the flag
+		FVehicleAsyncAgentInput Agent;
+		Agent.Entity = Entity;
+		Agent.Alive = AsyncComp.Alive;
+
+		Registry.destroy(Entity);
+		ASSERT_THAT(IsFalse(Agent.Alive->load(), "The physics thread must stop using the pointers of a destroyed vehicle"));
+	}
+
+	TEST_METHOD(Editing_The_Config_Rebuilds_The_Shared_Data)
+	{
+		UVehicleTrainerConfig& Config = *Context->TrainerConfig;
+		System->Update(0.1f);
+		const FVehicleAsyncControlShared* First = System->GetShared();
+		ASSERT_THAT(IsNotNull(First));
+
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(System->GetShared() == First, "Unchanged config and track should keep the shared data"));
+
+		Config.CurvatureLookaheadDistance = 800.0f;
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(System->GetShared() != First, "A runtime edit of the same config should rebuild the shared data"));
+		ASSERT_THAT(AreEqual(800.0f, System->GetShared()->InputContext.LookaheadDistance));
+
+		const FVehicleAsyncControlShared* Second = System->GetShared();
+		Config.FutureDotProductDistances[0] += 250.0f;
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(System->GetShared() != Second, "Moving a future distance keeps the input count but changes the inputs"));
+		ASSERT_THAT(AreEqual(Config.FutureDotProductDistances[0], System->GetShared()->FutureDistances[0]));
+
+		const FVehicleAsyncControlShared* Third = System->GetShared();
+		Config.AsyncControlHz = 60.0f;
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(System->GetShared() != Third));
+		ASSERT_THAT(IsNear(1.0f / 60.0f, System->GetShared()->ControlPeriod, 1e-6f));
+	}
+
+	TEST_METHOD(Outputs_Are_Copied_Back_And_Declined_Ones_Applied_On_The_Game_Thread)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		constexpr int32 Stride = 3;
+		constexpr int32 ControlOutputCount = 2;
+
+		ATestVehiclePawn* Pawns[2] = { World->SpawnActor<ATestVehiclePawn>(), World->SpawnActor<ATestVehiclePawn>() };
+		FVehicleAsyncControlOutput Output;
+		Output.OutputStride = Stride;
+		for (int32 i = 0; i < 2; ++i)
+		{
+			const entt::entity Entity = Registry.create();
+			Registry.emplace<FVehicleComponent>(Entity, Pawns[i]);
+			Registry.emplace<FNNOutFloatComp>(Entity);
+			Registry.emplace<FNNExternalEvaluationTag>(Entity);
+
+			Output.Entities.Add(Entity);
+			Output.Outputs.Append({ 0.1f + i, 0.2f + i, 0.3f + i });
+			// The first vehicle took its outputs on the physics thread, the second declined them
+			Output.AppliedInternal.Add(i == 0 ? 1 : 0);
+		}
+
+		System->ApplyOutputs(Output, ControlOutputCount);
+
+		for (int32 i = 0; i < 2; ++i)
+		{
+			const TArray<float>& Values = Registry.get<FNNOutFloatComp>(Output.Entities[i]).Values;
+			ASSERT_THAT(AreEqual(Stride, Values.Num(), "Control and recurrent outputs should be copied back"));
+			for (int32 j = 0; j < Stride; ++j)
+			{
+				ASSERT_THAT(AreEqual(Output.Outputs[i * Stride + j], Values[j]));
+			}
+		}
+
+		ASSERT_THAT(AreEqual(0, Pawns[0]->LastOutputs.Num(), "Outputs applied on the physics thread must not be applied twice"));
+		ASSERT_THAT(AreEqual(ControlOutputCount, Pawns[1]->LastOutputs.Num(), "Declined outputs should fall back to ApplyNNOutputs"));
+		ASSERT_THAT(AreEqual(1.1f, Pawns[1]->LastOutputs[0]));
+		ASSERT_THAT(AreEqual(1.2f, Pawns[1]->LastOutputs[1]));
+	}
+
+	TEST_METHOD(Physics_Thread_Inputs_Match_The_Game_Thread_Path)
+	{
+		const UVehicleTrainerConfig& Config = *Context->TrainerConfig;
+		entt::registry& Registry = Context->GetRegistry();
+		System->Update(0.1f);
+		const FVehicleAsyncControlShared* Shared = System->GetShared();
+		ASSERT_THAT(IsNotNull(Shared));
+
+		APawn* Pawn = World->SpawnActor<APawn>();
+		Pawn->SetActorLocation(FVector(2500.0f, 300.0f, 50.0f));
+		Pawn->SetActorRotation(FRotator(5.0f, 20.0f, -3.0f));
+		const entt::entity Entity = Registry.create();
+		Registry.emplace<FVehicleComponent>(Entity, Pawn);
+		Registry.emplace<FNNInFLoatComp>(Entity);
+
+		UVehicleNNInputSystem* InputSystem = NewObject<UVehicleNNInputSystem>();
+		InputSystem->Initialize(Context);
+		InputSystem->Update(0.1f);
+		const TArray<float>& Expected = Registry.get<FNNInFLoatComp>(Entity).Values;
+		ASSERT_THAT(AreEqual(Shared->Schema.Num() + Config.RecurrentInputCount, Expected.Num()));
+
+		// The rigid body state the physics callback reads, with the same pose and no velocity
+		FVehicleAsyncBodyState Body;
+		Body.Location = Pawn->GetActorLocation();
+		Body.Rotation = Pawn->GetActorQuat();
+
+		TArray<float> Actual;
+		Actual.Init(0.0f, Expected.Num());
+		float Distance = 0.0f;
+		bool bHasDistance = false;
+		Shared->WriteAgentInputs(Body, FVehicleTelemetry(), Distance, bHasDistance, Actual.GetData());
+		for (int32 i = 0; i < Expected.Num(); ++i)
+		{
+			ASSERT_THAT(IsNear(Expected[i], Actual[i], 1e-3f, "Both paths should write the same input row"));
+		}
+		ASSERT_THAT(IsTrue(bHasDistance, "The projection should seed the next step's warm start"));
+
+		// The warm-started projection of the next step lands on the same track distance
+		const float FirstDistance = Distance;
+		Shared->WriteAgentInputs(Body, FVehicleTelemetry(), Distance, bHasDistance, Actual.GetData());
+		ASSERT_THAT(IsNear(FirstDistance, Distance, 1.0f));
+	}
+};
@@ -0,0 +1,110 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "SplineTestActor.h"
+#include "Systems/VehicleDecisionHoldSystem.h"
+#include "Components/NNIOComponents.h"
+#include "Components/VehicleDecisionComponent.h"
+#include "VehicleComponent.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "Components/SplineComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+TEST_CLASS(SplineCircuitTrainer_VehicleDecisionHoldSystem_Tests, "SplineCircuitTrainer.VehicleDecisionHoldSystem")
+{
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AVehicleTrainerContext> Context;
+	TObjectPtr<ASplineTestActor> SplineActor;
+	TObjectPtr<UVehicleDecisionHoldSystem> System;
+	TObjectPtr<APawn> Pawn;
+	entt::entity Entity = entt::null;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("DecisionHoldTestWorld")));
+		Context = World->SpawnActor<AVehicleTrainerContext>();
+		Context->TrainerConfig = NewObject<UVehicleTrainerConfig>();
+		Context->TrainerConfig->DecisionHoldMaxSec = 0.3f;
+
+		SplineActor = World->SpawnActor<ASplineTestActor>();
+		Context->CircuitActor = SplineActor;
+		SplineActor->SplineComponent->ClearSplinePoints();
+		SplineActor->SplineComponent->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->AddSplinePoint(FVector(10000, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->SetClosedLoop(false);
+		SplineActor->SplineComponent->UpdateSpline();
+
+		System = NewObject<UVehicleDecisionHoldSystem>();
+		System->Initialize(Context);
+
+		Pawn = World->SpawnActor<APawn>();
+		Pawn->SetActorLocation(FVector(1000, 0, 0));
+
+		entt::registry& Registry = Context->GetRegistry();
+		Entity = Registry.create();
+		Registry.emplace<FVehicleComponent>(Entity, Pawn);
+		Registry.emplace<FNNOutFloatComp>(Entity);
+	}
+
+	AFTER_EACH()
+	{
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	bool IsHeld() const
+	{
+		return Context->GetRegistry().all_of<FNNHoldOutputTag>(Entity);
+	}
+
+	TEST_METHOD(Holds_Outputs_Until_The_Hold_Time_Expires)
+	{
+		System->Update(0.1f);
+		ASSERT_THAT(IsFalse(IsHeld(), "A new vehicle should decide on its first firing"));
+
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(IsHeld(), "Unchanged inputs within the hold time should hold"));
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(IsHeld()));
+
+		System->Update(0.1f);
+		ASSERT_THAT(IsFalse(IsHeld(), "The vehicle should decide again once the hold time has passed"));
+	}
+
+	TEST_METHOD(Key_Input_Change_Forces_An_Early_Decision)
+	{
+		System->Update(0.1f);
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(IsHeld()));
+
+		// Drift sideways past DecisionHoldLateralOffsetCM
+		Pawn->SetActorLocation(FVector(1000, 2.0f * Context->TrainerConfig->DecisionHoldLateralOffsetCM, 0));
+		System->Update(0.1f);
+		ASSERT_THAT(IsFalse(IsHeld(), "A lateral offset change above the threshold should force a decision"));
+	}
+
+	TEST_METHOD(Removed_Decision_State_Or_Zero_Hold_Time_Evaluates_Every_Firing)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		System->Update(0.1f);
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(IsHeld()));
+
+		// What the reset system does for a new life
+		Registry.remove<FVehicleDecisionComponent, FNNHoldOutputTag>(Entity);
+		System->Update(0.1f);
+		ASSERT_THAT(IsFalse(IsHeld(), "A reset vehicle should decide on the next firing"));
+
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(IsHeld()));
+		Context->TrainerConfig->DecisionHoldMaxSec = 0.0f;
+		System->Update(0.1f);
+		ASSERT_THAT(IsFalse(IsHeld(), "A zero hold time should clear the hold tags"));
+	}
+};
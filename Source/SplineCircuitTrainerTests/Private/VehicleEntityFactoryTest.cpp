@@ -0,0 +1,117 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "SplineTestActor.h"
+#include "Systems/VehicleEntityFactory.h"
+#include "Components/NNIOComponents.h"
+#include "Components/NetworkComponent.h"
+#include "Components/GenomeComponents.h"
+#include "Components/TrainingDataComponent.h"
+#include "VehicleComponent.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "Components/SplineComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+TEST_CLASS(SplineCircuitTrainer_VehicleEntityFactory_Tests, "SplineCircuitTrainer.VehicleEntityFactory")
+{
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AVehicleTrainerContext> Context;
+	TObjectPtr<ASplineTestActor> SplineActor;
+	TObjectPtr<UVehicleEntityFactory> System;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("EntityFactoryTestWorld")));
+		Context = World->SpawnActor<AVehicleTrainerContext>();
+		Context->TrainerConfig = NewObject<UVehicleTrainerConfig>();
+		Context->TrainerConfig->VehiclePawnClass = APawn::StaticClass();
+		Context->TrainerConfig->Population = 5;
+		Context->TrainerConfig->NumPopulations = 1;
+		Context->TrainerConfig->SpawnBudgetPerFrame = 2;
+		Context->TrainerConfig->bSpawnAIControllers = false;
+
+		SplineActor = World->SpawnActor<ASplineTestActor>();
+		Context->CircuitActor = SplineActor;
+		SplineActor->SplineComponent->ClearSplinePoints();
+		SplineActor->SplineComponent->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->AddSplinePoint(FVector(10000, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->SetClosedLoop(false);
+		SplineActor->SplineComponent->UpdateSpline();
+
+		System = NewObject<UVehicleEntityFactory>();
+	}
+
+	AFTER_EACH()
+	{
+		if (System)
+		{
+			System->Deinitialize();
+		}
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	int32 CountLiveVehicles() const
+	{
+		int32 NumVehicles = 0;
+		auto View = Context->GetRegistry().view<FVehicleComponent, FTrainingDataComponent, FFitnessComponent, FUniqueSolutionComponent>();
+		for (const entt::entity Entity : View)
+		{
+			if (View.get<FVehicleComponent>(Entity).VehiclePawn)
+			{
+				++NumVehicles;
+			}
+		}
+		return NumVehicles;
+	}
+
+	TEST_METHOD(Pool_Is_Built_Up_Front_And_Pawns_Spawn_Within_The_Budget)
+	{
+		System->Initialize(Context);
+		entt::registry& Registry = Context->GetRegistry();
+
+		int32 NumNetworks = 0;
+		auto NetworkView = Registry.view<FNeuralNetworkFloat, FGenomeFloatViewComponent>();
+		for (const entt::entity Entity : NetworkView)
+		{
+			ASSERT_THAT(IsTrue(NetworkView.get<FGenomeFloatViewComponent>(Entity).Values.Num() > 0, "Every pooled network should be built and linked to its genome"));
+			++NumNetworks;
+		}
+		ASSERT_THAT(AreEqual(5, NumNetworks));
+
+		ASSERT_THAT(AreEqual(2, CountLiveVehicles(), "Only the first batch should be spawned in Initialize"));
+		ASSERT_THAT(AreEqual(3, System->GetNumPendingVehicles()));
+
+		// The feedforward views FNeuralNetworkFloat + NN buffers: pooled entities must not match it before their pawn exists
+		int32 NumEvaluated = 0;
+		auto FeedforwardView = Registry.view<FNeuralNetworkFloat, FNNInFLoatComp, FNNOutFloatComp>();
+		for (const entt::entity Entity : FeedforwardView)
+		{
+			ASSERT_THAT(IsTrue(Registry.all_of<FVehicleComponent>(Entity), "NN buffers should only be added with the pawn"));
+			ASSERT_THAT(AreEqual(Context->TrainerConfig->GetTotalInputCount(), FeedforwardView.get<FNNInFLoatComp>(Entity).Values.Num()));
+			++NumEvaluated;
+		}
+		ASSERT_THAT(AreEqual(2, NumEvaluated));
+
+		System->SpawnPendingVehicles();
+		System->SpawnPendingVehicles();
+		ASSERT_THAT(AreEqual(0, System->GetNumPendingVehicles()));
+
+		ASSERT_THAT(AreEqual(5, CountLiveVehicles(), "Each later batch should spawn the rest of the pool"));
+	}
+
+	TEST_METHOD(Zero_Budget_Spawns_Every_Pawn_In_Initialize)
+	{
+		Context->TrainerConfig->SpawnBudgetPerFrame = 0;
+		System->Initialize(Context);
+
+		ASSERT_THAT(AreEqual(0, System->GetNumPendingVehicles()));
+		ASSERT_THAT(AreEqual(5, CountLiveVehicles()));
+	}
+};
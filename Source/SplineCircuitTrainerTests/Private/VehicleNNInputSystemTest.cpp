@@ -0,0 +1,203 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "SplineTestActor.h"
+#include "Systems/VehicleNNInputSystem.h"
+#include "Components/NNIOComponents.h"
+#include "VehicleComponent.h"
+#include "KinematicVehiclePawn.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "VehicleInputSchema.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+TEST_CLASS(SplineCircuitTrainer_VehicleNNInputSystem_Tests, "SplineCircuitTrainer.VehicleNNInputSystem")
+{
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AVehicleTrainerContext> Context;
+	TObjectPtr<ASplineTestActor> SplineActor;
+	TObjectPtr<UVehicleNNInputSystem> System;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("InputTestWorld")));
+		Context = World->SpawnActor<AVehicleTrainerContext>();
+		Context->TrainerConfig = NewObject<UVehicleTrainerConfig>();
+
+		SplineActor = World->SpawnActor<ASplineTestActor>();
+		Context->CircuitActor = SplineActor;
+		SplineActor->SplineComponent->ClearSplinePoints();
+		SplineActor->SplineComponent->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->AddSplinePoint(FVector(10000, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->SetClosedLoop(false);
+		SplineActor->SplineComponent->UpdateSpline();
+
+		System = NewObject<UVehicleNNInputSystem>();
+		System->Initialize(Context);
+	}
+
+	AFTER_EACH()
+	{
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	TEST_METHOD(Parallel_Feature_Pass_Writes_Each_Vehicle_From_Its_Snapshot)
+	{
+		// More vehicles than one feature chunk, so the pass runs on several tasks
+		constexpr int32 NumVehicles = 150;
+		const UVehicleTrainerConfig& Config = *Context->TrainerConfig;
+		entt::registry& Registry = Context->GetRegistry();
+
+		TArray<entt::entity> Entities;
+		for (int32 i = 0; i < NumVehicles; ++i)
+		{
+			APawn* Pawn = World->SpawnActor<APawn>();
+			Pawn->SetActorLocation(FVector(50.0f * i, 2.0f * i, 0.0f));
+
+			const entt::entity Entity = Registry.create();
+			Registry.emplace<FVehicleComponent>(Entity, Pawn);
+			Registry.emplace<FNNInFLoatComp>(Entity);
+			Entities.Add(Entity);
+		}
+
+		System->Update(0.1f);
+
+		const float InvMaxDistance = 1.0f / Config.MaxDistanceNormalization;
+		const int32 ProgressIndex = 2 + Config.FutureDotProductDistances.Num() + 3;
+		for (int32 i = 0; i < NumVehicles; ++i)
+		{
+			const TArray<float>& Values = Registry.get<FNNInFLoatComp>(Entities[i]).Values;
+			ASSERT_THAT(AreEqual(Config.GetTotalInputCount(), Values.Num()));
+
+			// The spline runs along +X with +Z up, so its right side is -Y
+			ASSERT_THAT(IsNear(FMath::Clamp(-2.0f * i * InvMaxDistance, -1.0f, 1.0f), Values[0], 1e-3f));
+			ASSERT_THAT(IsNear(50.0f * i / 10000.0f, Values[ProgressIndex], 1e-3f));
+
+			// Plain pawns have no vehicle interface: no wheels, idle engine, gear at mid-range
+			ASSERT_THAT(IsNear(0.5f, Values[Config.GetTotalInputCount() - Config.RecurrentInputCount - 1], 1e-6f));
+		}
+	}
+
+	TEST_METHOD(Telemetry_Comes_From_Cached_Interface)
+	{
+		const UVehicleTrainerConfig& Config = *Context->TrainerConfig;
+		entt::registry& Registry = Context->GetRegistry();
+
+		AKinematicVehiclePawn* Pawn = World->SpawnActor<AKinematicVehiclePawn>();
+		Pawn->SetActorLocation(FVector(500, 0, 0));
+		// 0.8 rpm, third of six gears, braking at 1 g and cornering right at 1 g
+		Pawn->SetTelemetry(FVector::ZeroVector, 0.8f, 2, 6, -9.81f, 9.81f);
+
+		const entt::entity Entity = Registry.create();
+		FVehicleComponent& VehicleComp = Registry.emplace<FVehicleComponent>(Entity, Pawn);
+		Registry.emplace<FNNInFLoatComp>(Entity);
+		ASSERT_THAT(IsTrue(VehicleComp.GetNNInterface() == static_cast<IVehicleNNInterface*>(Pawn)));
+
+		System->Update(0.1f);
+
+		FVehicleTelemetry Expected;
+		Pawn->FillTelemetry(Expected);
+
+		const TArray<float>& Values = Registry.get<FNNInFLoatComp>(Entity).Values;
+		int32 Index = 2 + Config.FutureDotProductDistances.Num() + 5 + 8;
+		ASSERT_THAT(IsNear(1.0f, Values[Index++], 1e-6f));
+		for (int32 i = 0; i < FVehicleTelemetry::MaxWheels; ++i)
+		{
+			ASSERT_THAT(IsNear(1.0f, Values[Index++], 1e-6f));
+		}
+		for (int32 i = 0; i < FVehicleTelemetry::MaxWheels; ++i)
+		{
+			ASSERT_THAT(IsNear(Expected.WheelCompression[i], Values[Index++], 1e-6f));
+		}
+		ASSERT_THAT(IsNear(0.8f, Values[Index++], 1e-6f));
+		ASSERT_THAT(IsNear(0.5f, Values[Index++], 1e-6f));
+
+		// Front-left carries both the braking and the cornering load
+		ASSERT_THAT(IsTrue(Expected.WheelCompression[0] > Expected.WheelCompression[3]));
+
+		// The bulk call agrees with the per-wheel getters it replaces
+		TArray<float> Legacy;
+		Pawn->GetWheelSuspensionCompression(Legacy);
+		for (int32 i = 0; i < FVehicleTelemetry::MaxWheels; ++i)
+		{
+			ASSERT_THAT(IsNear(Legacy[i], Expected.WheelCompression[i], 1e-6f));
+		}
+	}
+
+	TEST_METHOD(Input_Schema_Controls_Layout_And_Normalization)
+	{
+		UVehicleTrainerConfig& Config = *Context->TrainerConfig;
+		Config.InputFeatures.Reset();
+		Config.InputFeatures.Add(FVehicleInputFeature(EVehicleInputSource::SplineProgress));
+		FVehicleInputFeature& Distance = Config.InputFeatures.Add_GetRef(FVehicleInputFeature(EVehicleInputSource::SignedDistance));
+		Distance.bOverrideNormalization = true;
+		Distance.Scale = 0.01f;
+		Distance.ClampMin = -0.5f;
+		Distance.ClampMax = 0.5f;
+		FVehicleInputFeature& Disabled = Config.InputFeatures.Add_GetRef(FVehicleInputFeature(EVehicleInputSource::WheelContacts));
+		Disabled.bEnabled = false;
+		ASSERT_THAT(AreEqual(2 + Config.RecurrentInputCount, Config.GetTotalInputCount()));
+
+		entt::registry& Registry = Context->GetRegistry();
+		TArray<entt::entity> Entities;
+		for (const FVector& Location : { FVector(2500, -30, 0), FVector(0, -100, 0) })
+		{
+			APawn* Pawn = World->SpawnActor<APawn>();
+			Pawn->SetActorLocation(Location);
+			const entt::entity Entity = Registry.create();
+			Registry.emplace<FVehicleComponent>(Entity, Pawn);
+			Registry.emplace<FNNInFLoatComp>(Entity);
+			Entities.Add(Entity);
+		}
+
+		System->Update(0.1f);
+
+		const TArray<float>& Near = Registry.get<FNNInFLoatComp>(Entities[0]).Values;
+		ASSERT_THAT(AreEqual(Config.GetTotalInputCount(), Near.Num()));
+		ASSERT_THAT(IsNear(0.25f, Near[0], 1e-3f));
+		ASSERT_THAT(IsNear(0.3f, Near[1], 1e-3f));
+
+		const TArray<float>& Far = Registry.get<FNNInFLoatComp>(Entities[1]).Values;
+		ASSERT_THAT(IsNear(0.0f, Far[0], 1e-3f));
+		ASSERT_THAT(IsNear(0.5f, Far[1], 1e-6f));
+	}
+
+	TEST_METHOD(Edits_To_The_Same_Config_Recompile_The_Schema)
+	{
+		UVehicleTrainerConfig& Config = *Context->TrainerConfig;
+		Config.InputFeatures.Reset();
+		FVehicleInputFeature& Distance = Config.InputFeatures.Add_GetRef(FVehicleInputFeature(EVehicleInputSource::SignedDistance));
+		Distance.bOverrideNormalization = true;
+		Distance.Scale = 0.01f;
+		// Listed twice: the first entry wins and the count agrees with the compiled schema
+		Config.InputFeatures.Add(FVehicleInputFeature(EVehicleInputSource::SignedDistance));
+
+		FVehicleInputSchema Compiled;
+		Compiled.Compile(Config);
+		ASSERT_THAT(AreEqual(1, Compiled.Num()));
+		ASSERT_THAT(AreEqual(Compiled.Num(), FVehicleInputSchema::CountInputs(Config)));
+		ASSERT_THAT(IsFalse(FVehicleInputSchema::ValidateFeatures(Config)));
+
+		entt::registry& Registry = Context->GetRegistry();
+		APawn* Pawn = World->SpawnActor<APawn>();
+		Pawn->SetActorLocation(FVector(2500, -30, 0));
+		const entt::entity Entity = Registry.create();
+		Registry.emplace<FVehicleComponent>(Entity, Pawn);
+		Registry.emplace<FNNInFLoatComp>(Entity);
+
+		System->Update(0.1f);
+		ASSERT_THAT(IsNear(0.3f, Registry.get<FNNInFLoatComp>(Entity).Values[0], 1e-3f));
+
+		// Runtime edit of the same asset: no new config object, only new values
+		Config.InputFeatures[0].Scale = 0.001f;
+		ASSERT_THAT(AreNotEqual(Compiled.CompiledHash, FVehicleInputSchema::HashConfig(Config)));
+		System->Update(0.1f);
+		ASSERT_THAT(IsNear(0.03f, Registry.get<FNNInFLoatComp>(Entity).Values[0], 1e-4f, TEXT("The new scale applies without swapping the config")));
+	}
+};
@@ -302,31 +302,75 @@ TEST_CLASS(SplineCircuitTrainer_VehicleProgressSystem_Tests, "SplineCircuitTrain
 		FTrainingDataComponent& Data = Registry.emplace<FTrainingDataComponent>(Entity);
 		UVehicleLibrary::SetTrainingData(Data, SplineActor->SplineComponent, Pawn->GetActorLocation(), World->GetTimeSeconds());
 
-		// Initial update
-		System->Update(0.1f);
+		// Initial update; one GA period per update, so MinProgress applies unscaled
+		const float Period = AVehicleTrainerContext::GADecisionPeriodSec;
+		System->Update(Period);
 		ASSERT_THAT(IsNear(0.0f, Data.TimeSinceLastProgress, 0.01f, "Initially time since last progress should be 0"));
 
 		// Move forward enough to reset timer (MinProgress is 10)
 		Pawn->SetActorLocation(FVector(20, 0, 0));
-		System->Update(0.1f);
+		System->Update(Period);
 		ASSERT_THAT(IsNear(0.0f, Data.TimeSinceLastProgress, 0.01f, "Time since last progress should be reset when delta > MinProgress"));
 
 		// Move forward not enough
 		Pawn->SetActorLocation(FVector(25, 0, 0)); // Delta is 5
-		System->Update(0.1f);
-		ASSERT_THAT(IsNear(0.1f, Data.TimeSinceLastProgress, 0.01f, "Time since last progress should increase when delta <= MinProgress"));
+		System->Update(Period);
+		ASSERT_THAT(IsNear(Period, Data.TimeSinceLastProgress, 0.01f, "Time since last progress should increase when delta <= MinProgress"));
 
 		// Move backward
 		Pawn->SetActorLocation(FVector(20, 0, 0)); // Delta is -5
-		System->Update(0.1f);
-		ASSERT_THAT(IsNear(0.2f, Data.TimeSinceLastProgress, 0.01f, "Time since last progress should increase when moving backward"));
+		System->Update(Period);
+		ASSERT_THAT(IsNear(2.0f * Period, Data.TimeSinceLastProgress, 0.01f, "Time since last progress should increase when moving backward"));
 
 		// Move forward enough again
 		Pawn->SetActorLocation(FVector(100, 0, 0)); // Delta is 80
-		System->Update(0.1f);
+		System->Update(Period);
 		ASSERT_THAT(IsNear(0.0f, Data.TimeSinceLastProgress, 0.01f, "Time since last progress should be reset again when delta > MinProgress"));
 	}
 
+	TEST_METHOD(MinimumProgress_Implies_The_Same_Speed_In_Both_Chains)
+	{
+		// MinProgress 10 cm per 0.5 s GA period is 20 cm/s; one vehicle just above it, one just below
+		UVehicleProgressSystem* NetworkSystem = NewObject<UVehicleProgressSystem>();
+		NetworkSystem->ShardChannel = EVehicleShardChannel::Network;
+		NetworkSystem->Initialize(Context);
+
+		entt::registry& Registry = Context->GetRegistry();
+		const float Speeds[2] = { 30.0f, 10.0f };
+		APawn* Pawns[2];
+		entt::entity Entities[2];
+		for (int32 i = 0; i < 2; ++i)
+		{
+			Pawns[i] = World->SpawnActor<APawn>();
+			Pawns[i]->SetActorLocation(FVector(100, 100.0f * i, 0));
+			Entities[i] = Registry.create();
+			Registry.emplace<FVehicleComponent>(Entities[i], Pawns[i]);
+			FTrainingDataComponent& Data = Registry.emplace<FTrainingDataComponent>(Entities[i]);
+			UVehicleLibrary::SetTrainingData(Data, SplineActor->SplineComponent, Pawns[i]->GetActorLocation(), World->GetTimeSeconds());
+		}
+
+		auto Drive = [&](UVehicleProgressSystem* Sys, float Interval, int32 Steps)
+		{
+			for (int32 Step = 0; Step < Steps; ++Step)
+			{
+				for (int32 i = 0; i < 2; ++i)
+				{
+					Pawns[i]->AddActorWorldOffset(FVector(Speeds[i] * Interval, 0, 0));
+				}
+				Sys->Update(Interval);
+			}
+		};
+
+		// One second in the GA chain (two 0.5 s evaluations), then one second in the network chain (ten 0.1 s firings)
+		Drive(System, AVehicleTrainerContext::GADecisionPeriodSec, 2);
+		ASSERT_THAT(IsNear(0.0f, Registry.get<FTrainingDataComponent>(Entities[0]).TimeSinceLastProgress, 0.01f, "30 cm/s is progress in the GA chain"));
+		ASSERT_THAT(IsNear(1.0f, Registry.get<FTrainingDataComponent>(Entities[1]).TimeSinceLastProgress, 0.01f, "10 cm/s is no progress in the GA chain"));
+
+		Drive(NetworkSystem, AVehicleTrainerContext::NetworkDecisionPeriodSec, 10);
+		ASSERT_THAT(IsNear(0.0f, Registry.get<FTrainingDataComponent>(Entities[0]).TimeSinceLastProgress, 0.01f, "30 cm/s should stay progress at the network rate"));
+		ASSERT_THAT(IsNear(2.0f, Registry.get<FTrainingDataComponent>(Entities[1]).TimeSinceLastProgress, 0.01f, "10 cm/s should stay no progress at the network rate"));
+	}
+
 	TEST_METHOD(BackwardMovementMarksForResetAndZerosProgress)
 	{
 		// Setup spline with multiple segments
@@ -0,0 +1,155 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "SplineTestActor.h"
+#include "Systems/VehicleReactiveGASystem.h"
+#include "Systems/VehicleResetSystem.h"
+#include "Systems/BreedFloatGenomesSystem.h"
+#include "Systems/MutationFloatGenomeSystem.h"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+#include "Components/TrainingDataComponent.h"
+#include "VehicleComponent.h"
+#include "VehicleLibrary.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "Components/SplineComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+TEST_CLASS(SplineCircuitTrainer_VehicleReactiveGASystem_Tests, "SplineCircuitTrainer.VehicleReactiveGASystem")
+{
+	static constexpr int32 GenomeSize = 8;
+
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AVehicleTrainerContext> Context;
+	TObjectPtr<ASplineTestActor> SplineActor;
+	TObjectPtr<UVehicleReactiveGASystem> System;
+	TArray<TArray<float>> Genomes;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("ReactiveGATestWorld")));
+		Context = World->SpawnActor<AVehicleTrainerContext>();
+		Context->TrainerConfig = NewObject<UVehicleTrainerConfig>();
+		Context->TrainerConfig->EliteCount = 1;
+		Context->TrainerConfig->MinBreedAge = 0.0f;
+		Context->TrainerConfig->HighestFitnessFactor = 0.0f;
+
+		SplineActor = World->SpawnActor<ASplineTestActor>();
+		Context->CircuitActor = SplineActor;
+		SplineActor->SplineComponent->ClearSplinePoints();
+		SplineActor->SplineComponent->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->AddSplinePoint(FVector(10000, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->SetClosedLoop(false);
+		SplineActor->SplineComponent->UpdateSpline();
+
+		UVehicleResetSystem* Resetter = NewObject<UVehicleResetSystem>();
+		Resetter->Initialize(Context);
+
+		System = NewObject<UVehicleReactiveGASystem>();
+		System->Breeder = NewObject<UBreedFloatGenomesSystem>();
+		System->Breeder->bRecordLineage = false;
+		System->Mutator = NewObject<UMutationFloatGenomeSystem>();
+		System->Resetter = Resetter;
+		System->ContextSeed = 7;
+		System->Initialize(Context);
+
+		// Genome views point into these buffers; no reallocation while the test runs
+		Genomes.Reset();
+		Genomes.Reserve(8);
+	}
+
+	AFTER_EACH()
+	{
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	entt::entity CreateSolution(float Fitness, float GeneValue, int64 Id)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		const entt::entity Entity = Registry.create();
+
+		FFitnessComponent Fit;
+		Fit.Fitness.Add(Fitness);
+		Fit.BuiltForFitnessIndex = 0;
+		Registry.emplace<FFitnessComponent>(Entity, Fit);
+
+		TArray<float>& Genome = Genomes.AddDefaulted_GetRef();
+		Genome.Init(GeneValue, GenomeSize);
+		Registry.emplace<FGenomeFloatViewComponent>(Entity).Values = Genome;
+		Registry.emplace<FUniqueSolutionComponent>(Entity).Id = Id;
+		return Entity;
+	}
+
+	entt::entity CreateVehicle(float Fitness, float GeneValue, int64 Id)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		const entt::entity Entity = CreateSolution(Fitness, GeneValue, Id);
+
+		APawn* Pawn = World->SpawnActor<APawn>();
+		Pawn->SetActorLocation(FVector(3000, 0, 0));
+		Registry.emplace<FVehicleComponent>(Entity, Pawn);
+		FTrainingDataComponent& Data = Registry.emplace<FTrainingDataComponent>(Entity);
+		Data.CreationTime = World->GetTimeSeconds() - 20.0f;
+		Data.DistanceTraveled = 3000.0f;
+		return Entity;
+	}
+
+	entt::entity CreateElite(float Fitness, float GeneValue, int64 SourceId)
+	{
+		const entt::entity Entity = CreateSolution(Fitness, GeneValue, 900 + SourceId);
+		Context->GetRegistry().get<FUniqueSolutionComponent>(Entity).SourceId = SourceId;
+		Context->GetRegistry().emplace<FEliteTagComponent>(Entity);
+		return Entity;
+	}
+
+	bool GenomeEquals(entt::entity Entity, float GeneValue) const
+	{
+		for (const float Value : Context->GetRegistry().get<FGenomeFloatViewComponent>(Entity).Values)
+		{
+			if (Value != GeneValue)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	TEST_METHOD(Flagged_Vehicle_Is_Bred_And_Reset_In_The_Same_Firing)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		CreateElite(100.0f, 1.0f, 1);
+		CreateVehicle(50.0f, 1.0f, 2);
+		const entt::entity Dying = CreateVehicle(1.0f, 0.0f, 3);
+		Registry.emplace<FResetGenomeComponent>(Dying, FResetGenomeComponent{ UVehicleLibrary::ReasonNoProgress });
+
+		System->Update(0.1f);
+
+		ASSERT_THAT(IsFalse(Registry.all_of<FResetGenomeComponent>(Dying), "The replaced vehicle should be driving again"));
+		ASSERT_THAT(IsFalse(GenomeEquals(Dying, 0.0f), "The vehicle should carry a child of the live parents"));
+		ASSERT_THAT(AreNotEqual(int64(3), Registry.get<FUniqueSolutionComponent>(Dying).Id, "A new life needs a new solution id"));
+		ASSERT_THAT(AreEqual(0.0f, Registry.get<FFitnessComponent>(Dying).Fitness[0]));
+		ASSERT_THAT(AreEqual(0.0f, Registry.get<FTrainingDataComponent>(Dying).DistanceTraveled));
+	}
+
+	TEST_METHOD(Vehicle_That_Would_Become_An_Elite_Waits_For_The_GA_Step)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		CreateElite(100.0f, 1.0f, 1);
+		CreateVehicle(50.0f, 1.0f, 2);
+		const entt::entity Champion = CreateVehicle(200.0f, 0.0f, 3);
+		Registry.emplace<FResetGenomeComponent>(Champion, FResetGenomeComponent{ UVehicleLibrary::ReasonNoProgress });
+
+		System->Update(0.1f);
+
+		ASSERT_THAT(IsTrue(Registry.all_of<FResetGenomeComponent>(Champion), "Elite selection must snapshot the genome before it is replaced"));
+		ASSERT_THAT(IsTrue(GenomeEquals(Champion, 0.0f)));
+		ASSERT_THAT(AreEqual(int64(3), Registry.get<FUniqueSolutionComponent>(Champion).Id));
+	}
+};
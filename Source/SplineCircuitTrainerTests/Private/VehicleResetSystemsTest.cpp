@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "CQTest.h"
 #include "Systems/VehicleResetFlagSystem.h"
+#include "Systems/VehicleResetSystem.h"
+#include "Components/NetworkComponent.h"
+#include "VehicleLibrary.h"
 #include "Components/TrainingDataComponent.h"
 #include "VehicleComponent.h"
 #include "VehicleTrainerContext.h"
@@ -110,4 +113,55 @@ TEST_CLASS(SplineCircuitTrainer_VehicleResetSystems_Tests, "SplineCircuitTrainer
 		FlagSystem->Update(0.1f);
 		ASSERT_THAT(IsTrue(Registry.all_of<FResetGenomeComponent>(Entity), "Should be flagged after 1.5s because avg velocity (33.3) < 100"));
 	}
+
+	TEST_METHOD(ResetsFlaggedVehiclesToTheSpawnPointInOnePass)
+	{
+		UVehicleResetSystem* ResetSystem = NewObject<UVehicleResetSystem>();
+		ResetSystem->Initialize(Context);
+		entt::registry& Registry = Context->GetRegistry();
+
+		TArray<FNeuralNetworkLayerDescriptor> Layers;
+		Layers.Add(FNeuralNetworkLayerDescriptor(4));
+		Layers.Add(FNeuralNetworkLayerDescriptor(2));
+
+		TArray<entt::entity> Entities;
+		TArray<APawn*> Pawns;
+		for (int32 i = 0; i < 2; ++i)
+		{
+			APawn* Pawn = World->SpawnActor<APawn>();
+			Pawn->SetActorLocation(FVector(3000, 100.0f * i, 0));
+
+			const entt::entity Entity = Registry.create();
+			Registry.emplace<FVehicleComponent>(Entity, Pawn);
+			FTrainingDataComponent& Data = Registry.emplace<FTrainingDataComponent>(Entity);
+			Data.DistanceTraveled = 3000.0f;
+			Registry.emplace<FUniqueSolutionComponent>(Entity).Id = 100 + i;
+			FNeuralNetworkFloat& NetComp = Registry.emplace<FNeuralNetworkFloat>(Entity);
+			NetComp.Initialize(Layers, 1);
+			Registry.emplace<FGenomeFloatViewComponent>(Entity).Values = NetComp.Network.GetDataView();
+			Registry.emplace<FResetGenomeComponent>(Entity).ReasonForReset = i == 0 ? UVehicleLibrary::ReasonBackwardStart : UVehicleLibrary::ReasonNoProgress;
+
+			Entities.Add(Entity);
+			Pawns.Add(Pawn);
+		}
+
+		const float* BufferBefore = Registry.get<FGenomeFloatViewComponent>(Entities[0]).Values.GetData();
+		const TArray<float> WeightsBefore(Registry.get<FGenomeFloatViewComponent>(Entities[0]).Values);
+		ResetSystem->Update(0.1f);
+
+		FVector SpawnLocation;
+		FRotator SpawnRotation;
+		UVehicleLibrary::GetVehicleSpawnTransform(SplineActor->SplineComponent, Config->SpawnParametricDistance, Config->SpawnVerticalOffset, SpawnLocation, SpawnRotation);
+		for (int32 i = 0; i < 2; ++i)
+		{
+			ASSERT_THAT(IsTrue(Pawns[i]->GetActorLocation().Equals(SpawnLocation, 1.0f), "Every flagged vehicle should be back at the spawn point"));
+			ASSERT_THAT(AreEqual(0.0f, Registry.get<FTrainingDataComponent>(Entities[i]).DistanceTraveled));
+			ASSERT_THAT(IsTrue(Registry.get<FUniqueSolutionComponent>(Entities[i]).Id != 100 + i, "A new life should get a new solution id"));
+		}
+
+		const TArrayView<float> WeightsAfter = Registry.get<FGenomeFloatViewComponent>(Entities[0]).Values;
+		ASSERT_THAT(IsTrue(WeightsAfter.GetData() == BufferBefore, "Re-randomization should reuse the network buffer"));
+		ASSERT_THAT(AreEqual(WeightsBefore.Num(), WeightsAfter.Num()));
+		ASSERT_THAT(IsTrue(FMemory::Memcmp(WeightsBefore.GetData(), WeightsAfter.GetData(), WeightsBefore.Num() * sizeof(float)) != 0, "A backward start should re-randomize the weights"));
+	}
 };
@@ -0,0 +1,160 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "Systems/VehicleShardSchedulerSystem.h"
+#include "Systems/GAStalenessSystem.h"
+#include "Components/GenomeComponents.h"
+#include "Components/EliteComponents.h"
+#include "GAStepGate.h"
+#include "Components/NNIOComponents.h"
+#include "VehicleComponent.h"
+#include "VehicleShardSchedule.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "Engine/World.h"
+
+
+TEST_CLASS(SplineCircuitTrainer_VehicleShardSchedulerSystem_Tests, "SplineCircuitTrainer.VehicleShardSchedulerSystem")
+{
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AVehicleTrainerContext> Context;
+	TObjectPtr<UVehicleShardSchedulerSystem> System;
+
+	static constexpr int32 NumVehicles = 12;
+	TArray<entt::entity> Entities;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("ShardSchedulerTestWorld")));
+		ASSERT_THAT(IsNotNull(World, "Transient world should be successfully created"));
+
+		Context = World->SpawnActor<AVehicleTrainerContext>();
+		ASSERT_THAT(IsNotNull(Context, "VehicleTrainerContext should be successfully spawned"));
+		Context->TrainerConfig = NewObject<UVehicleTrainerConfig>();
+
+		System = NewObject<UVehicleShardSchedulerSystem>();
+		ASSERT_THAT(IsNotNull(System, "VehicleShardSchedulerSystem should be successfully created"));
+		System->Initialize(Context);
+
+		entt::registry& Registry = Context->GetRegistry();
+		Entities.Reset();
+		for (int32 i = 0; i < NumVehicles; ++i)
+		{
+			const entt::entity Entity = Registry.create();
+			Registry.emplace<FVehicleComponent>(Entity);
+			Entities.Add(Entity);
+		}
+	}
+
+	AFTER_EACH()
+	{
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	TEST_METHOD(Each_Update_Activates_One_Shard_And_Rotation_Covers_All_Vehicles)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		System->NumShards = 3;
+
+		TSet<entt::entity> Evaluated;
+		for (int32 Step = 0; Step < 3; ++Step)
+		{
+			System->Update(0.1f);
+
+			int32 Active = 0;
+			for (const entt::entity Entity : Entities)
+			{
+				if (!Registry.all_of<FNNSkipEvaluationTag>(Entity))
+				{
+					++Active;
+					ASSERT_THAT(IsFalse(Evaluated.Contains(Entity), "A vehicle should be active once per rotation"));
+					Evaluated.Add(Entity);
+				}
+			}
+			ASSERT_THAT(AreEqual(NumVehicles / 3, Active, "Exactly one third of the vehicles should be active"));
+		}
+		ASSERT_THAT(AreEqual(NumVehicles, Evaluated.Num(), "A full rotation should evaluate every vehicle"));
+	}
+
+	TEST_METHOD(Vehicle_DeltaTime_Covers_The_Whole_Rotation)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		System->NumShards = 3;
+
+		for (int32 Step = 0; Step < 6; ++Step)
+		{
+			System->Update(0.1f);
+		}
+
+		ASSERT_THAT(IsNear(0.3f, FVehicleShardSchedule::GetVehicleDeltaTime(Registry, EVehicleShardChannel::Network, 0.1f), 1e-4f,
+			"Once warmed up a shard's vehicles should see K chain ticks of elapsed time"));
+		ASSERT_THAT(IsNear(0.1f, FVehicleShardSchedule::GetVehicleDeltaTime(Registry, EVehicleShardChannel::GA, 0.1f), 1e-4f,
+			"An unsharded channel should report the chain DeltaTime"));
+	}
+
+	TEST_METHOD(Single_Shard_Clears_Skip_Tags)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		System->NumShards = 4;
+		System->Update(0.1f);
+		ASSERT_THAT(IsTrue(Registry.view<FNNSkipEvaluationTag>().size() > 0, "Sharding should tag the inactive vehicles"));
+
+		System->NumShards = 1;
+		System->Update(0.1f);
+		ASSERT_THAT(AreEqual(0, static_cast<int32>(Registry.view<FNNSkipEvaluationTag>().size()), "One shard should evaluate every vehicle"));
+		ASSERT_THAT(IsNear(0.1f, FVehicleShardSchedule::GetVehicleDeltaTime(Registry, EVehicleShardChannel::Network, 0.1f), 1e-4f,
+			"One shard should report the chain DeltaTime"));
+	}
+
+	TEST_METHOD(Sharded_GA_Channel_Samples_Staleness_Once_Per_Period)
+	{
+		entt::registry& Registry = Context->GetRegistry();
+		UVehicleTrainerConfig* Config = Context->TrainerConfig;
+		Config->NumPopulations = 2;
+		Config->bEnableNuke = true;
+		Config->MinHistoryForStaleness = 3;
+
+		System->Channel = EVehicleShardChannel::GA;
+		System->NumShards = 2;
+		UGAStalenessSystem* Staleness = NewObject<UGAStalenessSystem>();
+		Staleness->Initialize(Context);
+
+		// Flat elite fitness in both populations: population 0 is the lowest and goes stale once its history is full
+		for (int32 Pop = 0; Pop < 2; ++Pop)
+		{
+			const entt::entity Elite = Registry.create();
+			Registry.emplace<FEliteTagComponent>(Elite);
+			FFitnessComponent& Fit = Registry.emplace<FFitnessComponent>(Elite);
+			Fit.Fitness.Init(0.0f, 2);
+			Fit.Fitness[Pop] = 10.0f * (Pop + 1);
+			Fit.BuiltForFitnessIndex = Pop;
+		}
+		const entt::entity Member = Registry.create();
+		FFitnessComponent& MemberFit = Registry.emplace<FFitnessComponent>(Member);
+		MemberFit.Fitness.Init(0.0f, 2);
+		MemberFit.BuiltForFitnessIndex = 0;
+
+		auto Fire = [this]()
+		{
+			System->Update(0.1f);
+			Staleness->Update(0.1f);
+		};
+
+		// Four firings are two periods: two history samples, one short of the window
+		for (int32 Step = 0; Step < 4; ++Step)
+		{
+			Fire();
+		}
+		ASSERT_THAT(IsFalse(Registry.all_of<FResetGenomeComponent>(Member), "Staleness should sample once per rotation, not once per firing"));
+
+		Fire();
+		ASSERT_THAT(IsTrue(FGAStepGate::IsPopulationStep(Registry), "The firing that wraps to shard 0 should be a step"));
+		ASSERT_THAT(IsNear(0.2f, FGAStepGate::GetStepDeltaTime(Registry, 0.1f), 1e-4f, "A step should see the whole period"));
+		ASSERT_THAT(IsTrue(Registry.all_of<FResetGenomeComponent>(Member), "The third period should fill the window and nuke the stale population"));
+	}
+};
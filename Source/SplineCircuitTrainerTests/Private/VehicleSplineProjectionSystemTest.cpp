@@ -0,0 +1,83 @@
+//Copyright (c) 2025 Renato Kuurstra. Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "CoreMinimal.h"
+#include "CQTest.h"
+#include "SplineTestActor.h"
+#include "Systems/VehicleSplineProjectionSystem.h"
+#include "Components/SplineProjectionComponent.h"
+#include "Components/TrainingDataComponent.h"
+#include "SplineTrackIndex.h"
+#include "VehicleComponent.h"
+#include "VehicleLibrary.h"
+#include "VehicleTrainerContext.h"
+#include "VehicleTrainerConfig.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+TEST_CLASS(SplineCircuitTrainer_VehicleSplineProjectionSystem_Tests, "SplineCircuitTrainer.VehicleSplineProjectionSystem")
+{
+	TObjectPtr<UWorld> World;
+	TObjectPtr<AVehicleTrainerContext> Context;
+	TObjectPtr<ASplineTestActor> SplineActor;
+	TObjectPtr<UVehicleSplineProjectionSystem> System;
+
+	BEFORE_EACH()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, FName(TEXT("ProjectionTestWorld")));
+		Context = World->SpawnActor<AVehicleTrainerContext>();
+		Context->TrainerConfig = NewObject<UVehicleTrainerConfig>();
+
+		SplineActor = World->SpawnActor<ASplineTestActor>();
+		Context->CircuitActor = SplineActor;
+		SplineActor->SplineComponent->ClearSplinePoints();
+		SplineActor->SplineComponent->AddSplinePoint(FVector(0, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->AddSplinePoint(FVector(1000, 0, 0), ESplineCoordinateSpace::World);
+		SplineActor->SplineComponent->SetClosedLoop(false);
+		SplineActor->SplineComponent->UpdateSpline();
+
+		System = NewObject<UVehicleSplineProjectionSystem>();
+		System->Initialize(Context);
+	}
+
+	AFTER_EACH()
+	{
+		if (World)
+		{
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	TEST_METHOD(Writes_Projection_Shared_By_Consumers)
+	{
+		APawn* Pawn = World->SpawnActor<APawn>();
+		Pawn->SetActorLocation(FVector(300, 120, 0));
+
+		entt::registry& Registry = Context->GetRegistry();
+		const entt::entity Entity = Registry.create();
+		Registry.emplace<FVehicleComponent>(Entity, Pawn);
+		Registry.emplace<FTrainingDataComponent>(Entity);
+
+		System->Update(0.1f);
+
+		const FSplineProjectionComponent* Projection = Registry.try_get<FSplineProjectionComponent>(Entity);
+		ASSERT_THAT(IsNotNull(Projection, "Projection component should be added to vehicle entities"));
+		ASSERT_THAT(IsTrue(Projection->bValid));
+		ASSERT_THAT(IsNear(300.0f, Projection->Distance, 0.5f));
+		ASSERT_THAT(IsNear(120.0f, Projection->DistanceToSpline, 0.5f));
+		ASSERT_THAT(IsNear(120.0f, FMath::Abs(Projection->SignedLateralOffset), 0.5f));
+		ASSERT_THAT(AreEqual(0, Projection->Segment));
+
+		// Consumers get the stored component while it is current...
+		FSplineProjectionComponent Scratch;
+		const FSplineTrackIndex& Track = FSplineTrackIndex::Get(Registry);
+		ASSERT_THAT(IsTrue(&UVehicleLibrary::GetFrameProjection(Registry, Entity, Track, Pawn, Scratch) == Projection));
+
+		// ...and a fresh projection once it is from an earlier frame
+		Registry.get<FSplineProjectionComponent>(Entity).FrameNumber = GFrameCounter - 1;
+		Pawn->SetActorLocation(FVector(700, 0, 0));
+		const FSplineProjectionComponent& Fresh = UVehicleLibrary::GetFrameProjection(Registry, Entity, Track, Pawn, Scratch);
+		ASSERT_THAT(IsTrue(&Fresh == &Scratch));
+		ASSERT_THAT(IsNear(700.0f, Fresh.Distance, 0.5f));
+	}
+};